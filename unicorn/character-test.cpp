@@ -1,6 +1,7 @@
 #include "unicorn/character.hpp"
 #include "unicorn/ucd-tables.hpp"
 #include "unicorn/unit-test.hpp"
+#include <algorithm>
 #include <iostream>
 #include <map>
 #include <string>
@@ -1474,8 +1475,17 @@ void test_unicorn_character_decomposition_properties() {
         if (entry.second > 1)
             FAIL("U+" + hex(entry.first) + " appears in " + std::to_string(entry.second) + " decomposition tables");
 
-    for (auto&& entry: UnicornDetail::composition_table)
-        TEST_EQUAL(combining_class(entry.key[0]), 0);
+    size_t compositions = 0;
+    for (auto&& entry: UnicornDetail::canonical_table) {
+        char32_t c = entry.value[1] ? canonical_composition(entry.value[0], entry.value[1]) : 0;
+        if (c) {
+            ++compositions;
+            TEST_EQUAL(c, entry.key);
+            TEST_EQUAL(combining_class(entry.value[0]), 0);
+        }
+    }
+    TEST_EQUAL(compositions, size_t(std::count_if(UnicornDetail::composition_list_table.begin(), UnicornDetail::composition_list_table.end(),
+        [] (auto& pair) { return pair[0] != 0; })));
 
     TEST_EQUAL(combining_class(0), 0);
     TEST_EQUAL(combining_class('A'), 0);
@@ -1514,6 +1524,28 @@ void test_unicorn_character_decomposition_properties() {
     TEST_EQUAL(canonical_composition(0x1111, 0x1171), 0xd4cc); // Hangul
     TEST_EQUAL(canonical_composition(0xd4cc, 0x11b6), 0xd4db); // Hangul
 
+    TEST_EQUAL(nfc_quick_check('A'), Quick_Check::Yes);
+    TEST_EQUAL(nfd_quick_check('A'), Quick_Check::Yes);
+    TEST_EQUAL(nfkc_quick_check('A'), Quick_Check::Yes);
+    TEST_EQUAL(nfkd_quick_check('A'), Quick_Check::Yes);
+    TEST_EQUAL(nfc_quick_check(0xc0), Quick_Check::Yes);    // latin capital letter a with grave
+    TEST_EQUAL(nfd_quick_check(0xc0), Quick_Check::No);
+    TEST_EQUAL(nfkc_quick_check(0xc0), Quick_Check::Yes);
+    TEST_EQUAL(nfkd_quick_check(0xc0), Quick_Check::No);
+    TEST_EQUAL(nfc_quick_check(0x300), Quick_Check::Maybe);  // combining grave accent
+    TEST_EQUAL(nfd_quick_check(0x300), Quick_Check::Yes);
+    TEST_EQUAL(nfkc_quick_check(0x300), Quick_Check::Maybe);
+    TEST_EQUAL(nfkd_quick_check(0x300), Quick_Check::Yes);
+    TEST_EQUAL(nfc_quick_check(0x340), Quick_Check::No);     // combining grave tone mark
+    TEST_EQUAL(nfc_quick_check(0xbd), Quick_Check::Yes);     // vulgar fraction one half
+    TEST_EQUAL(nfd_quick_check(0xbd), Quick_Check::Yes);
+    TEST_EQUAL(nfkc_quick_check(0xbd), Quick_Check::No);
+    TEST_EQUAL(nfkd_quick_check(0xbd), Quick_Check::No);
+    TEST_EQUAL(nfc_quick_check(0x1161), Quick_Check::Maybe); // hangul jungseong a
+    TEST_EQUAL(nfc_quick_check(0xd4db), Quick_Check::Yes);   // hangul syllable
+    TEST_EQUAL(nfd_quick_check(0xd4db), Quick_Check::No);
+    TEST_EQUAL(nfc_quick_check(0x10ffff), Quick_Check::Yes);
+
 }
 
 void test_unicorn_character_enumeration_properties() {
@@ -1641,6 +1673,10 @@ void test_unicorn_character_enumeration_properties() {
     TEST_PROPERTY_STRING(Numeric_Type, Digit);
     TEST_PROPERTY_STRING(Numeric_Type, Numeric);
 
+    TEST_PROPERTY_STRING(Quick_Check, Yes);
+    TEST_PROPERTY_STRING(Quick_Check, Maybe);
+    TEST_PROPERTY_STRING(Quick_Check, No);
+
     TEST_PROPERTY_STRING(Sentence_Break, Other);
     TEST_PROPERTY_STRING(Sentence_Break, ATerm);
     TEST_PROPERTY_STRING(Sentence_Break, Close);
@@ -1838,6 +1874,62 @@ void test_unicorn_character_enumeration_properties() {
 
 }
 
+void test_unicorn_character_packed_properties() {
+
+    CharProps p;
+
+    TEST_EQUAL(p.general_category(), GC::Cn);
+    TEST_EQUAL(p.combining_class(), 0);
+    TEST(! p.is_cased());
+
+    TRY(p = char_props(U'A'));
+    TEST_EQUAL(p.general_category(), GC::Lu);
+    TEST_EQUAL(p.primary_category(), 'L');
+    TEST_EQUAL(p.word_break(), Word_Break::ALetter);
+    TEST_EQUAL(p.sentence_break(), Sentence_Break::Upper);
+    TEST_EQUAL(p.line_break(), Line_Break::AL);
+    TEST_EQUAL(p.east_asian_width(), East_Asian_Width::Na);
+    TEST(p.is_cased());
+    TEST(p.is_uppercase());
+    TEST(! p.is_lowercase());
+    TEST(! p.is_case_ignorable());
+    TEST(! p.is_white_space());
+
+    TRY(p = char_props(0x301));
+    TEST_EQUAL(p.general_category(), GC::Mn);
+    TEST_EQUAL(p.grapheme_cluster_break(), Grapheme_Cluster_Break::Extend);
+    TEST_EQUAL(p.combining_class(), 230);
+    TEST(p.is_case_ignorable());
+    TEST(! p.is_cased());
+
+    TRY(p = char_props(0x3000));
+    TEST_EQUAL(p.general_category(), GC::Zs);
+    TEST_EQUAL(p.east_asian_width(), East_Asian_Width::F);
+    TEST(p.is_white_space());
+
+    TRY(p = char_props(0x110000));
+    TEST_EQUAL(p.bits(), CharProps().bits());
+
+    size_t mismatches = 0;
+
+    for (char32_t c = 0; c <= 0x110000 && mismatches < 10; ++c) {
+        p = char_props(c);
+        bool ok = p.general_category() == char_general_category(c)
+            && p.grapheme_cluster_break() == grapheme_cluster_break(c)
+            && p.word_break() == word_break(c)
+            && p.sentence_break() == sentence_break(c)
+            && p.line_break() == line_break(c)
+            && p.east_asian_width() == east_asian_width(c)
+            && p.combining_class() == combining_class(c)
+            && p.is_white_space() == char_is_white_space(c);
+        if (! ok) {
+            ++mismatches;
+            FAIL("Packed properties mismatch: " + char_as_hex(c));
+        }
+    }
+
+}
+
 void test_unicorn_character_numeric_properties() {
 
     { auto x = numeric_value(0);     TEST_EQUAL(x.first, 0);  TEST_EQUAL(x.second, 1); }
@@ -48,7 +48,7 @@ namespace RS::Unicorn {
             Version v {0,0,0};
             auto& table = UnicornDetail::unicode_version_table().table;
             for (auto& entry: table) {
-                if (sparse_table_lookup(UnicornDetail::general_category_table, entry.second) == 0x436e) // Cn
+                if (trie_lookup(UnicornDetail::general_category_trie, entry.second) == 0x436e) // Cn
                     break;
                 v = entry.first;
             }
@@ -124,7 +124,7 @@ namespace RS::Unicorn {
     }
 
     GC char_general_category(char32_t c) noexcept {
-        return GC(sparse_table_lookup(UnicornDetail::general_category_table, c));
+        return GC(trie_lookup(UnicornDetail::general_category_trie, c));
     }
 
     std::vector<GC> gc_list() {
@@ -193,21 +193,21 @@ namespace RS::Unicorn {
 
     // Boolean properties
 
-    bool char_is_default_ignorable(char32_t c) noexcept { return sparse_set_lookup(UnicornDetail::default_ignorable_table, c); }
-    bool char_is_soft_dotted(char32_t c) noexcept { return sparse_set_lookup(UnicornDetail::soft_dotted_table, c); }
-    bool char_is_white_space(char32_t c) noexcept { return sparse_set_lookup(UnicornDetail::white_space_table, c); }
-    bool char_is_id_start(char32_t c) noexcept { return sparse_set_lookup(UnicornDetail::id_start_table, c); }
-    bool char_is_id_nonstart(char32_t c) noexcept { return sparse_set_lookup(UnicornDetail::id_nonstart_table, c); }
-    bool char_is_xid_start(char32_t c) noexcept { return sparse_set_lookup(UnicornDetail::xid_start_table, c); }
-    bool char_is_xid_nonstart(char32_t c) noexcept { return sparse_set_lookup(UnicornDetail::xid_nonstart_table, c); }
-    bool char_is_pattern_syntax(char32_t c) noexcept { return sparse_set_lookup(UnicornDetail::pattern_syntax_table, c); }
-    bool char_is_pattern_white_space(char32_t c) noexcept { return sparse_set_lookup(UnicornDetail::pattern_white_space_table, c); }
+    bool char_is_default_ignorable(char32_t c) noexcept { return trie_lookup(UnicornDetail::default_ignorable_trie, c); }
+    bool char_is_soft_dotted(char32_t c) noexcept { return trie_lookup(UnicornDetail::soft_dotted_trie, c); }
+    bool char_is_white_space(char32_t c) noexcept { return trie_lookup(UnicornDetail::white_space_trie, c); }
+    bool char_is_id_start(char32_t c) noexcept { return trie_lookup(UnicornDetail::id_start_trie, c); }
+    bool char_is_id_nonstart(char32_t c) noexcept { return trie_lookup(UnicornDetail::id_nonstart_trie, c); }
+    bool char_is_xid_start(char32_t c) noexcept { return trie_lookup(UnicornDetail::xid_start_trie, c); }
+    bool char_is_xid_nonstart(char32_t c) noexcept { return trie_lookup(UnicornDetail::xid_nonstart_trie, c); }
+    bool char_is_pattern_syntax(char32_t c) noexcept { return trie_lookup(UnicornDetail::pattern_syntax_trie, c); }
+    bool char_is_pattern_white_space(char32_t c) noexcept { return trie_lookup(UnicornDetail::pattern_white_space_trie, c); }
 
     // Bidirectional properties
 
     Bidi_Class bidi_class(char32_t c) noexcept {
         using namespace UnicornDetail;
-        auto rc = sparse_table_lookup(bidi_class_table, c);
+        auto rc = trie_lookup(bidi_class_trie, c);
         if (rc != Bidi_Class::Default)
             return rc;
         else if ((c >= 0x600 && c <= 0x7bf)
@@ -233,7 +233,7 @@ namespace RS::Unicorn {
     }
 
     bool char_is_bidi_mirrored(char32_t c) noexcept {
-        return std::binary_search(std::begin(UnicornDetail::bidi_mirrored_table), std::end(UnicornDetail::bidi_mirrored_table), c);
+        return trie_lookup(UnicornDetail::bidi_mirrored_trie, c);
     }
 
     char32_t bidi_mirroring_glyph(char32_t c) noexcept {
@@ -279,9 +279,9 @@ namespace RS::Unicorn {
     // Case folding properties
 
     Case char_case(char32_t c) noexcept {
-        if (sparse_set_lookup(UnicornDetail::other_uppercase_table, c))
+        if (trie_lookup(UnicornDetail::other_uppercase_trie, c))
             return Case::upper;
-        else if (sparse_set_lookup(UnicornDetail::other_lowercase_table, c))
+        else if (trie_lookup(UnicornDetail::other_lowercase_trie, c))
             return Case::lower;
         switch (char_general_category(c)) {
             case GC::Ll: return Case::lower;
@@ -301,49 +301,35 @@ namespace RS::Unicorn {
     }
 
     bool char_is_cased(char32_t c) noexcept {
-        if (sparse_set_lookup(UnicornDetail::other_uppercase_table, c)
-                || sparse_set_lookup(UnicornDetail::other_lowercase_table, c))
-            return true;
-        auto gc = char_general_category(c);
-        return gc == GC::Ll || gc == GC::Lt || gc == GC::Lu;
+        return char_props(c).is_cased();
     }
 
     bool char_is_case_ignorable(char32_t c) noexcept {
-        auto wb = word_break(c);
-        if (wb == Word_Break::MidLetter
-                || wb == Word_Break::MidNumLet
-                || wb == Word_Break::Single_Quote)
-            return true;
-        auto gc = char_general_category(c);
-        return gc == GC::Cf || gc == GC::Lm || gc == GC::Me || gc == GC::Mn || gc == GC::Sk;
+        return char_props(c).is_case_ignorable();
     }
 
     bool char_is_uppercase(char32_t c) noexcept {
-        return sparse_set_lookup(UnicornDetail::other_uppercase_table, c) || char_general_category(c) == GC::Lu;
+        return char_props(c).is_uppercase();
     }
 
     bool char_is_lowercase(char32_t c) noexcept {
-        return sparse_set_lookup(UnicornDetail::other_lowercase_table, c) || char_general_category(c) == GC::Ll;
+        return char_props(c).is_lowercase();
     }
 
     char32_t char_to_simple_uppercase(char32_t c) noexcept {
-        return table_lookup(UnicornDetail::simple_uppercase_table, c, c);
+        return c + trie_lookup(UnicornDetail::simple_uppercase_trie, c);
     }
 
     char32_t char_to_simple_lowercase(char32_t c) noexcept {
-        return table_lookup(UnicornDetail::simple_lowercase_table, c, c);
+        return c + trie_lookup(UnicornDetail::simple_lowercase_trie, c);
     }
 
     char32_t char_to_simple_titlecase(char32_t c) noexcept {
-        using namespace UnicornDetail;
-        auto t = table_lookup(simple_titlecase_table, c, not_found);
-        return t == not_found ? char_to_simple_uppercase(c) : t;
+        return c + trie_lookup(UnicornDetail::simple_titlecase_trie, c);
     }
 
     char32_t char_to_simple_casefold(char32_t c) noexcept {
-        using namespace UnicornDetail;
-        auto t = table_lookup(simple_casefold_table, c, not_found);
-        return t == not_found ? char_to_simple_lowercase(c) : t;
+        return c + trie_lookup(UnicornDetail::simple_casefold_trie, c);
     }
 
     char32_t char_to_simple_case(char32_t c, Case k) noexcept {
@@ -617,8 +603,11 @@ namespace RS::Unicorn {
         static constexpr uint32_t lbase = 0x1100;
         static constexpr uint32_t vbase = 0x1161;
         static constexpr uint32_t tbase = 0x11a7;
+        static constexpr uint32_t lcount = 19;
+        static constexpr uint32_t vcount = 21;
         static constexpr uint32_t tcount = 28;
         static constexpr uint32_t ncount = 588;
+        static constexpr uint32_t scount = 11172;
 
         size_t hangul_decomposition(char32_t c, char32_t* dst) {
             auto type = hangul_syllable_type(c);
@@ -640,37 +629,31 @@ namespace RS::Unicorn {
         }
 
         char32_t hangul_composition(char32_t u1, char32_t u2) noexcept {
-            auto type1 = hangul_syllable_type(u1), type2 = hangul_syllable_type(u2);
-            if (type1 == Hangul_Syllable_Type::L && type2 == Hangul_Syllable_Type::V) {
-                uint32_t lindex = u1 - lbase;
-                uint32_t vindex = u2 - vbase;
-                uint32_t lvindex = lindex * ncount + vindex * tcount;
-                return sbase + lvindex;
-            } else if (type1 == Hangul_Syllable_Type::LV && type2 == Hangul_Syllable_Type::T) {
-                char32_t lv[2];
-                hangul_decomposition(u1, lv);
-                uint32_t lindex = lv[0] - lbase;
-                uint32_t vindex = lv[1] - vbase;
-                uint32_t tindex = u2 - tbase;
-                uint32_t lvindex = lindex * ncount + vindex * tcount;
-                return sbase + lvindex + tindex;
-            } else {
+            if (u1 >= lbase && u1 < lbase + lcount && u2 >= vbase && u2 < vbase + vcount)
+                return sbase + ((u1 - lbase) * vcount + (u2 - vbase)) * tcount;
+            else if (u1 >= sbase && u1 < sbase + scount && (u1 - sbase) % tcount == 0 && u2 > tbase && u2 < tbase + tcount)
+                return u1 + (u2 - tbase);
+            else
                 return 0;
-            }
         }
 
     }
 
     int combining_class(char32_t c) noexcept {
-        return sparse_table_lookup(UnicornDetail::combining_class_table, c);
+        return trie_lookup(UnicornDetail::combining_class_trie, c);
     }
 
     char32_t canonical_composition(char32_t u1, char32_t u2) noexcept {
         using namespace UnicornDetail;
+        if (! trie_lookup(composition_second_trie, u2))
+            return 0;
         char32_t c(hangul_composition(u1, u2));
         if (! c) {
-            std::array<char32_t, 2> key{{u1, u2}};
-            c = table_lookup(composition_table, key, char32_t(0));
+            size_t start = trie_lookup(composition_start_trie, u1);
+            if (start)
+                for (auto p = composition_list_table.begin() + (start - 1); (*p)[0] && (*p)[0] <= u2; ++p)
+                    if ((*p)[0] == u2)
+                        return (*p)[1];
         }
         return c;
     }
@@ -693,34 +676,50 @@ namespace RS::Unicorn {
         return n;
     }
 
+    Quick_Check nfc_quick_check(char32_t c) noexcept {
+        return trie_lookup(UnicornDetail::nfc_quick_check_trie, c);
+    }
+
+    Quick_Check nfd_quick_check(char32_t c) noexcept {
+        return trie_lookup(UnicornDetail::nfd_quick_check_trie, c);
+    }
+
+    Quick_Check nfkc_quick_check(char32_t c) noexcept {
+        return trie_lookup(UnicornDetail::nfkc_quick_check_trie, c);
+    }
+
+    Quick_Check nfkd_quick_check(char32_t c) noexcept {
+        return trie_lookup(UnicornDetail::nfkd_quick_check_trie, c);
+    }
+
     // Enumeration properties
 
     East_Asian_Width east_asian_width(char32_t c) noexcept {
-        return sparse_table_lookup(UnicornDetail::east_asian_width_table, c);
+        return trie_lookup(UnicornDetail::east_asian_width_trie, c);
     }
 
     Grapheme_Cluster_Break grapheme_cluster_break(char32_t c) noexcept {
-        return sparse_table_lookup(UnicornDetail::grapheme_cluster_break_table, c);
+        return trie_lookup(UnicornDetail::grapheme_cluster_break_trie, c);
     }
 
     Hangul_Syllable_Type hangul_syllable_type(char32_t c) noexcept {
-        return sparse_table_lookup(UnicornDetail::hangul_syllable_type_table, c);
+        return trie_lookup(UnicornDetail::hangul_syllable_type_trie, c);
     }
 
     Indic_Positional_Category indic_positional_category(char32_t c) noexcept {
-        return sparse_table_lookup(UnicornDetail::indic_positional_category_table, c);
+        return trie_lookup(UnicornDetail::indic_positional_category_trie, c);
     }
 
     Indic_Syllabic_Category indic_syllabic_category(char32_t c) noexcept {
-        return sparse_table_lookup(UnicornDetail::indic_syllabic_category_table, c);
+        return trie_lookup(UnicornDetail::indic_syllabic_category_trie, c);
     }
 
     Joining_Group joining_group(char32_t c) noexcept {
-        return sparse_table_lookup(UnicornDetail::joining_group_table, c);
+        return trie_lookup(UnicornDetail::joining_group_trie, c);
     }
 
     Joining_Type joining_type(char32_t c) noexcept {
-        auto rc = sparse_table_lookup(UnicornDetail::joining_type_table, c);
+        auto rc = trie_lookup(UnicornDetail::joining_type_trie, c);
         if (rc != Joining_Type::Default)
             return rc;
         auto gc = char_general_category(c);
@@ -731,19 +730,25 @@ namespace RS::Unicorn {
     }
 
     Line_Break line_break(char32_t c) noexcept {
-        return sparse_table_lookup(UnicornDetail::line_break_table, c);
+        return trie_lookup(UnicornDetail::line_break_trie, c);
     }
 
     Numeric_Type numeric_type(char32_t c) noexcept {
-        return sparse_table_lookup(UnicornDetail::numeric_type_table, c);
+        return trie_lookup(UnicornDetail::numeric_type_trie, c);
     }
 
     Sentence_Break sentence_break(char32_t c) noexcept {
-        return sparse_table_lookup(UnicornDetail::sentence_break_table, c);
+        return trie_lookup(UnicornDetail::sentence_break_trie, c);
     }
 
     Word_Break word_break(char32_t c) noexcept {
-        return sparse_table_lookup(UnicornDetail::word_break_table, c);
+        return trie_lookup(UnicornDetail::word_break_trie, c);
+    }
+
+    // Packed character properties
+
+    CharProps char_props(char32_t c) noexcept {
+        return CharProps(trie_lookup(UnicornDetail::char_props_trie, c));
     }
 
     // Numeric properties
@@ -822,7 +827,7 @@ namespace RS::Unicorn {
     }
 
     Ustring char_script(char32_t c) {
-        return decode_script(sparse_table_lookup(UnicornDetail::scripts_table, c));
+        return decode_script(trie_lookup(UnicornDetail::scripts_trie, c));
     }
 
     Strings char_script_list(char32_t c) {
@@ -250,6 +250,10 @@ namespace RS::Unicorn {
     char32_t canonical_composition(char32_t u1, char32_t u2) noexcept;
     size_t canonical_decomposition(char32_t c, char32_t* dst) noexcept;
     size_t compatibility_decomposition(char32_t c, char32_t* dst) noexcept;
+    Quick_Check nfc_quick_check(char32_t c) noexcept;
+    Quick_Check nfd_quick_check(char32_t c) noexcept;
+    Quick_Check nfkc_quick_check(char32_t c) noexcept;
+    Quick_Check nfkd_quick_check(char32_t c) noexcept;
 
     // Enumeration properties
 
@@ -265,6 +269,34 @@ namespace RS::Unicorn {
     Sentence_Break sentence_break(char32_t c) noexcept;
     Word_Break word_break(char32_t c) noexcept;
 
+    // Packed character properties
+
+    class CharProps {
+    public:
+        constexpr CharProps() noexcept = default;
+        constexpr explicit CharProps(uint64_t bits) noexcept: bits_(bits) {}
+        constexpr uint64_t bits() const noexcept { return bits_; }
+        constexpr GC general_category() const noexcept { return GC(field(0, 16)); }
+        constexpr char primary_category() const noexcept { return char(field(8, 8)); }
+        constexpr Grapheme_Cluster_Break grapheme_cluster_break() const noexcept { return Grapheme_Cluster_Break(field(16, 4)); }
+        constexpr Word_Break word_break() const noexcept { return Word_Break(field(20, 5)); }
+        constexpr Sentence_Break sentence_break() const noexcept { return Sentence_Break(field(25, 5)); }
+        constexpr Line_Break line_break() const noexcept { return Line_Break(field(30, 6)); }
+        constexpr East_Asian_Width east_asian_width() const noexcept { return East_Asian_Width(field(36, 3)); }
+        constexpr int combining_class() const noexcept { return int(field(39, 8)); }
+        constexpr bool is_cased() const noexcept { return field(47, 1); }
+        constexpr bool is_case_ignorable() const noexcept { return field(48, 1); }
+        constexpr bool is_uppercase() const noexcept { return field(49, 1); }
+        constexpr bool is_lowercase() const noexcept { return field(50, 1); }
+        constexpr bool is_white_space() const noexcept { return field(51, 1); }
+    private:
+        // Bit layout must match char_props in make-tables
+        uint64_t bits_ = uint16_t(GC::Cn);
+        constexpr uint32_t field(int pos, int len) const noexcept { return uint32_t((bits_ >> pos) & ((uint64_t(1) << len) - 1)); }
+    };
+
+    CharProps char_props(char32_t c) noexcept;
+
     // Numeric properties
 
     std::pair<long long, long long> numeric_value(char32_t c);
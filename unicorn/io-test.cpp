@@ -1,10 +1,17 @@
 #include "unicorn/io.hpp"
 #include "unicorn/path.hpp"
+#include "unicorn/string.hpp"
 #include "unicorn/unit-test.hpp"
 #include "unicorn/utf.hpp"
 #include <algorithm>
+#include <mutex>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 #include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
 
 using namespace RS;
 using namespace RS::Unicorn;
@@ -278,6 +285,257 @@ void test_unicorn_io_file_reader() {
 
 }
 
+void test_unicorn_io_file_reader_blocks() {
+
+    Path testfile = "__test__";
+
+    auto guard = scope_exit([=] { testfile.remove(); });
+
+    // Long enough that reading goes beyond the first block, with line
+    // breaks of every kind falling on block boundaries
+
+    static const Strings breaks = {"\n", "\r\n", "\r", "\f", "!!"};
+    std::string text, pending;
+    Strings expect, vec;
+    for (int i = 0; i < 3000; ++i) {
+        auto line = "Line " + std::to_string(i) + ": " + std::string(i % 71, char('a' + i % 26));
+        auto& eol = breaks[i % breaks.size()];
+        text += line + eol;
+        pending += line + eol;
+        if (eol != "!!") {
+            expect.push_back(pending);
+            pending.clear();
+        }
+    }
+    expect.push_back(pending);
+    TRY(testfile.save(text));
+    TEST_COMPARE(text.size(), >, FileReader::default_read_size);
+
+    FileReader it, end;
+    TEST_EQUAL(it.read_size(), FileReader::default_read_size);
+
+    for (size_t read_size: {1, 2, 3, 7, 256, 1 << 20}) {
+        TRY(it = FileReader(testfile, IO::striplf, ""s, "!!"s));
+        TRY(it.set_read_size(read_size));
+        TEST_EQUAL(it.read_size(), read_size);
+        vec.clear();
+        TRY(std::copy(it, end, append(vec)));
+        TEST_EQUAL(vec.size(), 600);
+        TEST_EQUAL(vec.front(), "Line 0: \nLine 1: b\r\nLine 2: cc\rLine 3: ddd\fLine 4: eeee");
+        TEST_EQUAL(vec.back().substr(vec.back().size() - 5), "jjjjj");
+        TRY(it = FileReader(testfile));
+        TRY(it.set_read_size(read_size));
+        vec.clear();
+        TRY(std::copy(it, end, append(vec)));
+        TEST_EQUAL(vec.size(), expect.size());
+        TEST_EQUAL_RANGE(vec, expect);
+    }
+
+}
+
+void test_unicorn_io_mapped_file_reader() {
+
+    Path testfile = "__test__";
+    Path nonesuch = "__no_such_file__";
+
+    auto guard = scope_exit([=] { testfile.remove(); });
+
+    Strings vec;
+    std::vector<std::string_view> views;
+    Irange<FileReader> range;
+
+    TEST_THROW(range = read_lines(nonesuch, IO::mmap), std::system_error);
+    TRY(range = read_lines(nonesuch, IO::mmap | IO::pretend));
+    TEST_EQUAL(range_count(range), 0);
+
+    TRY(testfile.save(""));
+    TRY(range = read_lines(testfile, IO::mmap));
+    TEST_EQUAL(range_count(range), 0);
+
+    TRY(testfile.save(
+        "Last night I saw upon the stair\n"
+        "A little man who wasn't there\r\n"
+        "He wasn't there again today\r"
+        "\f"
+        "He must be from the NSA"
+    ));
+    TRY(range = read_lines(testfile, IO::mmap));
+    TRY(std::copy(range.begin(), range.end(), overwrite(vec)));
+    TEST_EQUAL(vec.size(), 5);
+    TEST_EQUAL_RANGE(vec, (Strings{
+        "Last night I saw upon the stair\n",
+        "A little man who wasn't there\r\n",
+        "He wasn't there again today\r",
+        "\f",
+        "He must be from the NSA",
+    }));
+
+    // Views into the mapping stay valid while the iterator is alive
+    TRY(range = read_lines(testfile, IO::mmap | IO::striplf | IO::notempty));
+    views.clear();
+    for (auto it = range.begin(); it != range.end(); ++it)
+        views.push_back(it.view());
+    TEST_EQUAL(views.size(), 4);
+    TEST_EQUAL_RANGE(Strings(views.begin(), views.end()), (Strings{
+        "Last night I saw upon the stair",
+        "A little man who wasn't there",
+        "He wasn't there again today",
+        "He must be from the NSA",
+    }));
+
+    // Transformations that change the text fall back to buffered reading
+    for (auto flags: {IO::lf, IO::crlf, IO::striptws, IO::stripws}) {
+        Strings expect;
+        TRY(range = read_lines(testfile, flags));
+        TRY(std::copy(range.begin(), range.end(), overwrite(expect)));
+        TRY(range = read_lines(testfile, flags | IO::mmap));
+        TRY(std::copy(range.begin(), range.end(), overwrite(vec)));
+        TEST_EQUAL_RANGE(vec, expect);
+    }
+
+    TRY(testfile.save("\ufeffHello world\n\ufeffGoodbye\n"));
+    TRY(range = read_lines(testfile, IO::mmap | IO::bom));
+    TRY(std::copy(range.begin(), range.end(), overwrite(vec)));
+    TEST_EQUAL(vec.size(), 2);
+    TEST_EQUAL_RANGE(vec, (Strings{"Hello world\n", "\ufeffGoodbye\n"}));
+
+    // A file containing only a BOM still has one (empty) line
+    for (auto text: {"\ufeff", "\ufeff\n", "\ufeff\r\n", "\ufeffx", "\ufeff\ufeff\n"}) {
+        TRY(testfile.save(text));
+        for (auto flags: {IO::bom, IO::bom | IO::striplf, IO::bom | IO::notempty, IO::bom | IO::striplf | IO::notempty}) {
+            Strings expect;
+            TRY(range = read_lines(testfile, flags));
+            TRY(std::copy(range.begin(), range.end(), overwrite(expect)));
+            TRY(range = read_lines(testfile, flags | IO::mmap));
+            TRY(std::copy(range.begin(), range.end(), overwrite(vec)));
+            TEST_EQUAL(vec.size(), expect.size());
+            TEST_EQUAL_RANGE(vec, expect);
+        }
+    }
+    TRY(testfile.save("\ufeff"));
+    TRY(range = read_lines(testfile, IO::mmap | IO::bom));
+    TRY(std::copy(range.begin(), range.end(), overwrite(vec)));
+    TEST_EQUAL_RANGE(vec, (Strings{""}));
+
+    TRY(testfile.save("Dollar\n\x80uro\nPound\n"));
+    TRY(range = read_lines(testfile, IO::mmap));
+    TRY(std::copy(range.begin(), range.end(), overwrite(vec)));
+    TEST_EQUAL(vec.size(), 3);
+    TEST_EQUAL_RANGE(vec, (Strings{"Dollar\n", "\ufffduro\n", "Pound\n"}));
+    TRY(range = read_lines(testfile, IO::mmap | Utf::throws));
+    TEST_THROW(std::copy(range.begin(), range.end(), overwrite(vec)), EncodingError);
+    TRY(range = read_lines(testfile, IO::mmap, "windows-1252"s));
+    TRY(std::copy(range.begin(), range.end(), overwrite(vec)));
+    TEST_EQUAL_RANGE(vec, (Strings{"Dollar\n", "€uro\n", "Pound\n"}));
+
+    TRY(testfile.save("Hello world!!Goodbye!!"));
+    TRY(range = read_lines(testfile, IO::mmap | IO::striplf, ""s, "!!"s));
+    TRY(std::copy(range.begin(), range.end(), overwrite(vec)));
+    TEST_EQUAL(vec.size(), 2);
+    TEST_EQUAL_RANGE(vec, (Strings{"Hello world", "Goodbye"}));
+
+}
+
+void test_unicorn_io_parallel_lines() {
+
+    Path testfile = "__test__";
+    Path nonesuch = "__no_such_file__";
+
+    auto guard = scope_exit([=] { testfile.remove(); });
+
+    using Numbered = std::vector<std::pair<size_t, Ustring>>;
+
+    std::mutex mtx;
+    Numbered lines;
+    Strings expect, vec;
+    Irange<FileReader> range;
+
+    auto collect = [&] (size_t n, const Ustring& line) {
+        std::lock_guard<std::mutex> lock(mtx);
+        lines.push_back({n, line});
+    };
+
+    auto texts = [&] {
+        std::sort(lines.begin(), lines.end());
+        vec.clear();
+        for (auto& [n, line]: lines)
+            vec.push_back(line);
+    };
+
+    TEST_THROW(process_lines(nonesuch, 0, collect), std::system_error);
+    TRY(process_lines(nonesuch, IO::pretend, collect));
+    TEST(lines.empty());
+
+    // More than one block, with a BOM, empty lines, trailing whitespace,
+    // and no line break on the last line
+
+    static const Strings breaks = {"\n", "\r\n", "\r", "\f", " \n", "\n\n"};
+    std::string text = "\xef\xbb\xbf";
+    for (int i = 0; i < 60000; ++i)
+        text += "Line " + std::to_string(i) + ": " + std::string(i % 41, char('a' + i % 26)) + breaks[i % breaks.size()];
+    text += "The end";
+    TRY(testfile.save(text));
+    TEST_COMPARE(text.size(), >, 0x100000);
+
+    for (uint32_t flags: {IO::bom, IO::bom | IO::striplf, IO::bom | IO::striplf | IO::notempty, IO::bom | IO::striptws | IO::notempty}) {
+        TRY(range = read_lines(testfile, flags));
+        expect.assign(range.begin(), range.end());
+        for (size_t threads: {1, 4}) {
+            lines.clear();
+            TRY(process_lines(testfile, flags, collect, threads));
+            texts();
+            TEST_EQUAL(vec.size(), expect.size());
+            TEST_EQUAL_RANGE(vec, expect);
+        }
+    }
+
+    // Line numbers count every line, including skipped empty ones
+
+    TRY(range = read_lines(testfile, IO::bom | IO::striplf));
+    expect.assign(range.begin(), range.end());
+    TEST_EQUAL(expect.size(), 70001);
+    lines.clear();
+    TRY(process_lines(testfile, IO::bom | IO::striplf | IO::notempty, collect, 4));
+    std::sort(lines.begin(), lines.end());
+    TEST_EQUAL(lines.size(), 60001);
+    TEST_EQUAL(lines.front().first, 1);
+    TEST_EQUAL(lines.back().first, 70001);
+    TEST(std::all_of(lines.begin(), lines.end(), [&] (auto& p) { return expect[p.first - 1] == p.second; }));
+
+    // Ordered output
+
+    Numbered ordered;
+    auto transform = [] (size_t n, const Ustring& line) { return std::to_string(n) + ": " + line; };
+    auto output = [&] (size_t n, const Ustring& line) { ordered.push_back({n, line}); };
+    TRY(process_lines(testfile, IO::bom | IO::striplf, transform, output, 4));
+    TEST_EQUAL(ordered.size(), 70001);
+    TEST(std::is_sorted(ordered.begin(), ordered.end()));
+    TEST_EQUAL(ordered[0].second, "1: Line 0: ");
+    TEST_EQUAL(ordered[1].second, "2: Line 1: b");
+    TEST_EQUAL(ordered.back().second, "70001: The end");
+
+    // Exceptions from the callback
+
+    auto thrower = [] (size_t n, const Ustring&) { if (n == 50000) throw std::runtime_error("Line 50000"); };
+    TEST_THROW_MATCH(process_lines(testfile, 0, thrower, 4), std::runtime_error, "Line 50000");
+    TEST_THROW_MATCH(process_lines(testfile, 0, transform, thrower, 4), std::runtime_error, "Line 50000");
+
+    // Other encodings
+
+    text.clear();
+    for (int i = 0; i < 1000; ++i)
+        text += "Caf\xe9 " + std::to_string(i) + "\r\n";
+    TRY(testfile.save(text));
+    TRY(range = read_lines(testfile, IO::striplf, "windows-1252"s));
+    expect.assign(range.begin(), range.end());
+    TEST_EQUAL(expect[0], "Caf\u00e9 0");
+    lines.clear();
+    TRY(process_lines(testfile, IO::striplf, "windows-1252"s, collect));
+    texts();
+    TEST_EQUAL_RANGE(vec, expect);
+
+}
+
 void test_unicorn_io_file_writer() {
 
     Path testfile = "__test__";
@@ -422,3 +680,71 @@ void test_unicorn_io_file_writer() {
     TEST_EQUAL(s, "North\r\nSouth\r\nEast\r\nWest\r\n");
 
 }
+
+void test_unicorn_io_async_file_writer() {
+
+    Path testfile = "__test__";
+
+    auto guard = scope_exit([=] { testfile.remove(); });
+
+    std::string s;
+    Strings vec;
+    FileWriter writer;
+
+    TEST_THROW(writer = FileWriter(testfile, IO::async | IO::linebuf), std::invalid_argument);
+    TEST_THROW(writer = FileWriter(testfile, IO::async | IO::unbuf), std::invalid_argument);
+
+    TRY(writer = FileWriter(testfile, IO::async | IO::bom | IO::writeline));
+    TRY(writer = "Hello world");
+    TRY(writer = "Goodbye");
+    TRY(writer.flush());
+    TRY(testfile.load(s));
+    TEST_EQUAL(s, "\xef\xbb\xbfHello world\nGoodbye\n");
+    TRY(writer = "Hello again");
+    TRY(writer.flush());
+    TRY(testfile.load(s));
+    TEST_EQUAL(s, "\xef\xbb\xbfHello world\nGoodbye\nHello again\n");
+
+    // Pending output is written when the last copy of the writer is destroyed
+
+    {
+        FileWriter temp(testfile, IO::async | IO::crlf);
+        TRY(temp = "North\nSouth\n");
+        TRY(temp = "East\nWest\n");
+    }
+    TRY(testfile.load(s));
+    TEST_EQUAL(s, "North\r\nSouth\r\nEast\r\nWest\r\n");
+
+    // Lines from different threads are not interleaved, and each thread's
+    // lines stay in order
+
+    static constexpr int threads = 8, lines = 20000;
+    std::vector<std::thread> pool;
+    TRY(writer = FileWriter(testfile, IO::async | IO::mutex | IO::writeline));
+    for (int t = 0; t < threads; ++t) {
+        pool.emplace_back([=] () mutable {
+            for (int i = 0; i < lines; ++i)
+                writer = std::to_string(t) + " " + std::to_string(i) + " " + std::string(i % 37, 'x');
+        });
+    }
+    for (auto& t: pool)
+        t.join();
+    TRY(writer.flush());
+    TRY(testfile.load(s));
+    vec = str_splitv_at(s, "\n");
+    TEST_EQUAL(vec.size(), threads * lines + 1);
+    TEST_EQUAL(vec.back(), "");
+    vec.pop_back();
+    std::vector<int> next(threads, 0);
+    int bad = 0;
+    for (auto& line: vec) {
+        auto parts = str_splitv_at(line, " ");
+        int t = std::stoi(parts.at(0)), i = std::stoi(parts.at(1));
+        if (i != next.at(t) || line != std::to_string(t) + " " + std::to_string(i) + " " + std::string(i % 37, 'x'))
+            ++bad;
+        next.at(t) = i + 1;
+    }
+    TEST_EQUAL(bad, 0);
+    TEST(std::all_of(next.begin(), next.end(), [] (int n) { return n == lines; }));
+
+}
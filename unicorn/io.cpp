@@ -4,12 +4,37 @@
 #include "unicorn/path.hpp"
 #include "unicorn/string.hpp"
 #include <algorithm>
+#include <atomic>
 #include <cerrno>
+#include <chrono>
+#include <condition_variable>
 #include <cstdio>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
 #include <iterator>
 #include <mutex>
 #include <stdexcept>
+#include <string_view>
 #include <system_error>
+#include <thread>
+#include <vector>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__)
+    #define UNICORN_IO_SSE2 1
+    #include <emmintrin.h>
+#endif
+
+#ifdef _XOPEN_SOURCE
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <sys/uio.h>
+    #include <unistd.h>
+#else
+    #include <windows.h>
+#endif
 
 using namespace RS::Unicorn::Literals;
 using namespace std::literals;
@@ -38,6 +63,429 @@ namespace RS::Unicorn {
             return {f, checked_fclose};
         }
 
+        // Read-only memory mapping of a regular file
+
+        class MappedFile {
+        public:
+            RS_NO_COPY_MOVE(MappedFile)
+            MappedFile() = default;
+            ~MappedFile() noexcept;
+            explicit operator bool() const noexcept { return mapped; }
+            bool open(const Path& file) noexcept;
+            std::string_view view() const noexcept { return {ptr, len}; }
+        private:
+            const char* ptr = nullptr;
+            size_t len = 0;
+            bool mapped = false;
+        };
+
+        #ifdef _XOPEN_SOURCE
+
+            MappedFile::~MappedFile() noexcept {
+                if (len > 0)
+                    munmap(const_cast<char*>(ptr), len);
+            }
+
+            bool MappedFile::open(const Path& file) noexcept {
+                int fd = ::open(file.c_name(), O_RDONLY | O_CLOEXEC);
+                if (fd == -1)
+                    return false;
+                struct stat st;
+                bool ok = fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && uint64_t(st.st_size) <= uint64_t(SIZE_MAX);
+                if (ok && st.st_size > 0) {
+                    void* p = ::mmap(nullptr, size_t(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+                    if (p == MAP_FAILED) {
+                        ok = false;
+                    } else {
+                        ptr = static_cast<const char*>(p);
+                        len = size_t(st.st_size);
+                        posix_madvise(p, len, POSIX_MADV_SEQUENTIAL);
+                    }
+                }
+                ::close(fd);
+                mapped = ok;
+                return ok;
+            }
+
+        #else
+
+            MappedFile::~MappedFile() noexcept {
+                if (len > 0)
+                    UnmapViewOfFile(ptr);
+            }
+
+            bool MappedFile::open(const Path& file) noexcept {
+                HANDLE fh = CreateFileW(file.c_name(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+                    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+                if (fh == INVALID_HANDLE_VALUE)
+                    return false;
+                LARGE_INTEGER size;
+                bool ok = GetFileType(fh) == FILE_TYPE_DISK && GetFileSizeEx(fh, &size)
+                    && uint64_t(size.QuadPart) <= uint64_t(SIZE_MAX);
+                if (ok && size.QuadPart > 0) {
+                    HANDLE mh = CreateFileMappingW(fh, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                    void* p = mh ? MapViewOfFile(mh, FILE_MAP_READ, 0, 0, 0) : nullptr;
+                    if (mh)
+                        CloseHandle(mh);
+                    if (p) {
+                        ptr = static_cast<const char*>(p);
+                        len = size_t(size.QuadPart);
+                    } else {
+                        ok = false;
+                    }
+                }
+                CloseHandle(fh);
+                mapped = ok;
+                return ok;
+            }
+
+        #endif
+
+        // Returns the position of the first LF, FF, or CR
+
+        size_t find_line_break(std::string_view str) noexcept {
+            auto p = str.data();
+            size_t n = str.size(), i = 0;
+            #ifdef UNICORN_IO_SSE2
+                auto lf = _mm_set1_epi8('\n'), ff = _mm_set1_epi8('\f'), cr = _mm_set1_epi8('\r');
+                for (; n - i >= 16; i += 16) {
+                    auto in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+                    auto match = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(in, lf), _mm_cmpeq_epi8(in, ff)), _mm_cmpeq_epi8(in, cr));
+                    if (auto mask = _mm_movemask_epi8(match))
+                        return i + __builtin_ctz(unsigned(mask));
+                }
+            #endif
+            for (; i < n; ++i) {
+                auto c = uint8_t(p[i]);
+                if (c <= '\r' && (c == '\n' || c == '\f' || c == '\r'))
+                    return i;
+            }
+            return npos;
+        }
+
+        // Applies the line flags to a decoded line
+
+        void fix_line(Ustring& line, uint32_t flags) {
+            if ((flags & IO::bom) && str_first_char(line) == byte_order_mark)
+                line.erase(0, utf_begin(line).count());
+            if (flags & IO::lf)
+                line += '\n';
+            else if (flags & IO::crlf)
+                line += "\r\n";
+            else if (flags & IO::striptws)
+                line = str_trim_right(line);
+            else if (flags & IO::stripws)
+                line = str_trim(line);
+        }
+
+        void check_reader_flags(uint32_t flags) {
+            if (popcount(flags & (Utf::replace | Utf::throws)) > 1
+                    || popcount(flags & (IO::crlf | IO::lf | IO::striplf | IO::striptws | IO::stripws)) > 1)
+                throw std::invalid_argument("Inconsistent file I/O flags");
+        }
+
+        SharedFile open_reader(const Path& file, uint32_t flags) {
+            static constexpr NC dash[] = {NC('-'), NC(0)};
+            static constexpr NC rb[] = {NC('r'), NC('b'), NC(0)};
+            if ((flags & IO::standin) && (file.empty() || file.os_view() == dash))
+                return {stdin, null_delete};
+            else
+                return shared_fopen(file, rb, ! (flags & IO::pretend));
+        }
+
+        // Parallel line processing: the calling thread reads the file in
+        // large blocks and splits them at line boundaries; each block is
+        // decoded on a worker thread
+
+        constexpr size_t parallel_block_size = 0x100000;
+
+        struct LineBlock {
+            std::string text;
+            std::vector<size_t> ends;   // End of each line, including the line break
+            size_t first_line = 0;      // Number of the first line in the block
+        };
+
+        using LineBlockPtr = std::shared_ptr<LineBlock>;
+
+        // Finds the complete lines in the block, starting the search at
+        // offset from. A CR at the end is not complete unless this is the
+        // last block, since it may be followed by an LF.
+
+        void split_lines(LineBlock& block, size_t from, bool last) {
+            std::string_view text = block.text;
+            size_t pos = block.ends.empty() ? 0 : block.ends.back();
+            size_t scan = std::max(pos, from);
+            for (;;) {
+                auto i = find_line_break(text.substr(scan));
+                if (i == npos)
+                    break;
+                size_t eol = scan + i;
+                if (text[eol] != '\r')
+                    pos = eol + 1;
+                else if (eol + 1 < text.size())
+                    pos = eol + (text[eol + 1] == '\n' ? 2 : 1);
+                else if (last)
+                    pos = eol + 1;
+                else
+                    break;
+                block.ends.push_back(pos);
+                scan = pos;
+            }
+            if (last && pos < text.size())
+                block.ends.push_back(text.size());
+        }
+
+        // Decodes each line in the block and passes it to emit(), stopping
+        // early if the stop flag is set
+
+        template <typename F>
+        void decode_lines(const LineBlock& block, uint32_t flags, const Ustring& enc, const std::atomic<bool>& stop, F emit) {
+            constexpr uint32_t strip_flags = IO::lf | IO::crlf | IO::striplf | IO::striptws | IO::stripws;
+            bool utf8 = ascii_lowercase(enc) == "utf-8";
+            MbcsConverter conv(enc, flags & (Utf::replace | Utf::throws));
+            std::string raw;
+            Ustring line;
+            size_t start = 0;
+            for (size_t k = 0; k < block.ends.size() && ! stop; ++k) {
+                std::string_view text(block.text.data() + start, block.ends[k] - start);
+                start = block.ends[k];
+                if (flags & strip_flags) {
+                    if (text.size() >= 2 && text.substr(text.size() - 2) == "\r\n")
+                        text.remove_suffix(2);
+                    else if (! text.empty() && (text.back() == '\n' || text.back() == '\f' || text.back() == '\r'))
+                        text.remove_suffix(1);
+                }
+                if (utf8 && UnicornDetail::utf8_validate(text.data(), text.size()) == npos) {
+                    line.assign(text);
+                } else {
+                    raw.assign(text);
+                    conv.import_string(raw, line);
+                }
+                bool first = block.first_line == 1 && k == 0;
+                fix_line(line, first ? flags : flags & ~ IO::bom);
+                if ((flags & IO::notempty) && std::all_of(utf_begin(line), utf_end(line), char_is_line_break))
+                    continue;
+                emit(block.first_line + k, line);
+            }
+        }
+
+        // Reads the file and calls work(block) on a worker thread for each
+        // block, then retire(future) on the calling thread, in file order.
+        // At most two blocks per thread are in flight at once.
+
+        template <typename Work, typename Retire>
+        void parallel_line_blocks(const Path& file, uint32_t flags, size_t threads, std::atomic<bool>& stop,
+                Work work, Retire retire) {
+            check_reader_flags(flags);
+            auto handle = open_reader(file, flags);
+            if (! handle)
+                return;
+            if (threads == 0)
+                threads = std::thread::hardware_concurrency();
+            threads = std::max(threads, size_t(1));
+            using result_type = std::invoke_result_t<Work, LineBlockPtr>;
+            std::deque<std::future<result_type>> tasks;
+            std::string carry;
+            size_t line = 1;
+            bool last = false;
+            try {
+                while (! last) {
+                    auto block = std::make_shared<LineBlock>();
+                    block->text = std::move(carry);
+                    block->first_line = line;
+                    do {
+                        size_t offset = block->text.size();
+                        block->text.resize(offset + parallel_block_size);
+                        auto rc = fread(&block->text[offset], 1, parallel_block_size, handle.get());
+                        auto err = errno;
+                        block->text.resize(offset + rc);
+                        if (ferror(handle.get()))
+                            throw std::system_error(err, std::generic_category(), quote(file.name()));
+                        last = feof(handle.get());
+                        split_lines(*block, offset > 0 ? offset - 1 : 0, last);
+                    } while (block->ends.empty() && ! last);
+                    if (block->ends.empty())
+                        break;
+                    carry.assign(block->text, block->ends.back());
+                    block->text.resize(block->ends.back());
+                    line += block->ends.size();
+                    if (tasks.size() >= 2 * threads) {
+                        retire(tasks.front());
+                        tasks.pop_front();
+                    }
+                    tasks.push_back(std::async(std::launch::async, work, block));
+                }
+                for (; ! tasks.empty(); tasks.pop_front())
+                    retire(tasks.front());
+            }
+            catch (...) {
+                stop = true;
+                throw;
+            }
+        }
+
+        // Background writer for asynchronous output. Each calling thread
+        // appends to one of a fixed set of buffers, chosen by thread ID, so
+        // writers rarely contend and never wait for I/O; a background thread
+        // periodically collects the buffers and writes them in one gathered
+        // call.
+
+        class AsyncFile {
+        public:
+            RS_NO_COPY_MOVE(AsyncFile)
+            AsyncFile(const SharedFile& handle, const Path& file, const std::shared_ptr<std::mutex>& mutex);
+            ~AsyncFile() noexcept;
+            void flush();
+            void write(std::string_view str);
+        private:
+            static constexpr size_t shards = 16;
+            static constexpr size_t batch_size = 0x10000;   // Wake the writer when a buffer reaches this size
+            static constexpr size_t max_size = 0x400000;    // Wait for the writer when a buffer reaches this size
+            static constexpr auto interval = std::chrono::milliseconds(100);
+            struct alignas(64) Shard {
+                std::mutex mutex;
+                std::string buf;
+            };
+            SharedFile handle;
+            Path file;
+            std::shared_ptr<std::mutex> file_mutex;
+            Shard shard[shards];
+            std::mutex mutex;
+            std::condition_variable wake;
+            std::condition_variable done;
+            uint64_t requested = 0;         // Flush requests issued
+            uint64_t completed = 0;         // Flush requests satisfied
+            bool urgent = false;
+            bool closing = false;
+            std::atomic<bool> failed {false};
+            std::exception_ptr error;
+            std::thread thread;
+            void run() noexcept;
+            void write_batch(std::vector<std::string>& batch);
+        };
+
+        AsyncFile::AsyncFile(const SharedFile& handle, const Path& file, const std::shared_ptr<std::mutex>& mutex):
+        handle(handle), file(file), file_mutex(mutex) {
+            thread = std::thread([this] { run(); });
+        }
+
+        AsyncFile::~AsyncFile() noexcept {
+            {
+                auto lock = make_lock(mutex);
+                closing = true;
+                wake.notify_one();
+            }
+            thread.join();
+        }
+
+        void AsyncFile::flush() {
+            auto lock = make_lock(mutex);
+            auto ticket = ++requested;
+            wake.notify_one();
+            done.wait(lock, [&] { return completed >= ticket || error; });
+            if (error)
+                std::rethrow_exception(error);
+        }
+
+        void AsyncFile::write(std::string_view str) {
+            if (failed)
+                flush();
+            auto& sh = shard[std::hash<std::thread::id>()(std::this_thread::get_id()) % shards];
+            size_t n = 0;
+            {
+                auto lock = make_lock(sh.mutex);
+                sh.buf += str;
+                n = sh.buf.size();
+            }
+            if (n >= max_size) {
+                flush();
+            } else if (n >= batch_size && n - str.size() < batch_size) {
+                auto lock = make_lock(mutex);
+                urgent = true;
+                wake.notify_one();
+            }
+        }
+
+        void AsyncFile::run() noexcept {
+            std::vector<std::string> batch(shards);
+            auto lock = make_lock(mutex);
+            for (;;) {
+                wake.wait_for(lock, interval, [&] { return closing || urgent || requested > completed; });
+                auto ticket = requested;
+                bool last = closing;
+                urgent = false;
+                lock.unlock();
+                for (size_t i = 0; i < shards; ++i) {
+                    auto shard_lock = make_lock(shard[i].mutex);
+                    batch[i].swap(shard[i].buf);
+                }
+                std::exception_ptr err;
+                if (! failed) {
+                    try {
+                        write_batch(batch);
+                    }
+                    catch (...) {
+                        err = std::current_exception();
+                    }
+                }
+                for (auto& buf: batch)
+                    buf.clear();
+                lock.lock();
+                if (err) {
+                    error = err;
+                    failed = true;
+                }
+                completed = ticket;
+                done.notify_all();
+                if (last)
+                    break;
+            }
+        }
+
+        void AsyncFile::write_batch(std::vector<std::string>& batch) {
+            std::unique_lock<std::mutex> lock;
+            if (file_mutex)
+                lock = make_lock(*file_mutex);
+            FILE* f = handle.get();
+            #ifdef _XOPEN_SOURCE
+                std::vector<iovec> iov;
+                for (auto& buf: batch)
+                    if (! buf.empty())
+                        iov.push_back({buf.data(), buf.size()});
+                if (iov.empty())
+                    return;
+                if (fflush(f) == EOF) {
+                    int err = errno;
+                    throw std::system_error(err, std::generic_category(), quote(file.name()));
+                }
+                int fd = fileno(f);
+                auto i = iov.begin();
+                while (i != iov.end()) {
+                    auto rc = ::writev(fd, &*i, int(iov.end() - i));
+                    if (rc < 0) {
+                        int err = errno;
+                        if (err == EINTR)
+                            continue;
+                        throw std::system_error(err, std::generic_category(), quote(file.name()));
+                    }
+                    size_t n = rc;
+                    for (; i != iov.end() && n >= i->iov_len; ++i)
+                        n -= i->iov_len;
+                    if (i != iov.end()) {
+                        i->iov_base = static_cast<char*>(i->iov_base) + n;
+                        i->iov_len -= n;
+                    }
+                }
+            #else
+                for (auto& buf: batch)
+                    if (! buf.empty())
+                        fwrite(buf.data(), 1, buf.size(), f);
+                int err = errno;
+                if (ferror(f) || fflush(f) == EOF)
+                    throw std::system_error(err, std::generic_category(), quote(file.name()));
+            #endif
+        }
+
     }
 
     // Class FileReader
@@ -45,24 +493,38 @@ namespace RS::Unicorn {
     struct FileReader::impl_type {
         Ustring line8;
         std::string rdbuf;
+        size_t rdpos = 0;           // Start of unread data in rdbuf
+        size_t read_size = FileReader::default_read_size;
         Path file;
         uint32_t flags;
         Ustring enc;
         Ustring eol;
         SharedFile handle;
+        MappedFile map;
+        std::string_view unread;    // Unread part of the mapped file
+        std::string_view view;      // Current line
+        bool copied = true;         // Current line has been copied into line8
+        bool utf8 = false;
         size_t lines;
         bool is_ready() noexcept { return handle.get() && ! ferror(handle.get()) && ! feof(handle.get()); }
     };
 
-    const Ustring& FileReader::operator*() const noexcept {
+    const Ustring& FileReader::operator*() const {
         static const Ustring dummy;
-        return impl ? impl->line8 : dummy;
+        if (! impl)
+            return dummy;
+        if (! impl->copied) {
+            impl->line8.assign(impl->view);
+            impl->view = impl->line8;
+            impl->copied = true;
+        }
+        return impl->line8;
     }
 
     FileReader& FileReader::operator++() {
         do getline();
             while (impl && (impl->flags & IO::notempty)
-                && std::all_of(utf_begin(impl->line8), utf_end(impl->line8), char_is_line_break));
+                && std::all_of(utf_begin(impl->view), utf_end(impl->view), char_is_line_break));
         return *this;
     }
 
@@ -70,12 +532,23 @@ namespace RS::Unicorn {
         return impl ? impl->lines : size_t(0);
     }
 
+    std::string_view FileReader::view() const noexcept {
+        return impl ? impl->view : std::string_view();
+    }
+
+    size_t FileReader::read_size() const noexcept {
+        return impl ? impl->read_size : default_read_size;
+    }
+
+    void FileReader::set_read_size(size_t n) noexcept {
+        if (impl)
+            impl->read_size = n ? n : default_read_size;
+    }
+
     void FileReader::init(const Path& file, uint32_t flags, const Ustring& enc, const Ustring& eol) {
         static constexpr NC dash[] = {NC('-'), NC(0)};
         static constexpr NC rb[] = {NC('r'), NC('b'), NC(0)};
-        if (popcount(flags & (Utf::replace | Utf::throws)) > 1
-                || popcount(flags & (IO::crlf | IO::lf | IO::striplf | IO::striptws | IO::stripws)) > 1)
-            throw std::invalid_argument("Inconsistent file I/O flags");
+        check_reader_flags(flags);
         impl = std::make_shared<impl_type>();
         impl->file = file;
         impl->flags = flags;
@@ -84,64 +557,133 @@ namespace RS::Unicorn {
         impl->lines = 0;
         if (enc.empty() || enc == "0")
             impl->enc = "utf-8";
+        impl->utf8 = ascii_lowercase(impl->enc) == "utf-8";
         if ((flags & IO::standin) && (file.empty() || file.os_view() == dash))
             impl->handle.reset(stdin, null_delete);
+        else if ((flags & IO::mmap) && ! (flags & (IO::crlf | IO::lf | IO::striptws | IO::stripws))
+                && impl->utf8 && impl->map.open(file))
+            impl->unread = impl->map.view();
         else
             impl->handle = shared_fopen(file, rb, ! (flags & IO::pretend));
         ++*this;
     }
 
     void FileReader::fixline() {
-        if (impl->flags & IO::bom) {
-            if (str_first_char(impl->line8) == byte_order_mark)
-                impl->line8.erase(0, utf_begin(impl->line8).count());
-            impl->flags &= ~ IO::bom;
-        }
-        if (impl->flags & IO::lf)
-            impl->line8 += '\n';
-        else if (impl->flags & IO::crlf)
-            impl->line8 += "\r\n";
-        else if (impl->flags & IO::striptws)
-            impl->line8 = str_trim_right(impl->line8);
-        else if (impl->flags & IO::stripws)
-            impl->line8 = str_trim(impl->line8);
+        fix_line(impl->line8, impl->flags);
+        impl->flags &= ~ IO::bom;
     }
 
     void FileReader::getline() {
         if (! impl)
             return;
+        if (impl->map) {
+            getmapped();
+            return;
+        }
         impl->line8.clear();
-        size_t eolpos = npos, eolbytes = 0, eolsize = impl->eol.size();
+        impl->view = {};
+        // Lines are located in place; the consumed part of the buffer is only
+        // discarded when more data is needed, and the search resumes where
+        // it left off
+        auto& buf = impl->rdbuf;
+        size_t start = impl->rdpos, scan = start, eolpos = npos, eolbytes = 0, eolsize = impl->eol.size();
         for (;;) {
-            if (eolsize) {
-                if (eolpos == npos)
-                    eolpos = impl->rdbuf.find(impl->eol);
-                if (eolpos != npos && (eolpos + eolsize < impl->rdbuf.size() || ! impl->is_ready()))
-                    eolbytes = eolsize;
-            } else {
-                if (eolpos == npos)
-                    eolpos = impl->rdbuf.find_first_of("\n\f\r");
-                if (eolpos != npos) {
-                    if (impl->rdbuf[eolpos] != '\r')
-                        eolbytes = 1;
-                    else if (impl->rdbuf.size() - eolpos >= 2 || ! impl->is_ready())
-                        eolbytes = impl->rdbuf[eolpos + 1] == '\n' ? 2 : 1;
+            bool more = impl->is_ready();
+            if (eolpos == npos) {
+                if (eolsize) {
+                    eolpos = buf.find(impl->eol, scan);
+                    if (eolpos == npos)
+                        scan = buf.size() - std::min(buf.size() - start, eolsize - 1);
+                } else {
+                    auto pos = find_line_break(std::string_view(buf).substr(scan));
+                    if (pos == npos)
+                        scan = buf.size();
+                    else
+                        eolpos = scan + pos;
                 }
             }
-            if (eolbytes > 0 || ! impl->is_ready())
+            if (eolpos != npos) {
+                if (eolsize || buf[eolpos] != '\r')
+                    eolbytes = eolsize ? eolsize : 1;
+                else if (eolpos + 1 < buf.size())
+                    eolbytes = buf[eolpos + 1] == '\n' ? 2 : 1;
+                else if (! more)
+                    eolbytes = 1;
+            }
+            if (eolbytes > 0 || ! more)
                 break;
-            getmore(256);
+            if (start > 0) {
+                buf.erase(0, start);
+                scan -= start;
+                if (eolpos != npos)
+                    eolpos -= start;
+                start = 0;
+            }
+            getmore(impl->read_size);
         }
-        if (impl->rdbuf.empty()) {
+        if (start == buf.size()) {
             impl.reset();
             return;
         }
-        std::string encoded(impl->rdbuf, 0, eolpos + eolbytes);
-        impl->rdbuf.erase(0, eolpos + eolbytes);
+        if (eolpos == npos)
+            eolpos = buf.size();
+        impl->rdpos = eolpos + eolbytes;
+        std::string_view encoded(buf.data() + start, impl->rdpos - start);
         if (impl->flags & (IO::lf | IO::crlf | IO::striplf | IO::striptws | IO::stripws))
-            encoded.resize(eolpos);
-        import_string(encoded, impl->line8, impl->enc, impl->flags & (Utf::replace | Utf::throws));
-        fixline();
+            encoded = encoded.substr(0, eolpos - start);
+        if (impl->utf8 && ! (impl->flags & (IO::bom | IO::lf | IO::crlf | IO::striptws | IO::stripws))
+                && UnicornDetail::utf8_validate(encoded.data(), encoded.size()) == npos) {
+            impl->view = encoded;
+            impl->copied = false;
+        } else {
+            import_string(std::string(encoded), impl->line8, impl->enc, impl->flags & (Utf::replace | Utf::throws));
+            fixline();
+            impl->view = impl->line8;
+            impl->copied = true;
+        }
+        ++impl->lines;
+    }
+
+    void FileReader::getmapped() {
+        // Lines are returned as views into the mapped file; only lines
+        // containing invalid UTF-8 need to be copied
+        auto& in = impl->unread;
+        if (in.empty()) {
+            impl.reset();
+            return;
+        }
+        size_t eolpos, eolbytes = 0;
+        if (impl->eol.empty()) {
+            eolpos = find_line_break(in);
+            if (eolpos != npos)
+                eolbytes = in[eolpos] == '\r' && eolpos + 1 < in.size() && in[eolpos + 1] == '\n' ? 2 : 1;
+        } else {
+            eolpos = in.find(impl->eol);
+            if (eolpos != npos)
+                eolbytes = impl->eol.size();
+        }
+        if (eolpos == npos)
+            eolpos = in.size();
+        auto line = in.substr(0, eolpos + eolbytes);
+        in.remove_prefix(line.size());
+        if (impl->flags & IO::striplf)
+            line = line.substr(0, eolpos);
+        // The BOM is stripped from the first line rather than the file, so
+        // a file containing only a BOM still yields one empty line
+        if (impl->flags & IO::bom) {
+            if (line.substr(0, 3) == utf8_bom)
+                line.remove_prefix(3);
+            impl->flags &= ~ IO::bom;
+        }
+        if (UnicornDetail::utf8_validate(line.data(), line.size()) == npos) {
+            impl->view = line;
+            impl->copied = false;
+        } else {
+            impl->line8.clear();
+            import_string(std::string(line), impl->line8, impl->enc, impl->flags & (Utf::replace | Utf::throws));
+            impl->view = impl->line8;
+            impl->copied = true;
+        }
         ++impl->lines;
     }
 
@@ -157,6 +699,56 @@ namespace RS::Unicorn {
             throw std::system_error(err, std::generic_category(), quote(impl->file.name()));
     }
 
+    // Parallel line processing
+
+    void process_lines(const Path& file, uint32_t flags, const LineFunction& fn, size_t threads) {
+        process_lines(file, flags, "utf-8"s, fn, threads);
+    }
+
+    void process_lines(const Path& file, uint32_t flags, const Ustring& enc, const LineFunction& fn, size_t threads) {
+        Ustring encoding = enc.empty() || enc == "0" ? "utf-8"s : enc;
+        std::atomic<bool> stop(false);
+        parallel_line_blocks(file, flags, threads, stop,
+            [&] (LineBlockPtr block) {
+                try {
+                    decode_lines(*block, flags, encoding, stop, fn);
+                }
+                catch (...) {
+                    stop = true;
+                    throw;
+                }
+            },
+            [] (std::future<void>& task) { task.get(); });
+    }
+
+    void process_lines(const Path& file, uint32_t flags, const LineTransform& fn, const LineFunction& out, size_t threads) {
+        process_lines(file, flags, "utf-8"s, fn, out, threads);
+    }
+
+    void process_lines(const Path& file, uint32_t flags, const Ustring& enc, const LineTransform& fn, const LineFunction& out,
+            size_t threads) {
+        using results_type = std::vector<std::pair<size_t, Ustring>>;
+        Ustring encoding = enc.empty() || enc == "0" ? "utf-8"s : enc;
+        std::atomic<bool> stop(false);
+        parallel_line_blocks(file, flags, threads, stop,
+            [&] (LineBlockPtr block) {
+                results_type results;
+                try {
+                    decode_lines(*block, flags, encoding, stop,
+                        [&] (size_t line, const Ustring& text) { results.push_back({line, fn(line, text)}); });
+                }
+                catch (...) {
+                    stop = true;
+                    throw;
+                }
+                return results;
+            },
+            [&] (std::future<results_type>& task) {
+                for (auto& [line, text]: task.get())
+                    out(line, text);
+            });
+    }
+
     // Class FileWriter
 
     struct FileWriter::impl_type {
@@ -166,12 +758,15 @@ namespace RS::Unicorn {
         Ustring enc;
         SharedFile handle;
         std::shared_ptr<std::mutex> mutex;
+        std::unique_ptr<AsyncFile> async;
     };
 
     void FileWriter::flush() {
         if (! impl)
             throw std::system_error(std::make_error_code(std::errc::bad_file_descriptor));
-        if (fflush(impl->handle.get()) == EOF) {
+        if (impl->async)
+            impl->async->flush();
+        else if (fflush(impl->handle.get()) == EOF) {
             int err = errno;
             throw std::system_error(err, std::generic_category(), quote(impl->file.name()));
         }
@@ -187,7 +782,7 @@ namespace RS::Unicorn {
                 || popcount(flags & (IO::append | IO::protect)) > 1
                 || popcount(flags & (IO::autoline | IO::writeline)) > 1
                 || popcount(flags & (IO::crlf | IO::lf)) > 1
-                || popcount(flags & (IO::linebuf | IO::unbuf)) > 1
+                || popcount(flags & (IO::async | IO::linebuf | IO::unbuf)) > 1
                 || popcount(flags & (IO::standerr | IO::standout)) > 1)
             throw std::invalid_argument("Inconsistent file I/O flags");
         impl = std::make_shared<impl_type>();
@@ -212,6 +807,15 @@ namespace RS::Unicorn {
             else
                 impl->mutex = std::make_shared<std::mutex>();
         }
+        if (flags & IO::async) {
+            impl->async = std::make_unique<AsyncFile>(impl->handle, file, impl->mutex);
+            if (flags & IO::bom) {
+                std::string encoded;
+                export_string(utf8_bom, encoded, impl->enc, flags & (Utf::replace | Utf::throws));
+                impl->async->write(encoded);
+                impl->flags &= ~ IO::bom;
+            }
+        }
     }
 
     void FileWriter::fix_text(Ustring& str) const {
@@ -262,7 +866,9 @@ namespace RS::Unicorn {
             }
             std::string encoded;
             export_string(str, encoded, impl->enc, impl->flags & (Utf::replace | Utf::throws));
-            if (impl->mutex) {
+            if (impl->async) {
+                impl->async->write(encoded);
+            } else if (impl->mutex) {
                 auto lock = make_lock(*impl->mutex);
                 write_mbcs(encoded);
             } else {
@@ -4,8 +4,10 @@
 #include "unicorn/path.hpp"
 #include "unicorn/utf.hpp"
 #include "unicorn/utility.hpp"
+#include <functional>
 #include <memory>
 #include <string>
+#include <string_view>
 
 namespace RS::Unicorn {
 
@@ -29,10 +31,12 @@ namespace RS::Unicorn {
         static constexpr uint32_t striplf    = setbit<9>;   // Strip line breaks
         static constexpr uint32_t striptws   = setbit<10>;  // Strip trailing whitespace
         static constexpr uint32_t stripws    = setbit<11>;  // Strip whitespace
+        static constexpr uint32_t mmap       = setbit<21>;  // Memory map the file if possible
 
         // Writer flags
 
         static constexpr uint32_t append     = setbit<12>;  // Append to file
+        static constexpr uint32_t async      = setbit<22>;  // Write from a background thread
         static constexpr uint32_t autoline   = setbit<13>;  // Write LF if not already there
         static constexpr uint32_t linebuf    = setbit<14>;  // Line buffered output
         static constexpr uint32_t mutex      = setbit<15>;  // Hold per-file mutex while writing
@@ -49,6 +53,7 @@ namespace RS::Unicorn {
     class FileReader:
     public InputIterator<FileReader, Ustring> {
     public:
+        static constexpr size_t default_read_size = 65536;
         FileReader() {}
         explicit FileReader(const Path& file) { init(file, {}, {}, {}); }
         FileReader(const Path& file, uint32_t flags) { init(file, flags, {}, {}); }
@@ -56,16 +61,20 @@ namespace RS::Unicorn {
         FileReader(const Path& file, uint32_t flags, uint32_t enc) { init(file, flags, std::to_string(enc), {}); }
         FileReader(const Path& file, uint32_t flags, const Ustring& enc, const Ustring& eol) { init(file, flags, enc, eol); }
         FileReader(const Path& file, uint32_t flags, uint32_t enc, const Ustring& eol) { init(file, flags, std::to_string(enc), eol); }
-        const Ustring& operator*() const noexcept;
+        const Ustring& operator*() const;
         FileReader& operator++();
         friend bool operator==(const FileReader& lhs, const FileReader& rhs) noexcept { return lhs.impl == rhs.impl; }
         size_t line() const noexcept;
+        std::string_view view() const noexcept;
+        size_t read_size() const noexcept;
+        void set_read_size(size_t n) noexcept;
     private:
         struct impl_type;
         std::shared_ptr<impl_type> impl;
         void init(const Path& file, uint32_t flags, const Ustring& enc, const Ustring& eol);
         void fixline();
         void getline();
+        void getmapped();
         void getmore(size_t n);
     };
 
@@ -75,6 +84,17 @@ namespace RS::Unicorn {
     inline Irange<FileReader> read_lines(const Path& file, uint32_t flags, const Ustring& enc, const Ustring& eol) { return {{file, flags, enc, eol}, {}}; }
     inline Irange<FileReader> read_lines(const Path& file, uint32_t flags, uint32_t enc, const Ustring& eol) { return {{file, flags, enc, eol}, {}}; }
 
+    // Parallel line processing
+
+    using LineFunction = std::function<void(size_t, const Ustring&)>;
+    using LineTransform = std::function<Ustring(size_t, const Ustring&)>;
+
+    void process_lines(const Path& file, uint32_t flags, const LineFunction& fn, size_t threads = 0);
+    void process_lines(const Path& file, uint32_t flags, const Ustring& enc, const LineFunction& fn, size_t threads = 0);
+    void process_lines(const Path& file, uint32_t flags, const LineTransform& fn, const LineFunction& out, size_t threads = 0);
+    void process_lines(const Path& file, uint32_t flags, const Ustring& enc, const LineTransform& fn, const LineFunction& out,
+        size_t threads = 0);
+
     // File output iterator
 
     class FileWriter:
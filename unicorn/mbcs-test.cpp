@@ -1,9 +1,11 @@
 #include "unicorn/mbcs.hpp"
 #include "unicorn/unit-test.hpp"
 #include "unicorn/utf.hpp"
+#include <algorithm>
 #include <cerrno>
 #include <iostream>
 #include <string>
+#include <vector>
 
 #ifdef _WIN32
     #include <windows.h>
@@ -64,6 +66,89 @@ void test_unicorn_mbcs_utf_detection() {
 
 }
 
+void test_unicorn_mbcs_encoding_detection() {
+
+    const Ustring french = "Le cœur a ses raisons que la raison ne connaît point. Où êtes-vous, mère ? À bientôt, élève !";
+    const Ustring german = "Größere Übungen fördern die Qualität, während Äpfel süß schmecken.";
+    const Ustring polish = "Zażółć gęślą jaźń. Pchnąć w tę łódź jeża lub ośm skrzyń fig.";
+    const Ustring russian = "Съешь же ещё этих мягких французских булок, да выпей чаю. Привет, мир!";
+    const Ustring greek = "Ξεσκεπάζω την ψυχοφθόρα βδελυγμία. Καλημέρα κόσμε!";
+    const Ustring japanese = "いろはにほへと ちりぬるを、わかよたれそ つねならむ。日本語のテキストです。";
+    const Ustring chinese = "我能吞下玻璃而不伤身体。中华人民共和国成立于一九四九年。";
+    const Ustring korean = "다람쥐 헌 쳇바퀴에 타고파. 안녕하세요, 세계 여러분!";
+    const Ustring taiwanese = "我能吞下玻璃而不傷身體。中華民國的首都是臺北。";
+
+    std::vector<EncodingGuess> guesses;
+    std::string s;
+
+    auto top = [&] (const std::string& sample) -> Ustring {
+        guesses = detect_encoding(sample);
+        return guesses.empty() ? Ustring() : guesses[0].encoding;
+    };
+
+    TEST_EQUAL(top(""), "utf-8");
+    TEST_EQUAL(top("Hello world"), "utf-8");
+    TEST_EQUAL(guesses.size(), 1u);
+    TEST_EQUAL(guesses[0].confidence, 1);
+    TEST_EQUAL(top("\xef\xbb\xbfHello"), "utf-8");
+    TEST_EQUAL(top("\xff\xfe\x00\x00\x41\x00\x00\x00"s), "utf-32le");
+    TEST_EQUAL(top("\xff\xfeH\x00i\x00"s), "utf-16le");
+    TEST_EQUAL(top(french), "utf-8");
+    TEST_EQUAL(top(russian), "utf-8");
+    TEST_EQUAL(top(japanese), "utf-8");
+    TEST_COMPARE(guesses[0].confidence, >, 0.9);
+    for (size_t i = 1; i < guesses.size(); ++i)
+        TEST_COMPARE(guesses[i].confidence, <=, guesses[i - 1].confidence);
+
+    // A character cut off at the end of the sample is not an error if the
+    // sample was truncated, but complete text must be valid
+    guesses = detect_encoding(french, french.find("ê") + 1);
+    TEST(! guesses.empty());
+    TEST_EQUAL(guesses[0].encoding, "utf-8");
+    TEST_COMPARE(top(french.substr(0, french.find("ê") + 1)), !=, "utf-8");
+    for (auto& latin1: {"caf\xe9"s, "Stra\xdf"s, "Hello world, ni\xf1"s}) {
+        TEST_EQUAL(top(latin1), "windows-1252");
+        TEST(std::none_of(guesses.begin(), guesses.end(), [] (auto& g) { return g.encoding == "utf-8"; }));
+        TEST_THROW(import_string(latin1, s, "utf-8", Utf::throws), EncodingError);
+        TRY(import_string(latin1, s, guesses[0].encoding, Utf::throws));
+    }
+
+    TRY(export_string(french, s, "utf-16le"));   TEST_EQUAL(top(s), "utf-16le");
+    TRY(export_string(french, s, "utf-16be"));   TEST_EQUAL(top(s), "utf-16be");
+    TRY(export_string(russian, s, "utf-32le"));  TEST_EQUAL(top(s), "utf-32le");
+    TRY(export_string(russian, s, "utf-32be"));  TEST_EQUAL(top(s), "utf-32be");
+
+    TRY(export_string(french, s, "windows-1252"));  TEST_EQUAL(top(s), "windows-1252");
+    TEST_COMPARE(guesses[0].confidence, >, 0.5);
+    TRY(export_string(german, s, "iso-8859-1"));    TEST_EQUAL(top(s), "windows-1252");
+    TRY(export_string(polish, s, "iso-8859-2"));    TEST_EQUAL(top(s), "iso-8859-2");
+    TRY(export_string(polish, s, "windows-1250"));  TEST_EQUAL(top(s), "windows-1250");
+    TRY(export_string(russian, s, "windows-1251"));  TEST_EQUAL(top(s), "windows-1251");
+    TRY(export_string(russian, s, "koi8-r"));       TEST_EQUAL(top(s), "koi8-r");
+    TRY(export_string(russian, s, "iso-8859-5"));   TEST_EQUAL(top(s), "iso-8859-5");
+    TRY(export_string(greek, s, "windows-1253"));   TEST_EQUAL(top(s), "windows-1253");
+
+    TRY(export_string(japanese, s, "shift_jis"));  TEST_EQUAL(top(s), "shift_jis");
+    TRY(export_string(japanese, s, "euc-jp"));     TEST_EQUAL(top(s), "euc-jp");
+    TRY(export_string(chinese, s, "gb18030"));     TEST_EQUAL(top(s), "gb18030");
+    TRY(export_string(korean, s, "euc-kr"));       TEST_EQUAL(top(s), "euc-kr");
+    TRY(export_string(taiwanese, s, "big5"));      TEST_EQUAL(top(s), "big5");
+
+    for (auto& g: guesses) {
+        TEST_COMPARE(g.confidence, >, 0);
+        TEST_COMPARE(g.confidence, <=, 1);
+        TRY(lookup_encoding(g.encoding));
+    }
+
+    // Only the prefix is examined
+    s = std::string(100, 'x') + "\xe9t\xe9 ";
+    TEST_EQUAL(top(s), "windows-1252");
+    guesses = detect_encoding(s, 100);
+    TEST_EQUAL(guesses.size(), 1u);
+    TEST_EQUAL(guesses[0].encoding, "utf-8");
+
+}
+
 void test_unicorn_mbcs_encoding_queries() {
 
     #ifdef _XOPEN_SOURCE
@@ -172,6 +257,226 @@ void test_unicorn_mbcs_from_unicode() {
 
 }
 
+void test_unicorn_mbcs_builtin_charsets() {
+
+    std::string s;
+    Ustring s8;
+
+    #ifdef _XOPEN_SOURCE
+        TEST_EQUAL(lookup_encoding("Latin1"), "iso-8859-1");
+        TEST_EQUAL(lookup_encoding("cp1252"), "windows-1252");
+        TEST_EQUAL(lookup_encoding(1251), "windows-1251");
+        TEST_EQUAL(lookup_encoding("KOI8R"), "koi8-r");
+        TEST_EQUAL(lookup_encoding("IBM437"), "ibm437");
+        TEST_EQUAL(lookup_encoding("latin10"), "iso-8859-16");
+    #else
+        TEST_EQUAL(lookup_encoding("Latin1"), 28591);
+        TEST_EQUAL(lookup_encoding("cp1252"), 1252);
+        TEST_EQUAL(lookup_encoding(1251), 1251);
+        TEST_EQUAL(lookup_encoding("KOI8R"), 20866);
+        TEST_EQUAL(lookup_encoding("IBM437"), 437);
+    #endif
+
+    TRY(import_string("caf\xe9 \x80 \xa4", s8, "windows-1252"));      TEST_EQUAL(s8, "café € ¤");
+    TRY(import_string("caf\xe9 \x80 \xa4", s8, "iso-8859-1"));        TEST_EQUAL(s8, "café \u0080 ¤");
+    TRY(import_string("caf\xe9 \x80 \xa4", s8, "iso-8859-15"));       TEST_EQUAL(s8, "café \u0080 €");
+    TRY(import_string("\xf0\xd2\xc9\xd7\xc5\xd4", s8, "koi8-r"));      TEST_EQUAL(s8, "Привет");
+    TRY(import_string("\xcf\xf0\xe8\xe2\xe5\xf2", s8, 1251));          TEST_EQUAL(s8, "Привет");
+    TRY(import_string("\xc9\xcd\xbb \xe0\xe1", s8, "ibm437"));         TEST_EQUAL(s8, "╔═╗ αß");
+    TRY(import_string("\xe1\xe2\xe3", s8, "iso-8859-7"));               TEST_EQUAL(s8, "αβγ");
+
+    TRY(export_string("café € ¤", s, "windows-1252"));       TEST_EQUAL(s, "caf\xe9 \x80 \xa4");
+    TRY(export_string("Привет", s, "koi8-r"));               TEST_EQUAL(s, "\xf0\xd2\xc9\xd7\xc5\xd4");
+    TRY(export_string("╔═╗ αß", s, 437));                    TEST_EQUAL(s, "\xc9\xcd\xbb \xe0\xe1");
+    TRY(export_string("café € ¤ 𝛑", s, "iso-8859-1"));       TEST_EQUAL(s, "caf\xe9 ? \xa4 ?");
+    TRY(export_string("a\xff" "b", s, "iso-8859-1"));           TEST_EQUAL(s, "a?b");
+
+    TRY(import_string("a\x81z", s8, "windows-1252"));  TEST_EQUAL(s8, "a\ufffdz");
+    TEST_THROW_EQUAL(import_string("a\x81z", s8, "windows-1252", Utf::throws),
+        EncodingError, "Encoding error (windows-1252); offset 1; hex 81");
+    TEST_THROW_EQUAL(export_string("café €", s, "iso-8859-1", Utf::throws),
+        EncodingError, "Encoding error (iso-8859-1); offset 6; hex e2 82 ac");
+    TEST_THROW(export_string("a\xff" "b", s, "iso-8859-1", Utf::throws), EncodingError);
+
+    // Every assigned byte round trips
+    static const Strings charsets {
+        "iso-8859-1", "iso-8859-2", "iso-8859-3", "iso-8859-4", "iso-8859-5", "iso-8859-6", "iso-8859-7",
+        "iso-8859-8", "iso-8859-9", "iso-8859-13", "iso-8859-15", "windows-1250", "windows-1251",
+        "windows-1252", "windows-1253", "windows-1254", "windows-1255", "windows-1256", "windows-1257",
+        "windows-1258", "koi8-r", "koi8-u", "ibm437",
+    };
+    std::string all;
+    for (int i = 0; i < 256; ++i)
+        all += char(i);
+    for (auto& cs: charsets) {
+        TRY(import_string(all, s8, cs));
+        TRY(export_string(s8, s, cs));
+        TEST_EQUAL(s.size(), 256u);
+        size_t mismatch = 0;
+        for (size_t i = 0; i < s.size(); ++i)
+            if (s[i] != all[i] && s[i] != '?')
+                ++mismatch;
+        TEST_EQUAL(mismatch, 0u);
+    }
+
+}
+
+void test_unicorn_mbcs_converters() {
+
+    std::string s;
+    Ustring s8;
+
+    {
+        MbcsConverter conv("windows-1252");
+        for (int i = 0; i < 3; ++i) {
+            TRY(conv.import_string(euro_windows1252, s8));  TEST_EQUAL(s8, euro_utf8);
+            TRY(conv.export_string(euro_utf8, s));          TEST_EQUAL(s, euro_windows1252);
+        }
+        TRY(conv.import_string({}, s8));  TEST_EQUAL(s8, "");
+    }
+
+    {
+        MbcsConverter conv(54936, Utf::throws);
+        TRY(conv.import_string(euro_gb18030, s8));  TEST_EQUAL(s8, euro_utf8);
+        TRY(conv.export_string(euro_utf8, s));      TEST_EQUAL(s, euro_gb18030);
+        TRY(conv.import_string(euro_gb18030, s8));  TEST_EQUAL(s8, euro_utf8);
+    }
+
+    {
+        MbcsConverter conv("utf-16le");
+        TRY(conv.import_string(euro_utf16le, s8));  TEST_EQUAL(s8, euro_utf8);
+        TRY(conv.export_string(euro_utf8, s));      TEST_EQUAL(s, euro_utf16le);
+    }
+
+    {
+        MbcsConverter conv("utf");
+        TRY(conv.import_string(euro_utf16be, s8));  TEST_EQUAL(s8, euro_utf8);
+        TRY(conv.import_string(euro_utf32le, s8));  TEST_EQUAL(s8, euro_utf8);
+    }
+
+    #ifdef _XOPEN_SOURCE
+        {
+            // The converter must recover its state after an error
+            MbcsConverter conv("ascii", Utf::throws);
+            TEST_THROW(conv.export_string(euro_utf8, s), EncodingError);
+            TRY(conv.export_string("uro", s));  TEST_EQUAL(s, "uro");
+            TEST_THROW(conv.export_string(euro_utf8, s), EncodingError);
+        }
+    #endif
+
+    {
+        MbcsConverter conv1("gb18030");
+        MbcsConverter conv2(std::move(conv1));
+        TRY(conv2.import_string(euro_gb18030, s8));  TEST_EQUAL(s8, euro_utf8);
+        conv1 = std::move(conv2);
+        TRY(conv1.export_string(euro_utf8, s));  TEST_EQUAL(s, euro_gb18030);
+    }
+
+    TEST_THROW(MbcsConverter("no such encoding"), UnknownEncoding);
+    TEST_THROW(MbcsConverter("utf-8", Utf::ignore), std::invalid_argument);
+
+    // More encodings than the per-thread descriptor cache holds
+    static const Strings encodings {"ascii", "windows-1252", "iso-8859-1", "iso-8859-2", "iso-8859-5",
+        "iso-8859-7", "iso-8859-15", "koi8-r", "macintosh", "ibm437", "ibm850", "gb18030"};
+    for (int i = 0; i < 3; ++i) {
+        for (auto& enc: encodings) {
+            TRY(export_string("Hello", s, enc));
+            TRY(import_string(s, s8, enc));
+            TEST_EQUAL(s8, "Hello");
+        }
+        TRY(import_string(euro_windows1252, s8, "windows-1252"));  TEST_EQUAL(s8, euro_utf8);
+    }
+
+}
+
+void test_unicorn_mbcs_streaming() {
+
+    static const Strings encodings {"utf-8", "utf-16le", "utf-16be", "utf-32le", "windows-1252", "gb18030", "shift_jis", "euc-jp"};
+    const Ustring text = "Hello €uro ÀÉÎ 日本語テキスト 𝛑 world";
+    std::string encoded, s;
+    Ustring s8;
+
+    for (auto& enc: encodings) {
+        Ustring source = enc == "windows-1252" ? "Hello €uro ÀÉÎ world" : enc.substr(0, 3) == "utf" || enc == "gb18030" ? text : "Hello 日本語テキスト world";
+        TRY(export_string(source, encoded, enc));
+        for (size_t chunk: {1, 2, 3, 5, 64}) {
+            MbcsDecoder dec(enc);
+            s8.clear();
+            for (size_t i = 0; i < encoded.size(); i += chunk)
+                TRY(dec.feed(std::string_view(encoded).substr(i, chunk), s8));
+            TRY(dec.finish(s8));
+            TEST_EQUAL(s8, source);
+            TEST_EQUAL(dec.pending(), 0u);
+            MbcsEncoder enc_(enc);
+            s.clear();
+            for (size_t i = 0; i < source.size(); i += chunk)
+                TRY(enc_.feed(std::string_view(source).substr(i, chunk), s));
+            TRY(enc_.finish(s));
+            TEST_EQUAL(s, encoded);
+        }
+    }
+
+    {
+        MbcsDecoder dec("gb18030");
+        s8.clear();
+        TRY(dec.feed("\xa2", s8));     TEST_EQUAL(s8, "");     TEST_EQUAL(dec.pending(), 1u);
+        TRY(dec.feed("\xe3uro", s8));  TEST_EQUAL(s8, "€uro");  TEST_EQUAL(dec.pending(), 0u);
+        TRY(dec.feed("\xa2", s8));
+        TRY(dec.finish(s8));          TEST_EQUAL(s8, "€uro\ufffd");
+        TRY(dec.feed("\xa2\xe3", s8));  TEST_EQUAL(s8, "€uro\ufffd€");
+    }
+
+    {
+        MbcsDecoder dec("utf-16le", Utf::throws);
+        s8.clear();
+        TRY(dec.feed("\x3d\xd8", s8));  TEST_EQUAL(dec.pending(), 2u);
+        TRY(dec.feed("\x11", s8));     TEST_EQUAL(dec.pending(), 3u);
+        TRY(dec.feed("\xdf", s8));     TEST_EQUAL(s8, "\U0001f711");
+        TRY(dec.feed("A", s8));
+        TEST_THROW(dec.finish(s8), EncodingError);
+    }
+
+    {
+        MbcsDecoder dec("utf");
+        s8.clear();
+        TRY(dec.feed(euro_utf16be.substr(0, 3), s8));
+        TRY(dec.feed(euro_utf16be.substr(3), s8));
+        TRY(dec.finish(s8));
+        TEST_EQUAL(s8, euro_utf8);
+    }
+
+    {
+        MbcsEncoder enc("windows-1252", Utf::throws);
+        s.clear();
+        TRY(enc.feed("caf\xc3", s));    TEST_EQUAL(s, "caf");  TEST_EQUAL(enc.pending(), 1u);
+        TRY(enc.feed("\xa9 \xe2\x82", s));  TEST_EQUAL(s, "caf\xe9 ");  TEST_EQUAL(enc.pending(), 2u);
+        TRY(enc.feed("\xac", s));       TEST_EQUAL(s, "caf\xe9 \x80");
+        TRY(enc.feed("\xe2\x82", s));
+        TEST_THROW(enc.finish(s), EncodingError);
+    }
+
+    #ifdef _XOPEN_SOURCE
+        {
+            // Stateful encoding: the final shift sequence is written by finish()
+            Ustring jp = "日本語 text";
+            TRY(export_string(jp, encoded, "iso-2022-jp"));
+            MbcsEncoder enc("iso-2022-jp");
+            s.clear();
+            for (size_t i = 0; i < jp.size(); ++i)
+                TRY(enc.feed(jp.substr(i, 1), s));
+            TRY(enc.finish(s));
+            TEST_EQUAL(s, encoded);
+            MbcsDecoder dec("iso-2022-jp");
+            s8.clear();
+            for (size_t i = 0; i < s.size(); ++i)
+                TRY(dec.feed(std::string_view(s).substr(i, 1), s8));
+            TRY(dec.finish(s8));
+            TEST_EQUAL(s8, jp);
+        }
+    #endif
+
+}
+
 void test_unicorn_mbcs_local_encoding_round_trip() {
 
     std::string s;
@@ -1,8 +1,10 @@
 #include "unicorn/mbcs.hpp"
 #include "unicorn/character.hpp"
 #include "unicorn/iana-character-sets.hpp"
+#include "unicorn/single-byte-charsets.hpp"
 #include "unicorn/string.hpp"
 #include <algorithm>
+#include <array>
 #include <cerrno>
 #include <cstdlib>
 #include <cstring>
@@ -25,8 +27,11 @@ namespace RS::Unicorn {
 
         using UnicornDetail::CharsetInfo;
         using UnicornDetail::EncodingTag;
+        using UnicornDetail::SingleByteCharset;
+        using UnicornDetail::ascii_prefix;
         using UnicornDetail::guess_utf;
         using UnicornDetail::lookup_encoding;
+        using UnicornDetail::single_byte_charsets;
 
         #ifdef _XOPEN_SOURCE
 
@@ -49,6 +54,43 @@ namespace RS::Unicorn {
 
             bool valid_iconv(Ustring tag) { return bool(Iconv(tag, "utf-8"s)); }
 
+            // Opening an iconv descriptor is expensive, so each thread keeps a
+            // small pool of recently used descriptors, keyed by (from, to).
+
+            class IconvPool {
+            public:
+                Iconv* get(const Ustring& from, const Ustring& to);
+            private:
+                static constexpr size_t capacity = 8;
+                struct entry_type {
+                    Ustring from;
+                    Ustring to;
+                    std::unique_ptr<Iconv> conv;
+                };
+                std::vector<entry_type> entries; // Most recently used first
+            };
+
+            Iconv* IconvPool::get(const Ustring& from, const Ustring& to) {
+                auto it = std::find_if(entries.begin(), entries.end(),
+                    [&] (const entry_type& e) { return e.from == from && e.to == to; });
+                if (it == entries.end()) {
+                    auto conv = std::make_unique<Iconv>(from, to);
+                    if (! *conv)
+                        return nullptr;
+                    if (entries.size() >= capacity)
+                        entries.pop_back();
+                    entries.insert(entries.begin(), {from, to, std::move(conv)});
+                } else if (it != entries.begin()) {
+                    std::rotate(entries.begin(), it, it + 1);
+                }
+                return entries.front().conv.get();
+            }
+
+            Iconv* pooled_iconv(const Ustring& from, const Ustring& to) {
+                thread_local IconvPool pool;
+                return pool.get(from, to);
+            }
+
         #else
 
             constexpr uint32_t utf8_tag       = 65001;
@@ -148,6 +190,174 @@ namespace RS::Unicorn {
             }
         }
 
+        // Built-in codecs for single byte character sets. These are used in
+        // preference to the native API: they are faster, and give the same
+        // results everywhere. Windows has no code page numbers for some of
+        // the ISO 8859 sets, so those are only available on Unix.
+
+        const SingleByteCharset* builtin_charset(const CharsetInfo* csp, uint32_t page) {
+            for (auto& sbc: UnicornDetail::single_byte_charsets) {
+                #ifndef _XOPEN_SOURCE
+                    if (sbc.page == 0)
+                        continue;
+                #endif
+                if (page != 0 && page == sbc.page)
+                    return &sbc;
+                if (csp) {
+                    size_t len = strlen(sbc.name);
+                    if (strncmp(csp->names, sbc.name, len) == 0 && (csp->names[len] == ',' || csp->names[len] == 0))
+                        return &sbc;
+                }
+            }
+            return nullptr;
+        }
+
+        const SingleByteCharset* builtin_charset(const EncodingTag& tag) {
+            for (auto& sbc: UnicornDetail::single_byte_charsets)
+                #ifdef _XOPEN_SOURCE
+                    if (tag == sbc.name)
+                #else
+                    if (sbc.page != 0 && tag == sbc.page)
+                #endif
+                        return &sbc;
+            return nullptr;
+        }
+
+        // Reverse lookup for encoding: the high byte of the code point
+        // indexes a list of 256 byte blocks, of which block zero is empty.
+
+        class SingleByteEncoder {
+        public:
+            explicit SingleByteEncoder(const SingleByteCharset& sbc);
+            uint8_t operator()(char32_t c) const noexcept { return c <= 0xffff ? blocks[256 * index[c >> 8] + (c & 0xff)] : 0; }
+        private:
+            uint8_t index[256] = {};
+            std::vector<uint8_t> blocks;
+        };
+
+        SingleByteEncoder::SingleByteEncoder(const SingleByteCharset& sbc):
+        blocks(256, 0) {
+            for (size_t i = 0; i < 128; ++i) {
+                auto c = sbc.decode[i];
+                if (c == 0)
+                    continue;
+                auto& slot = index[c >> 8];
+                if (slot == 0) {
+                    slot = uint8_t(blocks.size() / 256);
+                    blocks.resize(blocks.size() + 256, 0);
+                }
+                blocks[256 * slot + (c & 0xff)] = uint8_t(i + 0x80);
+            }
+        }
+
+        const SingleByteEncoder& builtin_encoder(const SingleByteCharset& sbc) {
+            static const auto encoders = [] {
+                std::vector<SingleByteEncoder> v;
+                for (auto& cs: UnicornDetail::single_byte_charsets)
+                    v.emplace_back(cs);
+                return v;
+            }();
+            return encoders[&sbc - UnicornDetail::single_byte_charsets];
+        }
+
+        // These append the converted text to dst. ASCII runs are copied in
+        // blocks; ascii_prefix() is only worth calling when at least two
+        // ASCII bytes follow.
+
+        void builtin_import(const char* src, size_t size, Ustring& dst, const SingleByteCharset& sbc, uint32_t flags) {
+            using namespace UnicornDetail;
+            auto in = reinterpret_cast<const uint8_t*>(src);
+            size_t pos = 0, base = dst.size();
+            dst.resize(base + 3 * size);
+            auto begin = reinterpret_cast<uint8_t*>(&dst[0]);
+            auto out = begin + base;
+            while (pos < size) {
+                if (in[pos] < 0x80) {
+                    if (pos + 1 < size && in[pos + 1] < 0x80) {
+                        size_t n = ascii_prefix(src + pos, size - pos);
+                        memcpy(out, in + pos, n);
+                        out += n;
+                        pos += n;
+                    } else {
+                        *out++ = in[pos++];
+                    }
+                    continue;
+                }
+                char32_t c = sbc.decode[in[pos] - 0x80];
+                if (c == 0) {
+                    if (flags & Utf::throws) {
+                        dst.resize(out - begin);
+                        throw EncodingError(sbc.name, pos, src + pos);
+                    }
+                    c = replacement_char;
+                }
+                if (c < 0x800) {
+                    *out++ = uint8_t(0xc0 | (c >> 6));
+                    *out++ = uint8_t(0x80 | (c & 0x3f));
+                } else {
+                    *out++ = uint8_t(0xe0 | (c >> 12));
+                    *out++ = uint8_t(0x80 | ((c >> 6) & 0x3f));
+                    *out++ = uint8_t(0x80 | (c & 0x3f));
+                }
+                ++pos;
+            }
+            dst.resize(out - begin);
+        }
+
+        void builtin_export(const char* src, size_t size, std::string& dst, const SingleByteCharset& sbc, uint32_t flags) {
+            using namespace UnicornDetail;
+            auto in = reinterpret_cast<const uint8_t*>(src);
+            auto& encoder = builtin_encoder(sbc);
+            size_t pos = 0, base = dst.size();
+            dst.resize(base + size);
+            auto begin = &dst[0];
+            auto out = begin + base;
+            while (pos < size) {
+                if (in[pos] < 0x80) {
+                    if (pos + 1 < size && in[pos + 1] < 0x80) {
+                        size_t n = ascii_prefix(src + pos, size - pos);
+                        memcpy(out, in + pos, n);
+                        out += n;
+                        pos += n;
+                    } else {
+                        *out++ = char(in[pos++]);
+                    }
+                    continue;
+                }
+                char32_t c = 0;
+                size_t rc = 0;
+                if (in[pos] >= 0xc2 && in[pos] <= 0xdf && pos + 1 < size && (in[pos + 1] & 0xc0) == 0x80) {
+                    c = (char32_t(in[pos] & 0x1f) << 6) | char32_t(in[pos + 1] & 0x3f);
+                    rc = 2;
+                } else {
+                    rc = UtfEncoding<char>::decode(src + pos, size - pos, c);
+                }
+                auto byte = encoder(c);
+                if (byte != 0) {
+                    *out++ = char(byte);
+                } else if (flags & Utf::throws) {
+                    dst.resize(out - begin);
+                    throw EncodingError(sbc.name, pos, src + pos, rc);
+                } else {
+                    *out++ = '?';
+                }
+                pos += rc;
+            }
+            dst.resize(out - begin);
+        }
+
+        void builtin_import(const std::string& src, Ustring& dst, const SingleByteCharset& sbc, uint32_t flags) {
+            Ustring result;
+            builtin_import(src.data(), src.size(), result, sbc, flags);
+            dst = std::move(result);
+        }
+
+        void builtin_export(const Ustring& src, std::string& dst, const SingleByteCharset& sbc, uint32_t flags) {
+            std::string result;
+            builtin_export(src.data(), src.size(), result, sbc, flags);
+            dst = std::move(result);
+        }
+
         char16_t reverse_char16(char16_t c) {
             auto p = reinterpret_cast<uint8_t*>(&c);
             std::swap(p[0], p[1]);
@@ -186,11 +396,6 @@ namespace RS::Unicorn {
                 else if (m1 == "utf32" || m1 == "ucs4")
                     return swap ? utf32swap_tag : utf32_tag;
             }
-            #ifdef _XOPEN_SOURCE
-                // Try using the name directly in iconv()
-                if (valid_iconv(name))
-                    return name;
-            #endif
             // Strip prefixes (x-, cs, cp, dos, ibm, ms, windows)
             auto current = name;
             if (str_starts_with(current, "cs") || str_starts_with(current, "x-"))
@@ -198,13 +403,26 @@ namespace RS::Unicorn {
             match = match_codepage(current);
             if (match)
                 current = match[1];
-            const CharsetInfo* csp = nullptr;
-            if (match || match_integer(current)) {
-                // Name is an integer, presumably a code page
-                auto page = uint32_t(decnum(current));
+            // If the name is an integer, presumably a code page, look it up in
+            // the {codepage => charset} map, otherwise in the {normalized name
+            // => charset} map
+            bool numeric = match || match_integer(current);
+            auto page = numeric ? uint32_t(decnum(current)) : 0;
+            auto csp = numeric ? map[page] : map[smash_name(current, true)];
+            // Prefer a built-in codec if there is one
+            if (auto sbc = builtin_charset(csp, page))
+                #ifdef _XOPEN_SOURCE
+                    return sbc->name;
+                #else
+                    return sbc->page;
+                #endif
+            #ifdef _XOPEN_SOURCE
+                // Try using the name directly in iconv()
+                if (valid_iconv(name))
+                    return name;
+            #endif
+            if (numeric) {
                 #ifdef _XOPEN_SOURCE
-                    // Look the number up in the {codepage => charset} map
-                    csp = map[page];
                     if (! csp) {
                         // If not found, try variations against iconv()
                         for (auto& prefix: codepage_prefixes) {
@@ -222,8 +440,6 @@ namespace RS::Unicorn {
                         return EncodingTag();
                 #endif
             } else {
-                // Look the name up in the {normalized name => charset} map
-                csp = map[smash_name(current, true)];
                 if (! csp) {
                     #ifdef _XOPEN_SOURCE
                         // If not found, try variations against iconv()
@@ -266,38 +482,74 @@ namespace RS::Unicorn {
 
         #ifdef _XOPEN_SOURCE
 
-            void native_recode(const std::string& src, std::string& dst, const Ustring& from, const Ustring& to,
+            // Convert as much of the input as possible, appending to dst, and
+            // return the number of bytes consumed. An incomplete sequence at
+            // the end of the input is left unconsumed, unless this is the
+            // final chunk. Invalid input is replaced with U+FFFD when
+            // importing, or a question mark when exporting, in which case the
+            // whole UTF-8 character is skipped.
+
+            size_t iconv_append(Iconv& conv, const char* src, size_t n, std::string& dst, bool import, bool final,
                     const Ustring& tag, uint32_t flags) {
-                Iconv conv(from, to);
-                if (! conv)
-                    throw UnknownEncoding(tag);
-                std::string buf(src.size(), 0);
-                size_t inpos = 0, outpos = 0;
-                while (inpos < src.size()) {
-                    auto inbuf = const_cast<char*>(&src[inpos]); // Posix brain damage
-                    auto inbytes = src.size() - inpos;
-                    auto outbuf = &buf[outpos];
-                    auto outbytes = buf.size() - outpos;
+                constexpr size_t margin = 16;
+                size_t inpos = 0, outpos = dst.size();
+                dst.resize(outpos + (import ? 2 : 1) * n + margin);
+                while (inpos < n) {
+                    auto inbuf = const_cast<char*>(src + inpos); // Posix brain damage
+                    auto inbytes = n - inpos;
+                    auto outbuf = &dst[outpos];
+                    auto outbytes = dst.size() - outpos;
                     errno = 0;
-                    iconv(conv.cd, &inbuf, &inbytes, &outbuf, &outbytes);
-                    inpos = src.size() - inbytes;
-                    outpos = buf.size() - outbytes;
-                    if (errno == 0) {
+                    auto rc = iconv(conv.cd, &inbuf, &inbytes, &outbuf, &outbytes);
+                    auto err = errno;
+                    inpos = n - inbytes;
+                    outpos = dst.size() - outbytes;
+                    if (rc != size_t(-1))
                         break;
-                    } else if (errno == E2BIG) {
-                        buf.resize(buf.size() + src.size());
-                    } else {
-                        if (flags & Utf::throws)
-                            throw EncodingError(tag, inpos, &src[inpos]);
-                        if (outbytes < 3)
-                            buf.resize(buf.size() + 3);
-                        memcpy(&buf[outpos], utf8_replacement, 3);
-                        ++inpos;
+                    if (err == E2BIG) {
+                        dst.resize(dst.size() + n - inpos + margin);
+                        continue;
+                    }
+                    if (err == EINVAL && ! final)
+                        break;
+                    size_t bad = 1;
+                    if (! import) {
+                        char32_t u = 0;
+                        bad = UnicornDetail::UtfEncoding<char>::decode(src + inpos, n - inpos, u);
+                    }
+                    if (flags & Utf::throws) {
+                        dst.resize(outpos);
+                        throw EncodingError(tag, inpos, src + inpos, bad);
+                    }
+                    if (dst.size() - outpos < margin)
+                        dst.resize(dst.size() + n - inpos + margin);
+                    if (import) {
+                        memcpy(&dst[outpos], utf8_replacement, 3);
                         outpos += 3;
-                        conv.reset();
+                    } else {
+                        dst[outpos++] = '?';
                     }
+                    inpos += bad;
+                    conv.reset();
                 }
-                buf.resize(outpos);
+                if (final) {
+                    // Write any sequence needed to return to the initial shift state
+                    if (dst.size() - outpos < margin)
+                        dst.resize(outpos + margin);
+                    auto outbuf = &dst[outpos];
+                    auto outbytes = dst.size() - outpos;
+                    iconv(conv.cd, nullptr, nullptr, &outbuf, &outbytes);
+                    outpos = dst.size() - outbytes;
+                }
+                dst.resize(outpos);
+                return inpos;
+            }
+
+            void native_recode(const std::string& src, std::string& dst, Iconv& conv, bool import,
+                    const Ustring& tag, uint32_t flags) {
+                conv.reset();
+                std::string buf;
+                iconv_append(conv, src.data(), src.size(), buf, import, true, tag, flags);
                 dst.swap(buf);
             }
 
@@ -312,12 +564,26 @@ namespace RS::Unicorn {
 
         #ifdef _XOPEN_SOURCE
 
-            void native_import(const std::string& src, std::string& dst, Ustring tag, uint32_t flags) {
-                native_recode(src, dst, tag, "utf-8"s, tag, flags);
+            Iconv& open_import(const Ustring& tag) {
+                auto conv = pooled_iconv(tag, utf8_tag);
+                if (! conv)
+                    throw UnknownEncoding(tag);
+                return *conv;
             }
 
-            void native_export(const std::string& src, std::string& dst, Ustring tag, uint32_t flags) {
-                native_recode(src, dst, "utf-8"s, tag, tag, flags);
+            Iconv& open_export(const Ustring& tag) {
+                auto conv = pooled_iconv(utf8_tag, tag);
+                if (! conv)
+                    throw UnknownEncoding(tag);
+                return *conv;
+            }
+
+            void native_import(const std::string& src, std::string& dst, const Ustring& tag, uint32_t flags) {
+                native_recode(src, dst, open_import(tag), true, tag, flags);
+            }
+
+            void native_export(const std::string& src, std::string& dst, const Ustring& tag, uint32_t flags) {
+                native_recode(src, dst, open_export(tag), false, tag, flags);
             }
 
         #else
@@ -426,6 +692,45 @@ namespace RS::Unicorn {
             }
         }
 
+        bool is_utf_tag(const EncodingTag& tag) {
+            return tag == utf8_tag || tag == utf16_tag || tag == utf16swap_tag || tag == utf32_tag || tag == utf32swap_tag;
+        }
+
+        // Returns the number of bytes at the end of a chunk of UTF input that
+        // make up an incomplete character, and need to be held back until
+        // more input arrives.
+
+        size_t incomplete_utf_tail(const char* src, size_t n, const EncodingTag& tag) {
+            auto in = reinterpret_cast<const uint8_t*>(src);
+            if (tag == utf8_tag) {
+                for (size_t k = 1; k <= std::min(n, size_t(3)); ++k) {
+                    auto b = in[n - k];
+                    if (b < 0x80)
+                        return 0;
+                    if (b >= 0xc0) {
+                        size_t len = b >= 0xf0 ? 4 : b >= 0xe0 ? 3 : 2;
+                        return len > k ? k : 0;
+                    }
+                }
+                return 0;
+            } else if (tag == utf16_tag || tag == utf16swap_tag) {
+                size_t k = n % 2;
+                if (n - k >= 2) {
+                    char16_t c = 0;
+                    memcpy(&c, src + n - k - 2, 2);
+                    if (tag == utf16swap_tag)
+                        c = reverse_char16(c);
+                    if (c >= 0xd800 && c <= 0xdbff)
+                        k += 2;
+                }
+                return k;
+            } else if (tag == utf32_tag || tag == utf32swap_tag) {
+                return n % 4;
+            } else {
+                return 0;
+            }
+        }
+
         template <typename E>
         void import_string_helper(const std::string& src, Ustring& dst, E enc, uint32_t flags) {
             check_mbcs_flags(flags);
@@ -438,6 +743,12 @@ namespace RS::Unicorn {
                 import_string_helper(src, dst, guess_utf(src), flags);
                 return;
             }
+            if (! (flags & Mbcs::strict)) {
+                if (auto sbc = builtin_charset(tag)) {
+                    builtin_import(src, dst, *sbc, flags);
+                    return;
+                }
+            }
             NativeString native_dst;
             if (! utf_import(src, native_dst, tag, flags))
                 native_import(src, native_dst, tag, flags);
@@ -452,12 +763,408 @@ namespace RS::Unicorn {
                 dst.clear();
                 return;
             }
+            if (! (flags & Mbcs::strict)) {
+                if (auto sbc = builtin_charset(tag)) {
+                    builtin_export(src, dst, *sbc, flags);
+                    return;
+                }
+            }
             NativeString native_src;
             recode(src, native_src, flags);
             if (! utf_export(native_src, dst, tag, flags))
                 native_export(native_src, dst, tag, flags);
         }
 
+
+        // Encoding detection
+
+        // Every byte in the sample is reduced to a class: ASCII lowercase
+        // letter, ASCII uppercase letter, other ASCII, or one of the 128
+        // high bytes. Counts of adjacent class pairs that involve at least
+        // one high byte are collected in a single pass, and each candidate
+        // charset is then scored against the distinct pairs.
+
+        constexpr size_t ascii_lower_class = 0;
+        constexpr size_t ascii_upper_class = 1;
+        constexpr size_t ascii_other_class = 2;
+        constexpr size_t high_class = 3;
+        constexpr size_t byte_classes = high_class + 128;
+
+        constexpr size_t byte_class(unsigned char b) noexcept {
+            return b >= 0x80 ? high_class + b - 0x80
+                : b >= 'a' && b <= 'z' ? ascii_lower_class
+                : b >= 'A' && b <= 'Z' ? ascii_upper_class
+                : ascii_other_class;
+        }
+
+        struct ClassPair {
+            uint16_t prev;
+            uint16_t cur;
+            uint32_t count;
+        };
+
+        struct SampleStats {
+            const unsigned char* data = nullptr;
+            size_t size = 0;
+            size_t high = 0;
+            size_t zeros[4] = {0, 0, 0, 0};
+            std::vector<ClassPair> pairs;
+            bool truncated = false;     // Sample was cut from a longer text
+        };
+
+        SampleStats sample_stats(std::string_view sample) {
+            SampleStats stats;
+            auto p = reinterpret_cast<const unsigned char*>(sample.data());
+            size_t n = sample.size();
+            stats.data = p;
+            stats.size = n;
+            if (memchr(p, 0, n))
+                for (size_t i = 0; i < n; ++i)
+                    if (p[i] == 0)
+                        ++stats.zeros[i % 4];
+            std::vector<uint32_t> counts(byte_classes * byte_classes, 0);
+            size_t prev = ascii_other_class, i = 0;
+            while (i < n) {
+                if (p[i] < 0x80) {
+                    i += ascii_prefix(sample.data() + i, n - i);
+                    prev = byte_class(p[i - 1]);
+                    if (i == n)
+                        break;
+                }
+                size_t cur = byte_class(p[i++]);
+                ++stats.high;
+                ++counts[prev * byte_classes + cur];
+                prev = cur;
+                if (i < n && p[i] < 0x80) {
+                    cur = byte_class(p[i++]);
+                    ++counts[prev * byte_classes + cur];
+                    prev = cur;
+                }
+            }
+            if (stats.high > 0)
+                for (size_t j = 0; j < counts.size(); ++j)
+                    if (counts[j] > 0)
+                        stats.pairs.push_back({uint16_t(j / byte_classes), uint16_t(j % byte_classes), counts[j]});
+            return stats;
+        }
+
+        // Properties of a character as decoded by a candidate charset
+
+        constexpr uint8_t dc_letter = 1;
+        constexpr uint8_t dc_lower = 2;
+        constexpr uint8_t dc_upper = 4;
+        constexpr uint8_t dc_latin = 8;
+        constexpr uint8_t dc_invalid = 16;
+
+        struct DecodedClass {
+            uint8_t flags = 0;
+            float score = 0;        // Plausibility of the character on its own
+        };
+
+        using CharsetClasses = std::array<DecodedClass, byte_classes>;
+
+        CharsetClasses make_charset_classes(const SingleByteCharset& sbc) {
+            CharsetClasses classes;
+            classes[ascii_lower_class].flags = dc_letter | dc_lower | dc_latin;
+            classes[ascii_upper_class].flags = dc_letter | dc_upper | dc_latin;
+            for (size_t i = 0; i < 128; ++i) {
+                auto& dc = classes[high_class + i];
+                char32_t c = sbc.decode[i];
+                if (c == 0) {
+                    dc.flags = dc_invalid;
+                    continue;
+                }
+                auto gc = char_general_category(c);
+                switch (char_primary_category(c)) {
+                    case 'L':
+                        dc.flags = dc_letter;
+                        if (c < 0x250 || (c >= 0x1e00 && c <= 0x1eff))
+                            dc.flags |= dc_latin;
+                        if (char_is_lowercase(c))
+                            dc.flags |= dc_lower;
+                        else if (char_is_uppercase(c))
+                            dc.flags |= dc_upper;
+                        dc.score = gc == GC::Ll ? 1 : 0.5f;
+                        break;
+                    case 'M':
+                    case 'P':
+                        break;
+                    case 'Z':
+                        dc.score = gc == GC::Zs ? 0 : -1;
+                        break;
+                    case 'S':
+                        dc.score = gc == GC::Sc ? 0 : -0.5f;
+                        break;
+                    case 'N':
+                        dc.score = -0.5f;
+                        break;
+                    default:
+                        dc.score = c >= 0x80 && c <= 0x9f ? -4 : -1;
+                        break;
+                }
+            }
+            return classes;
+        }
+
+        // Returns the average score per high byte, or a negative number if
+        // the sample contains bytes the charset does not define
+
+        double score_single_byte(const SampleStats& stats, const CharsetClasses& classes) {
+            double total = 0;
+            for (auto& pair: stats.pairs) {
+                auto& a = classes[pair.prev];
+                auto& b = classes[pair.cur];
+                if ((a.flags | b.flags) & dc_invalid)
+                    return -1;
+                bool a_high = pair.prev >= high_class, b_high = pair.cur >= high_class;
+                double s = b_high ? b.score : 0;
+                if (a.flags & b.flags & dc_letter) {
+                    // A capital in the middle of a word is unusual
+                    if ((a.flags & dc_lower) && (b.flags & dc_upper))
+                        s -= 2;
+                    if (a_high && b_high) {
+                        // Runs of accented Latin letters are rare, runs of
+                        // non-Latin letters are normal
+                        s += (b.flags & dc_latin) ? -1 : 1;
+                    } else {
+                        // Non-Latin letters adjacent to ASCII letters suggest
+                        // the wrong script
+                        auto& h = a_high ? a : b;
+                        s += (h.flags & dc_latin) ? 1 : -2;
+                    }
+                }
+                total += s * pair.count;
+            }
+            return total / double(stats.high);
+        }
+
+        // Structural checks for the common East Asian multibyte charsets.
+        // An incomplete character at the end of the sample is ignored only
+        // if the sample was cut from a longer text.
+
+        struct MultibyteStats {
+            size_t chars = 0;       // Multibyte characters
+            size_t kana = 0;        // Japanese kana (in the appropriate charset)
+            size_t halfwidth = 0;   // Halfwidth katakana (Shift-JIS)
+            size_t hangul = 0;      // Korean syllables (EUC-KR)
+            size_t hanja = 0;       // Han characters (EUC-KR)
+            size_t hanzi = 0;       // GB2312 Han characters
+            size_t low_trail = 0;   // Trail bytes below 0xa1
+            bool valid = true;
+        };
+
+        inline bool in_range(unsigned char b, unsigned lo, unsigned hi) noexcept { return b >= lo && b <= hi; }
+
+        template <typename F>
+        MultibyteStats scan_multibyte(const SampleStats& stats, F step) {
+            // step(p, n, ms) returns the length of the character at p, zero
+            // if it is invalid, or npos if it is truncated
+            MultibyteStats ms;
+            auto p = stats.data;
+            size_t n = stats.size, i = 0;
+            while (i < n) {
+                if (p[i] < 0x80) {
+                    i += ascii_prefix(reinterpret_cast<const char*>(p) + i, n - i);
+                    continue;
+                }
+                size_t k = step(p + i, n - i, ms);
+                if (k == npos && stats.truncated)
+                    break;
+                if (k == 0 || k == npos) {
+                    ms.valid = false;
+                    break;
+                }
+                i += k;
+            }
+            return ms;
+        }
+
+        MultibyteStats scan_shift_jis(const SampleStats& stats) {
+            return scan_multibyte(stats, [] (const unsigned char* p, size_t n, MultibyteStats& ms) -> size_t {
+                if (in_range(p[0], 0xa1, 0xdf)) {
+                    ++ms.halfwidth;
+                    return 1;
+                }
+                // Lead bytes above 0xef are user defined
+                if (! in_range(p[0], 0x81, 0x9f) && ! in_range(p[0], 0xe0, 0xef))
+                    return 0;
+                if (n < 2)
+                    return npos;
+                if (! in_range(p[1], 0x40, 0x7e) && ! in_range(p[1], 0x80, 0xfc))
+                    return 0;
+                ++ms.chars;
+                if ((p[0] == 0x82 && p[1] >= 0x9f) || (p[0] == 0x83 && p[1] <= 0x96))
+                    ++ms.kana;
+                return 2;
+            });
+        }
+
+        MultibyteStats scan_euc_jp(const SampleStats& stats) {
+            return scan_multibyte(stats, [] (const unsigned char* p, size_t n, MultibyteStats& ms) -> size_t {
+                size_t len = p[0] == 0x8f ? 3 : 2;
+                if (p[0] != 0x8e && p[0] != 0x8f && ! in_range(p[0], 0xa1, 0xfe))
+                    return 0;
+                if (n < len)
+                    return npos;
+                if (! in_range(p[1], 0xa1, p[0] == 0x8e ? 0xdf : 0xfe) || (len == 3 && ! in_range(p[2], 0xa1, 0xfe)))
+                    return 0;
+                ++ms.chars;
+                if (p[0] == 0x8e || p[0] == 0xa4 || p[0] == 0xa5)
+                    ++ms.kana;
+                return len;
+            });
+        }
+
+        MultibyteStats scan_euc_kr(const SampleStats& stats) {
+            return scan_multibyte(stats, [] (const unsigned char* p, size_t n, MultibyteStats& ms) -> size_t {
+                if (! in_range(p[0], 0xa1, 0xfe))
+                    return 0;
+                if (n < 2)
+                    return npos;
+                if (! in_range(p[1], 0xa1, 0xfe))
+                    return 0;
+                ++ms.chars;
+                if (in_range(p[0], 0xb0, 0xc8))
+                    ++ms.hangul;
+                else if (in_range(p[0], 0xca, 0xfd))
+                    ++ms.hanja;
+                return 2;
+            });
+        }
+
+        MultibyteStats scan_gb18030(const SampleStats& stats) {
+            return scan_multibyte(stats, [] (const unsigned char* p, size_t n, MultibyteStats& ms) -> size_t {
+                if (! in_range(p[0], 0x81, 0xfe))
+                    return 0;
+                if (n < 2)
+                    return npos;
+                size_t len = 2;
+                if (in_range(p[1], 0x30, 0x39)) {
+                    len = 4;
+                    if (n < 4)
+                        return npos;
+                    if (! in_range(p[2], 0x81, 0xfe) || ! in_range(p[3], 0x30, 0x39))
+                        return 0;
+                } else if (in_range(p[1], 0x40, 0x7e) || in_range(p[1], 0x80, 0xfe)) {
+                    if (p[1] < 0xa1)
+                        ++ms.low_trail;
+                    else if (in_range(p[0], 0xb0, 0xf7))
+                        ++ms.hanzi;
+                    else if (p[0] == 0xa4 || p[0] == 0xa5)
+                        ++ms.kana;
+                } else {
+                    return 0;
+                }
+                ++ms.chars;
+                return len;
+            });
+        }
+
+        MultibyteStats scan_big5(const SampleStats& stats) {
+            return scan_multibyte(stats, [] (const unsigned char* p, size_t n, MultibyteStats& ms) -> size_t {
+                if (! in_range(p[0], 0xa1, 0xf9))
+                    return 0;
+                if (n < 2)
+                    return npos;
+                if (! in_range(p[1], 0x40, 0x7e) && ! in_range(p[1], 0xa1, 0xfe))
+                    return 0;
+                ++ms.chars;
+                if (p[1] < 0xa1)
+                    ++ms.low_trail;
+                return 2;
+            });
+        }
+
+        // Checks for UTF-16 and UTF-32 without a BOM, based on the pattern
+        // of zero bytes expected in mostly Latin text
+
+        bool valid_utf32(const SampleStats& stats, bool big_endian) {
+            auto p = stats.data;
+            for (size_t i = 0; i + 4 <= stats.size; i += 4) {
+                char32_t c = big_endian
+                    ? (char32_t(p[i]) << 24) | (char32_t(p[i + 1]) << 16) | (char32_t(p[i + 2]) << 8) | char32_t(p[i + 3])
+                    : (char32_t(p[i + 3]) << 24) | (char32_t(p[i + 2]) << 16) | (char32_t(p[i + 1]) << 8) | char32_t(p[i]);
+                if (! char_is_unicode(c))
+                    return false;
+            }
+            return true;
+        }
+
+        bool valid_utf16(const SampleStats& stats, bool big_endian) {
+            auto p = stats.data;
+            size_t units = stats.size / 2;
+            bool pending_high = false;
+            for (size_t i = 0; i < units; ++i) {
+                char16_t c = big_endian ? char16_t((p[2 * i] << 8) | p[2 * i + 1]) : char16_t((p[2 * i + 1] << 8) | p[2 * i]);
+                bool high = c >= 0xd800 && c <= 0xdbff, low = c >= 0xdc00 && c <= 0xdfff;
+                if (low != pending_high)
+                    return false;
+                pending_high = high;
+            }
+            return true;
+        }
+
+        void detect_wide_utf(const SampleStats& stats, std::vector<EncodingGuess>& guesses) {
+            auto& z = stats.zeros;
+            size_t units32 = stats.size / 4, units16 = stats.size / 2;
+            if (units32 > 0) {
+                if (z[0] == units32 && 8 * z[1] >= 7 * units32 && valid_utf32(stats, true))
+                    guesses.push_back({"utf-32be", 0.95});
+                else if (z[3] == units32 && 8 * z[2] >= 7 * units32 && valid_utf32(stats, false))
+                    guesses.push_back({"utf-32le", 0.95});
+            }
+            if (units16 > 0) {
+                double even = double(z[0] + z[2]) / double(units16), odd = double(z[1] + z[3]) / double(units16);
+                if (even > 0.25 && 4 * odd < even && valid_utf16(stats, true))
+                    guesses.push_back({"utf-16be", std::min(0.5 + 0.45 * (even - odd), 0.9)});
+                else if (odd > 0.25 && 4 * even < odd && valid_utf16(stats, false))
+                    guesses.push_back({"utf-16le", std::min(0.5 + 0.45 * (odd - even), 0.9)});
+            }
+        }
+
+        void detect_multibyte(const SampleStats& stats, double cap, std::vector<EncodingGuess>& guesses) {
+            auto add = [&] (const char* name, const MultibyteStats& ms, double confidence) {
+                if (! ms.valid || ms.chars == 0)
+                    return;
+                // Short samples are less conclusive
+                if (ms.chars < 4)
+                    confidence *= 0.5 + 0.125 * double(ms.chars);
+                guesses.push_back({name, cap * std::clamp(confidence, 0.0, 1.0)});
+            };
+            auto ratio = [] (size_t x, size_t y) { return y == 0 ? 0.0 : double(x) / double(y); };
+            auto sjis = scan_shift_jis(stats);
+            // Halfwidth katakana are rare in modern text
+            add("shift_jis", sjis, 0.6 + 0.3 * std::min(3 * ratio(sjis.kana, sjis.chars), 1.0) - ratio(sjis.halfwidth, sjis.chars));
+            auto eucjp = scan_euc_jp(stats);
+            add("euc-jp", eucjp, 0.6 + 0.3 * std::min(3 * ratio(eucjp.kana, eucjp.chars), 1.0));
+            auto euckr = scan_euc_kr(stats);
+            add("euc-kr", euckr, 0.6 + 0.3 * ratio(euckr.hangul, euckr.chars) - 0.3 * ratio(euckr.hanja, euckr.chars));
+            auto gb = scan_gb18030(stats);
+            add("gb18030", gb, 0.6 + 0.25 * ratio(gb.hanzi, gb.chars) - 0.3 * ratio(gb.kana, gb.chars));
+            auto big5 = scan_big5(stats);
+            add("big5", big5, 0.6 + 0.3 * std::min(2.5 * ratio(big5.low_trail, big5.chars), 1.0));
+        }
+
+        void detect_single_byte(const SampleStats& stats, double cap, std::vector<EncodingGuess>& guesses) {
+            // Listed with the Windows charsets first, so that ties favour them
+            static const auto candidates = [] {
+                std::vector<std::pair<const SingleByteCharset*, CharsetClasses>> list;
+                for (int windows = 1; windows >= 0; --windows)
+                    for (auto& sbc: single_byte_charsets)
+                        if ((sbc.page >= 1250 && sbc.page <= 1258) == bool(windows))
+                            list.push_back({&sbc, make_charset_classes(sbc)});
+                std::stable_partition(list.begin(), list.end(),
+                    [] (auto& c) { return c.first->page == 1252; });
+                return list;
+            }();
+            constexpr double max_score = 2.5;
+            for (auto& [sbc, classes]: candidates) {
+                double score = score_single_byte(stats, classes);
+                if (score > 0)
+                    guesses.push_back({sbc->name, cap * std::min(score / max_score, 1.0)});
+            }
+        }
+
     }
 
     namespace UnicornDetail {
@@ -635,6 +1342,55 @@ namespace RS::Unicorn {
         return default_encoding;
     }
 
+    std::vector<EncodingGuess> detect_encoding(std::string_view sample, size_t max_bytes) {
+        using namespace UnicornDetail;
+        auto has_bom = [sample] (const char* bom, size_t n) { return sample.size() >= n && memcmp(sample.data(), bom, n) == 0; };
+        if (sample.empty() || has_bom(utf8_bom, 3))
+            return {{"utf-8", 1}};
+        if (has_bom("\0\0\xfe\xff", 4))
+            return {{"utf-32be", 1}};
+        if (has_bom("\xff\xfe\0\0", 4))
+            return {{"utf-32le", 1}};
+        if (has_bom("\xfe\xff", 2))
+            return {{"utf-16be", 1}};
+        if (has_bom("\xff\xfe", 2))
+            return {{"utf-16le", 1}};
+        bool truncated = sample.size() > max_bytes;
+        sample = sample.substr(0, max_bytes);
+        auto stats = sample_stats(sample);
+        stats.truncated = truncated;
+        std::vector<EncodingGuess> guesses;
+        size_t zeros = stats.zeros[0] + stats.zeros[1] + stats.zeros[2] + stats.zeros[3];
+        if (zeros > 0)
+            detect_wide_utf(stats, guesses);
+        // If the sample was cut short, treat an incomplete character at the
+        // end as a truncation artefact
+        bool utf8 = true;
+        size_t pos = utf8_validate(sample.data(), sample.size());
+        if (pos != npos && ! truncated) {
+            utf8 = false;
+        } else if (pos != npos) {
+            size_t tail = sample.size() - pos;
+            auto b = stats.data[pos];
+            size_t len = b >= 0xf0 && b <= 0xf4 ? 4 : b >= 0xe0 && b <= 0xef ? 3 : b >= 0xc2 && b <= 0xdf ? 2 : 0;
+            utf8 = tail < len;
+            for (size_t i = pos + 1; utf8 && i < sample.size(); ++i)
+                utf8 = (stats.data[i] & 0xc0) == 0x80;
+        }
+        // Text in an 8-bit encoding should not contain many null bytes
+        bool binary = 16 * zeros > stats.size;
+        if (utf8)
+            guesses.push_back({"utf-8", binary ? 0.2 : stats.high > 0 ? 0.99 : 1});
+        if (stats.high > 0 && ! binary) {
+            double cap = utf8 ? 0.4 : 0.9;
+            detect_single_byte(stats, cap, guesses);
+            detect_multibyte(stats, cap, guesses);
+        }
+        std::stable_sort(guesses.begin(), guesses.end(),
+            [] (auto& a, auto& b) { return a.confidence > b.confidence; });
+        return guesses;
+    }
+
     // Conversion functions
 
     void import_string(const std::string& src, Ustring& dst, const Ustring& enc, uint32_t flags) {
@@ -653,4 +1409,289 @@ namespace RS::Unicorn {
         export_string_helper(src, dst, enc, flags);
     }
 
+    struct MbcsConverter::impl_type {
+        EncodingTag tag;
+        uint32_t flags;
+        const SingleByteCharset* sbc = nullptr;
+        #ifdef _XOPEN_SOURCE
+            std::unique_ptr<Iconv> in;
+            std::unique_ptr<Iconv> out;
+        #endif
+        template <typename E> impl_type(E enc, uint32_t f): flags(f) {
+            check_mbcs_flags(flags);
+            tag = lookup_encoding(enc, flags);
+            if (! (flags & Mbcs::strict))
+                sbc = builtin_charset(tag);
+        }
+    };
+
+    MbcsConverter::MbcsConverter(const Ustring& enc, uint32_t flags):
+    impl(std::make_unique<impl_type>(to_utf8(enc), flags)) {}
+
+    MbcsConverter::MbcsConverter(uint32_t enc, uint32_t flags):
+    impl(std::make_unique<impl_type>(enc, flags)) {}
+
+    MbcsConverter::~MbcsConverter() noexcept {}
+    MbcsConverter::MbcsConverter(MbcsConverter&&) noexcept = default;
+    MbcsConverter& MbcsConverter::operator=(MbcsConverter&&) noexcept = default;
+
+    void MbcsConverter::import_string(const std::string& src, Ustring& dst) {
+        if (src.empty()) {
+            dst.clear();
+            return;
+        }
+        if (impl->tag == EncodingTag()) {
+            import_string_helper(src, dst, guess_utf(src), impl->flags);
+            return;
+        }
+        if (impl->sbc) {
+            builtin_import(src, dst, *impl->sbc, impl->flags);
+            return;
+        }
+        NativeString native_dst;
+        if (! utf_import(src, native_dst, impl->tag, impl->flags)) {
+            #ifdef _XOPEN_SOURCE
+                if (! impl->in) {
+                    auto conv = std::make_unique<Iconv>(impl->tag, utf8_tag);
+                    if (! *conv)
+                        throw UnknownEncoding(impl->tag);
+                    impl->in = std::move(conv);
+                }
+                native_recode(src, native_dst, *impl->in, true, impl->tag, impl->flags);
+            #else
+                native_import(src, native_dst, impl->tag, impl->flags);
+            #endif
+        }
+        recode(native_dst, dst);
+    }
+
+    void MbcsConverter::export_string(const Ustring& src, std::string& dst) {
+        if (src.empty()) {
+            dst.clear();
+            return;
+        }
+        if (impl->sbc) {
+            builtin_export(src, dst, *impl->sbc, impl->flags);
+            return;
+        }
+        NativeString native_src;
+        recode(src, native_src, impl->flags);
+        if (! utf_export(native_src, dst, impl->tag, impl->flags)) {
+            #ifdef _XOPEN_SOURCE
+                if (! impl->out) {
+                    auto conv = std::make_unique<Iconv>(utf8_tag, impl->tag);
+                    if (! *conv)
+                        throw UnknownEncoding(impl->tag);
+                    impl->out = std::move(conv);
+                }
+                native_recode(native_src, dst, *impl->out, false, impl->tag, impl->flags);
+            #else
+                native_export(native_src, dst, impl->tag, impl->flags);
+            #endif
+        }
+    }
+
+    struct MbcsDecoder::impl_type {
+        EncodingTag tag;
+        uint32_t flags;
+        bool guess = false;
+        const SingleByteCharset* sbc = nullptr;
+        std::string carry;
+        #ifdef _XOPEN_SOURCE
+            std::unique_ptr<Iconv> conv;
+        #endif
+        template <typename E> impl_type(E enc, uint32_t f): flags(f) {
+            check_mbcs_flags(flags);
+            tag = lookup_encoding(enc, flags);
+            guess = tag == EncodingTag();
+            if (! (flags & Mbcs::strict))
+                sbc = builtin_charset(tag);
+        }
+        void convert(const char* src, size_t n, Ustring& dst, bool final);
+    };
+
+    void MbcsDecoder::impl_type::convert(const char* src, size_t n, Ustring& dst, bool final) {
+        std::string joined;
+        if (! carry.empty()) {
+            joined = std::move(carry);
+            carry.clear();
+            if (n > 0)
+                joined.append(src, n);
+            src = joined.data();
+            n = joined.size();
+        }
+        if (guess && tag == EncodingTag()) {
+            // Wait for enough input to make a reasonable guess
+            constexpr size_t min_guess_bytes = 64;
+            if (n < min_guess_bytes && ! final) {
+                carry.assign(src, n);
+                return;
+            }
+            if (n > 0)
+                tag = lookup_encoding(guess_utf(std::string(src, n >= 4 ? n - n % 4 : n)));
+        }
+        if (sbc) {
+            builtin_import(src, n, dst, *sbc, flags);
+        } else if (is_utf_tag(tag)) {
+            size_t keep = final ? 0 : incomplete_utf_tail(src, n, tag);
+            carry.assign(src + n - keep, keep);
+            if (n > keep) {
+                NativeString native;
+                Ustring part;
+                utf_import(std::string(src, n - keep), native, tag, flags);
+                recode(native, part);
+                dst += part;
+            }
+        } else if (tag != EncodingTag()) {
+            #ifdef _XOPEN_SOURCE
+                if (! conv) {
+                    auto c = std::make_unique<Iconv>(tag, utf8_tag);
+                    if (! *c)
+                        throw UnknownEncoding(tag);
+                    conv = std::move(c);
+                }
+                auto used = iconv_append(*conv, src, n, dst, true, final, tag, flags);
+                carry.assign(src + used, n - used);
+            #else
+                // Hold back a trailing DBCS lead byte
+                size_t i = 0;
+                while (i < n)
+                    i += IsDBCSLeadByteEx(tag, BYTE(src[i])) ? 2 : 1;
+                size_t keep = i > n && ! final ? 1 : 0;
+                carry.assign(src + n - keep, keep);
+                if (n > keep) {
+                    std::wstring native;
+                    Ustring part;
+                    native_import(std::string(src, n - keep), native, tag, flags);
+                    recode(native, part);
+                    dst += part;
+                }
+            #endif
+        }
+        if (final) {
+            carry.clear();
+            #ifdef _XOPEN_SOURCE
+                if (conv)
+                    conv->reset();
+            #endif
+            if (guess)
+                tag = EncodingTag();
+        }
+    }
+
+    MbcsDecoder::MbcsDecoder(const Ustring& enc, uint32_t flags):
+    impl(std::make_unique<impl_type>(to_utf8(enc), flags)) {}
+
+    MbcsDecoder::MbcsDecoder(uint32_t enc, uint32_t flags):
+    impl(std::make_unique<impl_type>(enc, flags)) {}
+
+    MbcsDecoder::~MbcsDecoder() noexcept {}
+    MbcsDecoder::MbcsDecoder(MbcsDecoder&&) noexcept = default;
+    MbcsDecoder& MbcsDecoder::operator=(MbcsDecoder&&) noexcept = default;
+
+    void MbcsDecoder::feed(std::string_view chunk, Ustring& dst) {
+        impl->convert(chunk.data(), chunk.size(), dst, false);
+    }
+
+    void MbcsDecoder::finish(Ustring& dst) {
+        impl->convert(nullptr, 0, dst, true);
+    }
+
+    size_t MbcsDecoder::pending() const noexcept {
+        return impl->carry.size();
+    }
+
+    struct MbcsEncoder::impl_type {
+        EncodingTag tag;
+        uint32_t flags;
+        const SingleByteCharset* sbc = nullptr;
+        std::string carry;
+        #ifdef _XOPEN_SOURCE
+            std::unique_ptr<Iconv> conv;
+        #endif
+        template <typename E> impl_type(E enc, uint32_t f): flags(f) {
+            check_mbcs_flags(flags);
+            tag = lookup_encoding(enc, flags);
+            if (tag == EncodingTag())
+                tag = utf8_tag;
+            if (! (flags & Mbcs::strict))
+                sbc = builtin_charset(tag);
+        }
+        void convert(const char* src, size_t n, std::string& dst, bool final);
+    };
+
+    void MbcsEncoder::impl_type::convert(const char* src, size_t n, std::string& dst, bool final) {
+        std::string joined;
+        if (! carry.empty()) {
+            joined = std::move(carry);
+            carry.clear();
+            if (n > 0)
+                joined.append(src, n);
+            src = joined.data();
+            n = joined.size();
+        }
+        size_t keep = final ? 0 : incomplete_utf_tail(src, n, utf8_tag);
+        carry.assign(src + n - keep, keep);
+        n -= keep;
+        if (sbc) {
+            builtin_export(src, n, dst, *sbc, flags);
+        } else if (is_utf_tag(tag)) {
+            if (n > 0) {
+                NativeString native;
+                std::string part;
+                recode(std::string(src, n), native, flags);
+                utf_export(native, part, tag, flags);
+                dst += part;
+            }
+        } else {
+            #ifdef _XOPEN_SOURCE
+                if (! conv) {
+                    auto c = std::make_unique<Iconv>(utf8_tag, tag);
+                    if (! *c)
+                        throw UnknownEncoding(tag);
+                    conv = std::move(c);
+                }
+                auto used = iconv_append(*conv, src, n, dst, false, final, tag, flags);
+                carry.insert(0, src + used, n - used);
+            #else
+                if (n > 0) {
+                    std::wstring native;
+                    std::string part;
+                    recode(std::string(src, n), native, flags);
+                    native_export(native, part, tag, flags);
+                    dst += part;
+                }
+            #endif
+        }
+        if (final) {
+            carry.clear();
+            #ifdef _XOPEN_SOURCE
+                if (conv)
+                    conv->reset();
+            #endif
+        }
+    }
+
+    MbcsEncoder::MbcsEncoder(const Ustring& enc, uint32_t flags):
+    impl(std::make_unique<impl_type>(to_utf8(enc), flags)) {}
+
+    MbcsEncoder::MbcsEncoder(uint32_t enc, uint32_t flags):
+    impl(std::make_unique<impl_type>(enc, flags)) {}
+
+    MbcsEncoder::~MbcsEncoder() noexcept {}
+    MbcsEncoder::MbcsEncoder(MbcsEncoder&&) noexcept = default;
+    MbcsEncoder& MbcsEncoder::operator=(MbcsEncoder&&) noexcept = default;
+
+    void MbcsEncoder::feed(std::string_view chunk, std::string& dst) {
+        impl->convert(chunk.data(), chunk.size(), dst, false);
+    }
+
+    void MbcsEncoder::finish(std::string& dst) {
+        impl->convert(nullptr, 0, dst, true);
+    }
+
+    size_t MbcsEncoder::pending() const noexcept {
+        return impl->carry.size();
+    }
+
 }
@@ -7,6 +7,8 @@
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace RS::Unicorn {
 
@@ -51,7 +53,13 @@ namespace RS::Unicorn {
 
     // Utility functions
 
+    struct EncodingGuess {
+        Ustring encoding;
+        double confidence = 0;
+    };
+
     Ustring local_encoding(const Ustring& default_encoding = "utf-8");
+    std::vector<EncodingGuess> detect_encoding(std::string_view sample, size_t max_bytes = 65536);
 
     // Conversion functions
 
@@ -60,4 +68,54 @@ namespace RS::Unicorn {
     void export_string(const Ustring& src, std::string& dst, const Ustring& enc = {}, uint32_t flags = 0);
     void export_string(const Ustring& src, std::string& dst, uint32_t enc, uint32_t flags = 0);
 
+    class MbcsConverter {
+    public:
+        explicit MbcsConverter(const Ustring& enc, uint32_t flags = 0);
+        explicit MbcsConverter(uint32_t enc, uint32_t flags = 0);
+        ~MbcsConverter() noexcept;
+        MbcsConverter(const MbcsConverter&) = delete;
+        MbcsConverter(MbcsConverter&&) noexcept;
+        MbcsConverter& operator=(const MbcsConverter&) = delete;
+        MbcsConverter& operator=(MbcsConverter&&) noexcept;
+        void import_string(const std::string& src, Ustring& dst);
+        void export_string(const Ustring& src, std::string& dst);
+    private:
+        struct impl_type;
+        std::unique_ptr<impl_type> impl;
+    };
+
+    class MbcsDecoder {
+    public:
+        explicit MbcsDecoder(const Ustring& enc, uint32_t flags = 0);
+        explicit MbcsDecoder(uint32_t enc, uint32_t flags = 0);
+        ~MbcsDecoder() noexcept;
+        MbcsDecoder(const MbcsDecoder&) = delete;
+        MbcsDecoder(MbcsDecoder&&) noexcept;
+        MbcsDecoder& operator=(const MbcsDecoder&) = delete;
+        MbcsDecoder& operator=(MbcsDecoder&&) noexcept;
+        void feed(std::string_view chunk, Ustring& dst);
+        void finish(Ustring& dst);
+        size_t pending() const noexcept;
+    private:
+        struct impl_type;
+        std::unique_ptr<impl_type> impl;
+    };
+
+    class MbcsEncoder {
+    public:
+        explicit MbcsEncoder(const Ustring& enc, uint32_t flags = 0);
+        explicit MbcsEncoder(uint32_t enc, uint32_t flags = 0);
+        ~MbcsEncoder() noexcept;
+        MbcsEncoder(const MbcsEncoder&) = delete;
+        MbcsEncoder(MbcsEncoder&&) noexcept;
+        MbcsEncoder& operator=(const MbcsEncoder&) = delete;
+        MbcsEncoder& operator=(MbcsEncoder&&) noexcept;
+        void feed(std::string_view chunk, std::string& dst);
+        void finish(std::string& dst);
+        size_t pending() const noexcept;
+    private:
+        struct impl_type;
+        std::unique_ptr<impl_type> impl;
+    };
+
 }
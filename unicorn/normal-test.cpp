@@ -29,6 +29,11 @@ namespace {
         TEST_EQUAL(norm, expect);
         if (norm != expect)
             FAIL("Failed normalization test $1: $2 $3q => $4q"_fmt(line, form, orig, expect));
+        TEST_EQUAL(is_normalized(orig, form), orig == expect);
+        TEST(is_normalized(expect, form));
+        norm = orig;
+        TRY(normalize_in(norm, form));
+        TEST_EQUAL(norm, expect);
     }
 
     void do_main_tests(size_t b, size_t e) {
@@ -87,6 +92,10 @@ namespace {
             TEST_EQUAL(normalize(s, NFD), s);
             TEST_EQUAL(normalize(s, NFKC), s);
             TEST_EQUAL(normalize(s, NFKD), s);
+            TEST(is_normalized(s, NFC));
+            TEST(is_normalized(s, NFD));
+            TEST(is_normalized(s, NFKC));
+            TEST(is_normalized(s, NFKD));
         }
     }
 
@@ -129,3 +138,145 @@ void test_unicorn_normal_normalization() {
     #endif
 
 }
+
+void test_unicorn_normal_quick_check() {
+
+    Ustring s;
+
+    TEST(is_normalized("", NFC));
+    TEST(is_normalized("", NFD));
+    TEST(is_normalized("", NFKC));
+    TEST(is_normalized("", NFKD));
+    TEST(is_normalized("Hello world", NFC));
+    TEST(is_normalized("Hello world", NFD));
+    TEST(is_normalized("Hello world", NFKC));
+    TEST(is_normalized("Hello world", NFKD));
+
+    s = "abcéxyz";  TEST(is_normalized(s, NFC));  TEST(! is_normalized(s, NFD));
+    s = "abcéxyz";  TEST(! is_normalized(s, NFC));  TEST(is_normalized(s, NFD));
+    s = "abcx́xyz";  TEST(is_normalized(s, NFC));  TEST(is_normalized(s, NFD));
+    s = "abc½xyz";  TEST(is_normalized(s, NFC));  TEST(! is_normalized(s, NFKC));
+    s = "á̖";  TEST(! is_normalized(s, NFC));  TEST(! is_normalized(s, NFD));
+    s = "á̖";  TEST(! is_normalized(s, NFC));  TEST(is_normalized(s, NFD));
+    s = "á̖";  TEST(is_normalized(s, NFC));  TEST(! is_normalized(s, NFD));
+    s = "퓛";  TEST(is_normalized(s, NFC));  TEST(! is_normalized(s, NFD));
+    s = "퓛";  TEST(! is_normalized(s, NFC));  TEST(is_normalized(s, NFD));
+
+    s = "Hello world";
+    TEST_EQUAL(normalize(s, NFC), "Hello world");
+    TEST_EQUAL(normalize(s, NFKD), "Hello world");
+    TRY(normalize_in(s, NFC));
+    TEST_EQUAL(s, "Hello world");
+
+    s = "Hello world é é";
+    TEST_EQUAL(normalize(s, NFC), "Hello world é é");
+    TEST_EQUAL(normalize(s, NFD), "Hello world é é");
+    TRY(normalize_in(s, NFC));
+    TEST_EQUAL(s, "Hello world é é");
+
+    s = "Hello worlḍ̇";
+    TEST_EQUAL(normalize(s, NFC), "Hello worlḍ̇");
+    TEST_EQUAL(normalize(s, NFD), "Hello worlḍ̇");
+    TRY(normalize_in(s, NFC));
+    TEST_EQUAL(s, "Hello worlḍ̇");
+
+}
+
+void test_unicorn_normal_combining_runs() {
+
+    Ustring s = "a" + str_repeat("\u0301\u0316", 40) + "b" + str_repeat("\u0316\u0301", 3) + "c";
+
+    TEST_EQUAL(normalize(s, NFD), "a" + str_repeat("\u0316", 40) + str_repeat("\u0301", 40) + "b" + str_repeat("\u0316", 3) + str_repeat("\u0301", 3) + "c");
+    TEST_EQUAL(normalize(s, NFC), "\u00e1" + str_repeat("\u0316", 40) + str_repeat("\u0301", 39) + "b" + str_repeat("\u0316", 3) + str_repeat("\u0301", 3) + "c");
+    TEST_EQUAL(normalize("\u0301e\u0301\u0302", NFC), "\u0301\u00e9\u0302");
+    TEST_EQUAL(normalize("e\u0302\u0301", NFC), "\u1ebf");
+    TEST_EQUAL(normalize("\u1111\u1171\u11b6x", NFC), "\ud4dbx");
+
+    // Values outside the Unicode range pass through unchanged and block
+    // composition
+    Ustring big = "\xf7\xbf\xbf\xbf";    // 0x1fffff
+    Ustring over = "\xf4\x90\x80\x80";   // 0x110000
+    TEST_EQUAL(normalize("e\u0301" + big + "\u0301\u0316", NFC), "\u00e9" + big + "\u0316\u0301");
+    TEST_EQUAL(normalize("e\u0301" + big + "\u0301\u0316", NFD), "e\u0301" + big + "\u0316\u0301");
+    TEST_EQUAL(normalize("a" + over + "\u0301", NFC), "a" + over + "\u0301");
+    TEST_EQUAL(normalize(over + big + "e\u0301", NFKC), over + big + "\u00e9");
+
+}
+
+void test_unicorn_normal_streaming() {
+
+    Ustring src, dst, expect;
+
+    for (auto form: {NFC, NFD, NFKC, NFKD}) {
+        Normalizer norm(form);
+        TEST_EQUAL(norm.form(), form);
+        for (auto&& row: normalization_test_table) {
+            std::u32string utf32;
+            Strings hexcodes;
+            str_split(Ustring(row[0]), overwrite(hexcodes));
+            for (auto&& hc: hexcodes)
+                utf32 += char32_t(strtoul(hc.data(), nullptr, 16));
+            src += to_utf8(utf32) + " ";
+        }
+        expect = normalize(src, form);
+        for (size_t chunk: {1, 2, 3, 5, 16, 1000}) {
+            dst.clear();
+            for (size_t pos = 0; pos < src.size(); pos += chunk) {
+                TRY(norm.add(src.substr(pos, chunk), dst));
+                TEST_COMPARE(norm.pending(), <=, 100);
+            }
+            TRY(norm.flush(dst));
+            TEST_EQUAL(norm.pending(), 0);
+            TEST_EQUAL(dst.size(), expect.size());
+            TEST(dst == expect);
+        }
+        src.clear();
+    }
+
+    Normalizer norm;
+    TEST_EQUAL(norm.form(), NFC);
+
+    dst.clear();
+    TRY(norm.add("Hello e", dst));
+    TEST_EQUAL(dst, "Hello ");
+    TRY(norm.add("\xcc", dst));
+    TEST_EQUAL(dst, "Hello ");
+    TRY(norm.add("\x81 world", dst));
+    TEST_EQUAL(dst, "Hello é worl");
+    TRY(norm.flush(dst));
+    TEST_EQUAL(dst, "Hello é world");
+
+    src = "a" + str_repeat("\u0316", 40);
+    expect = "a" + str_repeat("\u0316", 30) + "\u034f" + str_repeat("\u0316", 10);
+    dst.clear();
+    TRY(norm.add(src, dst));
+    TRY(norm.flush(dst));
+    TEST_EQUAL(dst, expect);
+
+    // Long runs of starters whose quick check value is Maybe must not
+    // accumulate in the buffer
+
+    for (auto& unit: {"\u1161"s, "\u11a8"s, "\u0b3e"s, "\u0cd5"s, "\u1100\u1161\u11a8\u1161"s}) {
+        src = str_repeat(unit, 1000);
+        expect = normalize(src, NFC);
+        dst.clear();
+        size_t max_pending = 0;
+        for (int i = 0; i < 1000; ++i) {
+            TRY(norm.add(src, dst));
+            max_pending = std::max(max_pending, norm.pending());
+        }
+        TRY(norm.flush(dst));
+        TEST_COMPARE(max_pending, <=, 10);
+        TEST_EQUAL(dst.size(), 1000 * expect.size());
+        TEST(dst == str_repeat(expect, 1000));
+    }
+
+    dst.clear();
+    TRY(norm.add("abcé", dst));
+    TRY(norm.clear());
+    TEST_EQUAL(norm.pending(), 0);
+    TRY(norm.add("xyz", dst));
+    TRY(norm.flush(dst));
+    TEST_EQUAL(dst, "abcxyz");
+
+}
@@ -36,93 +36,330 @@ namespace RS::Unicorn {
 
     namespace {
 
-        void apply_decomposition(const Ustring& src, std::u32string& dst, bool k) {
+        using QuickCheckFunction = Quick_Check (*)(char32_t) noexcept;
+
+        QuickCheckFunction quick_check_function(NormalizationForm form) noexcept {
+            switch (form) {
+                case NFC:   return nfc_quick_check;
+                case NFD:   return nfd_quick_check;
+                case NFKC:  return nfkc_quick_check;
+                default:    return nfkd_quick_check;
+            }
+        }
+
+        // Scan the string using the quick check properties. On return, qc
+        // will be Yes if the string is known to be normalized, No if it is
+        // known not to be, or Maybe if the full algorithm is needed; in the
+        // last two cases the return value is the offset of the last stable
+        // starter before the first character that failed the check.
+
+        size_t quick_check(const Ustring& src, NormalizationForm form, Quick_Check& qc) noexcept {
+            using namespace UnicornDetail;
+            auto check = quick_check_function(form);
+            size_t prefix = ascii_prefix(src.data(), src.size());
+            size_t stable = prefix == 0 ? 0 : prefix - 1;
+            int last_cc = 0;
+            qc = Quick_Check::Yes;
+            for (auto i = utf_iterator(src, prefix), e = utf_end(src); i != e; ++i) {
+                int cc = combining_class(*i);
+                if (cc != 0 && cc < last_cc)
+                    qc = Quick_Check::No;
+                else
+                    qc = check(*i);
+                if (qc != Quick_Check::Yes)
+                    break;
+                if (cc == 0)
+                    stable = i.offset();
+                last_cc = cc;
+            }
+            return stable;
+        }
+
+        void append_decomposition(char32_t c, std::u32string& dst, bool k) {
             auto decompose = k ? compatibility_decomposition : canonical_decomposition;
             size_t max_decompose = k ? max_compatibility_decomposition : max_canonical_decomposition;
-            std::u32string buf(max_decompose, char32_t(0));
-            dst.reserve(src.size());
-            size_t pos = 0;
-            for (char32_t c: utf_range(src)) {
-                dst.resize(pos + max_decompose);
-                size_t len = decompose(c, &dst[pos]);
-                if (len == 0) {
-                    dst.resize(++pos);
-                    dst.back() = c;
-                } else {
-                    dst.resize(pos + len);
-                    while (pos < dst.size()) {
-                        len = decompose(dst[pos], &buf[0]);
-                        if (len == 0)
-                            ++pos;
-                        else
-                            dst.replace(pos, 1, &buf[0], len);
-                    }
+            char32_t buf[max_compatibility_decomposition];
+            size_t pos = dst.size();
+            dst.resize(pos + max_decompose);
+            size_t len = decompose(c, &dst[pos]);
+            if (len == 0) {
+                dst.resize(++pos);
+                dst.back() = c;
+            } else {
+                dst.resize(pos + len);
+                while (pos < dst.size()) {
+                    len = decompose(dst[pos], buf);
+                    if (len == 0)
+                        ++pos;
+                    else
+                        dst.replace(pos, 1, buf, len);
                 }
             }
         }
 
+        void apply_decomposition(const Ustring& src, size_t offset, std::u32string& dst, bool k) {
+            dst.reserve(src.size() - offset);
+            for (char32_t c: irange(utf_iterator(src, offset), utf_end(src)))
+                append_decomposition(c, dst, k);
+        }
+
+        // Ordering and composition both need the combining class of every
+        // character, so it is looked up once per character and carried in
+        // the top byte of the code point while they run.
+
+        constexpr int cc_shift = 24;
+        constexpr char32_t char_mask = (char32_t(1) << cc_shift) - 1;
+
+        int packed_cc(char32_t c) noexcept { return int(c >> cc_shift); }
+        char32_t pack_cc(char32_t c) noexcept { return c | (char32_t(combining_class(c)) << cc_shift); }
+
+        // Stable sort each run of non-starters by combining class. Runs are
+        // usually short and nearly sorted, so insertion sort is used except
+        // for pathologically long runs.
+
         void apply_ordering(std::u32string& str) {
-            auto i = str.begin(), j = i, e = str.end();
-            while (j != e) {
-                i = std::find_if(j, e, combining_class);
-                if (i == e)
-                    break;
-                j = std::find_if_not(i, e, combining_class);
-                std::stable_sort(i, j, [] (char32_t a, char32_t b)
-                    { return combining_class(a) < combining_class(b); });
+            static constexpr size_t max_insertion = 32;
+            size_t i = 0, n = str.size();
+            while (i < n) {
+                while (i < n && packed_cc(str[i]) == 0)
+                    ++i;
+                size_t j = i;
+                while (j < n && packed_cc(str[j]) != 0)
+                    ++j;
+                if (j - i > max_insertion) {
+                    std::stable_sort(str.begin() + i, str.begin() + j,
+                        [] (char32_t a, char32_t b) { return packed_cc(a) < packed_cc(b); });
+                } else {
+                    for (size_t k = i + 1; k < j; ++k) {
+                        char32_t c = str[k];
+                        size_t m = k;
+                        for (; m > i && packed_cc(str[m - 1]) > packed_cc(c); --m)
+                            str[m] = str[m - 1];
+                        str[m] = c;
+                    }
+                }
+                i = j;
             }
         }
 
+        // Single pass composition: the output is written behind the read
+        // position, tracking the last starter and the combining class of the
+        // last character that was not absorbed into it. A character can
+        // compose with the starter only if nothing between them blocks it.
+
         void apply_composition(std::u32string& str) {
-            if (str.size() < 2)
+            size_t n = str.size();
+            if (n < 2)
                 return;
-            auto i = str.begin(), e = str.end();
-            while (i != e) {
-                i = std::find_if_not(i, e, combining_class);
-                if (i == e)
-                    break;
-                bool combined = false;
-                int prev_cc = 0;
-                for (auto j = i + 1; j != e; ++j) {
-                    int cc = combining_class(*j);
-                    if (prev_cc == 0 || prev_cc < cc) {
-                        char32_t c = canonical_composition(*i, *j);
-                        if (c) {
-                            *i = c;
-                            str.erase(j);
-                            combined = true;
-                            break;
-                        }
+            size_t starter = 0, out = 1;
+            int last_cc = packed_cc(str[0]) == 0 ? 0 : 256;
+            for (size_t in = 1; in < n; ++in) {
+                char32_t c = str[in];
+                int cc = packed_cc(c);
+                if (last_cc < cc || last_cc == 0) {
+                    char32_t composite = canonical_composition(str[starter] & char_mask, c & char_mask);
+                    if (composite) {
+                        str[starter] = pack_cc(composite);
+                        continue;
                     }
-                    if (cc == 0)
+                }
+                if (cc == 0)
+                    starter = out;
+                last_cc = cc;
+                str[out++] = c;
+            }
+            str.resize(out);
+        }
+
+        // Values outside the Unicode range are passed through unchanged.
+        // They may be too large to carry a combining class, but they are
+        // starters that never compose, so the text on each side of one can
+        // be processed separately.
+
+        void apply_canonical(std::u32string& str, bool compose) {
+            auto non_unicode = [] (char32_t c) { return c > last_unicode_char; };
+            if (std::any_of(str.begin(), str.end(), non_unicode)) {
+                std::u32string out, part;
+                auto i = str.begin(), e = str.end();
+                for (;;) {
+                    auto j = std::find_if(i, e, non_unicode);
+                    part.assign(i, j);
+                    apply_canonical(part, compose);
+                    out += part;
+                    if (j == e)
                         break;
-                    prev_cc = cc;
+                    out += *j;
+                    i = j + 1;
                 }
-                if (! combined)
-                    ++i;
+                str = std::move(out);
+                return;
             }
+            for (auto& c: str)
+                c = pack_cc(c);
+            apply_ordering(str);
+            if (compose)
+                apply_composition(str);
+            for (auto& c: str)
+                c &= char_mask;
+        }
+
+        void apply_normalization(const Ustring& src, size_t offset, std::u32string& dst, NormalizationForm form) {
+            apply_decomposition(src, offset, dst, form == NFKC || form == NFKD);
+            apply_canonical(dst, form == NFC || form == NFKC);
         }
 
     }
 
+    bool is_normalized(const Ustring& src, NormalizationForm form) {
+        Quick_Check qc;
+        size_t offset = quick_check(src, form, qc);
+        if (qc != Quick_Check::Maybe)
+            return qc == Quick_Check::Yes;
+        std::u32string utf32;
+        apply_normalization(src, offset, utf32, form);
+        auto tail = irange(utf_iterator(src, offset), utf_end(src));
+        return std::equal(utf32.begin(), utf32.end(), tail.begin(), tail.end());
+    }
+
     Ustring normalize(const Ustring& src, NormalizationForm form) {
-        using namespace UnicornDetail;
+        Quick_Check qc;
+        size_t offset = quick_check(src, form, qc);
+        if (qc == Quick_Check::Yes)
+            return src;
         std::u32string utf32;
-        apply_decomposition(src, utf32, form == NFKC || form == NFKD);
-        apply_ordering(utf32);
-        if (form == NFC || form == NFKC)
-            apply_composition(utf32);
-        return to_utf8(utf32);
+        apply_normalization(src, offset, utf32, form);
+        return src.substr(0, offset) + to_utf8(utf32);
     }
 
     void normalize_in(Ustring& src, NormalizationForm form) {
-        using namespace UnicornDetail;
+        Quick_Check qc;
+        size_t offset = quick_check(src, form, qc);
+        if (qc == Quick_Check::Yes)
+            return;
         std::u32string utf32;
-        apply_decomposition(src, utf32, form == NFKC || form == NFKD);
-        apply_ordering(utf32);
-        if (form == NFC || form == NFKC)
-            apply_composition(utf32);
-        recode(utf32, src);
+        apply_normalization(src, offset, utf32, form);
+        src.resize(offset);
+        src += to_utf8(utf32);
+    }
+
+    // Class Normalizer
+
+    void Normalizer::add(const char* src, size_t n, Ustring& dst) {
+        if (partial_.empty()) {
+            size_t used = consume(src, n, false, dst);
+            partial_.assign(src + used, n - used);
+        } else {
+            partial_.append(src, n);
+            size_t used = consume(partial_.data(), partial_.size(), false, dst);
+            partial_.erase(0, used);
+        }
+        emit(dst);
+    }
+
+    void Normalizer::flush(Ustring& dst) {
+        consume(partial_.data(), partial_.size(), true, dst);
+        partial_.clear();
+        stable_ = buffer_.size();
+        emit(dst);
+        nonstarters_ = 0;
+    }
+
+    void Normalizer::clear() noexcept {
+        partial_.clear();
+        buffer_.clear();
+        stable_ = 0;
+        nonstarters_ = 0;
+    }
+
+    // Decode as much of the input as possible, holding back an incomplete
+    // UTF-8 sequence at the end unless this is the final call. Runs of
+    // ASCII are stable, so everything before the last byte of the run can
+    // be written straight to the output.
+
+    size_t Normalizer::consume(const char* src, size_t n, bool final, Ustring& dst) {
+        using namespace UnicornDetail;
+        size_t end = n;
+        if (! final) {
+            for (size_t i = 1; i <= 3 && i <= n; ++i) {
+                auto b = uint8_t(src[n - i]);
+                if (b < 0x80)
+                    break;
+                if (b >= 0xc0) {
+                    size_t len = b >= 0xf0 ? 4 : b >= 0xe0 ? 3 : 2;
+                    if (len > i)
+                        end = n - i;
+                    break;
+                }
+            }
+        }
+        bool k = form_ == NFKC || form_ == NFKD;
+        size_t pos = 0;
+        while (pos < end) {
+            size_t ascii = ascii_prefix(src + pos, end - pos);
+            if (ascii > 0) {
+                if (ascii > 1) {
+                    stable_ = buffer_.size();
+                    emit(dst);
+                    dst.append(src + pos, ascii - 1);
+                }
+                pos += ascii;
+                push(char32_t(src[pos - 1]));
+                continue;
+            }
+            char32_t c = 0;
+            pos += UtfEncoding<char>::decode(src + pos, end - pos, c);
+            if (! char_is_unicode(c))
+                c = replacement_char;
+            work_.clear();
+            append_decomposition(c, work_, k);
+            for (char32_t d: work_)
+                push(d);
+        }
+        return end;
+    }
+
+    // A starter with a quick check value of Yes is a stable boundary: no
+    // later character can interact with anything before it. A starter whose
+    // quick check value is Maybe is also a boundary if it does not compose
+    // with the text buffered since the last boundary, since anything after
+    // it can only compose with it or a later starter. Following the UAX #15
+    // stream-safe text process, a CGJ is inserted to break up runs of more
+    // than max_nonstarters non-starters.
+
+    void Normalizer::push(char32_t c) {
+        static constexpr char32_t cgj = 0x34f;
+        if (combining_class(c) == 0) {
+            nonstarters_ = 0;
+            auto qc = quick_check_function(form_)(c);
+            if (qc == Quick_Check::Maybe) {
+                // If c is absorbed, the last character is a composite or a
+                // non-starter, neither of which can be equal to c
+                probe_.assign(buffer_, stable_);
+                probe_ += c;
+                apply_canonical(probe_, true);
+                if (probe_.back() == c)
+                    qc = Quick_Check::Yes;
+            }
+            if (qc == Quick_Check::Yes)
+                stable_ = buffer_.size();
+        } else if (++nonstarters_ > max_nonstarters) {
+            stable_ = buffer_.size();
+            buffer_ += cgj;
+            nonstarters_ = 1;
+        }
+        buffer_ += c;
+    }
+
+    // Normalize and write everything before the last stable boundary.
+
+    void Normalizer::emit(Ustring& dst) {
+        if (stable_ == 0)
+            return;
+        work_.assign(buffer_, 0, stable_);
+        buffer_.erase(0, stable_);
+        stable_ = 0;
+        apply_canonical(work_, form_ == NFC || form_ == NFKC);
+        UnicornDetail::bulk_recode(work_.data(), work_.size(), dst, Utf::ignore);
     }
 
 }
@@ -2,12 +2,38 @@
 
 #include "unicorn/character.hpp"
 #include "unicorn/utility.hpp"
+#include <string>
 
 namespace RS::Unicorn {
 
     RS_ENUM(NormalizationForm, int, 1, NFC, NFD, NFKC, NFKD)
 
+    bool is_normalized(const Ustring& src, NormalizationForm form);
     Ustring normalize(const Ustring& src, NormalizationForm form);
     void normalize_in(Ustring& src, NormalizationForm form);
 
+    class Normalizer {
+    public:
+        static constexpr size_t max_nonstarters = 30;
+        Normalizer() = default;
+        explicit Normalizer(NormalizationForm form) noexcept: form_(form) {}
+        NormalizationForm form() const noexcept { return form_; }
+        void add(const char* src, size_t n, Ustring& dst);
+        void add(const Ustring& src, Ustring& dst) { add(src.data(), src.size(), dst); }
+        void flush(Ustring& dst);
+        void clear() noexcept;
+        size_t pending() const noexcept { return partial_.size() + buffer_.size(); }
+    private:
+        NormalizationForm form_ = NFC;
+        Ustring partial_;         // Incomplete UTF-8 sequence from the last chunk
+        std::u32string buffer_;   // Decomposed characters not yet written
+        std::u32string work_;     // Scratch space for the characters being written
+        std::u32string probe_;    // Scratch space for boundary checks
+        size_t stable_ = 0;       // Position of the last stable character in buffer_
+        size_t nonstarters_ = 0;  // Length of the current run of non-starters
+        size_t consume(const char* src, size_t n, bool final, Ustring& dst);
+        void push(char32_t c);
+        void emit(Ustring& dst);
+    };
+
 }
@@ -76,6 +76,10 @@ namespace RS::Unicorn {
         None, Decimal, Digit, Numeric
     )
 
+    RS_ENUM_CLASS(Quick_Check, int, 0,
+        Yes, Maybe, No
+    )
+
     RS_ENUM_CLASS(Sentence_Break, int, 0,
         Other, ATerm, Close, CR, EOT, Extend, Format, LF, Lower, Numeric,
         OLetter, SContinue, Sep, SOT, Sp, STerm, Upper
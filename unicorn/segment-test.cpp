@@ -24,6 +24,19 @@ namespace {
         return str;
     }
 
+    // Concatenate the valid examples from a break test table, separated by
+    // a mixture of spaces and line breaks
+
+    Ustring break_test_sample(Irange<char const* const*> table) {
+        Ustring sample;
+        for (Ustring line: table) {
+            auto source32 = decode_hex(line);
+            if (valid_string(source32))
+                sample += to_utf8(source32) + (line.size() % 3 ? " " : "\r\n");
+        }
+        return sample;
+    }
+
     struct SplitGraphemes {
         template <typename String>
         void operator()(const String& src, std::vector<String>& dst) const {
@@ -97,6 +110,16 @@ namespace {
         }
     }
 
+    template <typename Range>
+    std::vector<uint32_t> segment_offsets(const Range& range) {
+        std::vector<uint32_t> offsets;
+        for (auto& segment: range) {
+            offsets.push_back(uint32_t(segment.begin().offset()));
+            offsets.push_back(uint32_t(segment.end().offset()));
+        }
+        return offsets;
+    }
+
 }
 
 #define WORD_SEGMENTATION_TEST(source, all, graphics, alphas) \
@@ -151,6 +174,22 @@ namespace {
         TEST_EQUAL(result, stripped); \
     } while (false)
 
+#define LINE_BREAK_TEST(source, expect) \
+    do { \
+        auto s = cstr(source); \
+        decltype(line_break_range(s)) segments; \
+        TRY(segments = line_break_range(s)); \
+        decltype(s) result; \
+        for (auto it = segments.begin(); it != segments.end(); ++it) { \
+            str_append_char(result, '['); \
+            TRY(result += u_str(*it)); \
+            str_append_char(result, ']'); \
+            if (it.mandatory()) \
+                str_append_char(result, '!'); \
+        } \
+        TEST_EQUAL(result, expect); \
+    } while (false)
+
 void test_unicorn_segment_graphemes() {
 
     segmentation_test<SplitGraphemes>("Grapheme break test", UnicornDetail::grapheme_break_test_table);
@@ -198,6 +237,138 @@ void test_unicorn_segment_words() {
 
     );
 
+    std::string_view view = "(Hello world) again";
+    Strings words;
+    for (auto& w: word_range(view.substr(1, 11)))
+        words.push_back(u_str(w));
+    TEST_EQUAL(words.size(), 3);
+    if (words.size() == 3) {
+        TEST_EQUAL(words[0], "Hello");
+        TEST_EQUAL(words[1], " ");
+        TEST_EQUAL(words[2], "world");
+    }
+    words.clear();
+    for (auto& w: word_range(view, Segment::alpha))
+        words.push_back(Ustring(w.begin().ptr(), w.end().ptr()));
+    TEST_EQUAL(words.size(), 3);
+    if (words.size() == 3) {
+        TEST_EQUAL(words[0], "Hello");
+        TEST_EQUAL(words[1], "world");
+        TEST_EQUAL(words[2], "again");
+    }
+
+    std::u16string_view view16 = u"e\u0301x\u0302";
+    TEST_EQUAL(range_count(grapheme_range(view16)), 2);
+    TEST_EQUAL(range_count(grapheme_range(view16.substr(0, 3))), 2);
+    TEST_EQUAL(range_count(sentence_range("Hello. Goodbye."sv)), 2);
+
+    Ustring text = "(Hello world) again";
+    auto lean = utf_lean_range(text);
+    TEST_EQUAL(range_count(word_range(lean)), 7);
+    TEST_EQUAL(range_count(word_range(lean, Segment::alpha)), 3);
+    TEST_EQUAL(range_count(grapheme_range(utf_lean_range(u"e\u0301x\u0302"s))), 2);
+    TEST_EQUAL(range_count(sentence_range(utf_lean_range(U"Hello. Goodbye."s))), 2);
+
+}
+
+void test_unicorn_segment_parallel_words() {
+
+    Ustring text, sample = break_test_sample(UnicornDetail::word_break_test_table);
+    std::vector<size_t> expect, breaks;
+
+    while (text.size() < 0x200000)
+        text += sample;
+
+    TRY(breaks = parallel_word_breaks(""));
+    TEST(breaks.empty());
+
+    for (auto& word: word_range(text))
+        expect.push_back(word.begin().offset());
+    expect.push_back(text.size());
+    for (size_t threads: {0, 1, 2, 3, 8, 32}) {
+        TRY(breaks = parallel_word_breaks(text, threads));
+        TEST_EQUAL(breaks.size(), expect.size());
+        TEST(breaks == expect);
+    }
+
+    text.assign(0x100000, 'a');
+    TRY(breaks = parallel_word_breaks(text, 4));
+    TEST_EQUAL(breaks.size(), 2);
+    TEST_EQUAL(breaks.front(), 0);
+    TEST_EQUAL(breaks.back(), text.size());
+
+    // Invalid UTF-8 falls back on the sequential algorithm
+    text.assign(0xffff, 'a');
+    text += "\xf0((";
+    text += Ustring(0xfffe, 'b');
+    expect.clear();
+    for (auto& word: word_range(text))
+        expect.push_back(word.begin().offset());
+    expect.push_back(text.size());
+    for (size_t threads: {0, 2, 4}) {
+        TRY(breaks = parallel_word_breaks(text, threads));
+        TEST_EQUAL(breaks.size(), expect.size());
+        TEST(breaks == expect);
+    }
+
+}
+
+void test_unicorn_segment_boundaries() {
+
+    Strings samples = {
+        "",
+        "Hello world",
+        "\"Don't panic!\" - Douglas Adams",
+        "Hello.\r\n\r\nGoodbye.\n\nAu revoir. ",
+        "Hello\n\rworld\v\vagain\f\f\u0085\u0085\u2028\u2028\u2029\u2029end",
+        "\xff\xfe" "abc\xc3 \xe2\x80",
+    };
+    Ustring sample;
+    for (auto table: {UnicornDetail::grapheme_break_test_table, UnicornDetail::word_break_test_table, UnicornDetail::sentence_break_test_table})
+        sample += break_test_sample(table);
+    samples.push_back(sample);
+
+    std::vector<uint32_t> out;
+
+    for (auto& s: samples) {
+        TRY(grapheme_boundaries(s, out));
+        TEST(out == segment_offsets(grapheme_range(s)));
+        for (auto flags: {Segment::unicode, Segment::graphic, Segment::alpha}) {
+            TRY(word_boundaries(s, out, flags));
+            TEST(out == segment_offsets(word_range(s, flags)));
+        }
+        TRY(sentence_boundaries(s, out));
+        TEST(out == segment_offsets(sentence_range(s)));
+        for (auto flags: {Segment::keep, Segment::strip}) {
+            TRY(line_boundaries(s, out, flags));
+            TEST(out == segment_offsets(line_range(s, flags)));
+            for (auto mode: {Segment::multiline, Segment::line, Segment::unicode}) {
+                TRY(paragraph_boundaries(s, out, flags | mode));
+                TEST(out == segment_offsets(paragraph_range(s, flags | mode)));
+            }
+        }
+    }
+
+    TRY(word_boundaries("\"Don't panic!\"", out));
+    TEST_EQUAL(to_str(out), "[0,1,1,6,6,7,7,12,12,13,13,14]");
+    TRY(word_boundaries("\"Don't panic!\"", out, Segment::alpha));
+    TEST_EQUAL(to_str(out), "[1,6,7,12]");
+    TRY(line_boundaries("Hello\r\nworld\n", out, Segment::strip));
+    TEST_EQUAL(to_str(out), "[0,5,7,12]");
+
+    auto capacity = out.capacity();
+    auto data = out.data();
+    TRY(word_boundaries("Hello world", out));
+    TEST_EQUAL(out.size(), 6);
+    TEST_EQUAL(out.capacity(), capacity);
+    TEST(out.data() == data);
+    TRY(word_boundaries("", out));
+    TEST(out.empty());
+
+    TEST_THROW(word_boundaries("", out, Segment::graphic | Segment::alpha), std::invalid_argument);
+    TEST_THROW(line_boundaries("", out, Segment::keep | Segment::strip), std::invalid_argument);
+    TEST_THROW(paragraph_boundaries("", out, Segment::line | Segment::unicode), std::invalid_argument);
+
 }
 
 void test_unicorn_segment_lines() {
@@ -254,6 +425,50 @@ void test_unicorn_segment_sentences() {
 
     segmentation_test<SplitSentences>("Sentence break test", UnicornDetail::sentence_break_test_table);
 
+    // Segments with long lookahead
+
+    Ustring s, spaces(100, ' ');
+    Strings v;
+
+    s = "A." + spaces + "b. C";
+    TRY(SplitSentences()(s, v));
+    TEST_EQUAL(v.size(), 2u);
+    if (v.size() == 2) {
+        TEST_EQUAL(v[0], "A." + spaces + "b. ");
+        TEST_EQUAL(v[1], "C");
+    }
+
+    s = "A.)" + spaces + "B.";
+    v.clear();
+    TRY(SplitSentences()(s, v));
+    TEST_EQUAL(v.size(), 2u);
+    if (v.size() == 2) {
+        TEST_EQUAL(v[0], "A.)" + spaces);
+        TEST_EQUAL(v[1], "B.");
+    }
+
+}
+
+void test_unicorn_segment_line_breaks() {
+
+    LINE_BREAK_TEST("", "");
+    LINE_BREAK_TEST("Hello", "[Hello]");
+    LINE_BREAK_TEST("Hello world", "[Hello ][world]");
+    LINE_BREAK_TEST("  Hello  world  ", "[  ][Hello  ][world  ]");
+    LINE_BREAK_TEST("Hello\nworld\n", "[Hello\n]![world\n]!");
+    LINE_BREAK_TEST("Hello \r\n\r\nworld", "[Hello \r\n]![\r\n]![world]");
+    LINE_BREAK_TEST("Hello\u2028world", "[Hello\u2028]![world]");
+    LINE_BREAK_TEST("state-of-the-art", "[state-][of-][the-][art]");
+    LINE_BREAK_TEST("(Hello) world!", "[(Hello) ][world!]");
+    LINE_BREAK_TEST("Hello ( world ) !", "[Hello ][( world ) !]");
+    LINE_BREAK_TEST("$1,234.56 each", "[$1,234.56 ][each]");
+    LINE_BREAK_TEST("a\u00a0b c", "[a\u00a0b ][c]");
+    LINE_BREAK_TEST("a\u200bb", "[a\u200b][b]");
+    LINE_BREAK_TEST("a\u0301 \u0301b", "[a\u0301 ][\u0301b]");
+    LINE_BREAK_TEST("\u65e5\u672c\u8a9e\u3002\u6587", "[\u65e5][\u672c][\u8a9e\u3002][\u6587]");
+    LINE_BREAK_TEST("\u30c6\u30ad\u30b9\u30c8", "[\u30c6][\u30ad][\u30b9][\u30c8]");
+    LINE_BREAK_TEST("\u05d0-\u05d1", "[\u05d0-\u05d1]");
+
 }
 
 void test_unicorn_segment_paragraphs() {
@@ -1,288 +1,360 @@
 #include "unicorn/segment.hpp"
-
-using namespace std::literals;
+#include "unicorn/ucd-tables.hpp"
+#include <future>
+#include <limits>
+#include <thread>
 
 namespace RS::Unicorn {
 
     namespace {
 
-        template <typename P>
-        inline P prop(const std::deque<P>& buf, size_t i) {
-            return i < buf.size() ? buf[i] : P::EOT;
+        using LB = Line_Break;
+
+        // The line breaking state holds the resolved class of the last
+        // non-space character (shifted left 8 bits) and these flags.
+
+        constexpr int lb_space = 1;  // Spaces follow the last character
+        constexpr int lb_hl = 2;     // Last character is HY or BA after HL (LB21a)
+
+        // Bits in line_break_pair_table entries
+
+        constexpr int lb_pair_direct = 1;   // Break allowed between the pair
+        constexpr int lb_pair_spaces = 2;   // Break allowed if spaces intervene
+        constexpr int lb_pair_special = 4;  // Pair needs the rules below
+
+        // LB1. Assign a line breaking class to each code point of the input.
+        // Resolve AI, CB, CJ, SA, SG, and XX into other line breaking
+        // classes depending on criteria outside the scope of this algorithm.
+
+        LB resolve_line_break(char32_t c) noexcept {
+            auto lb = trie_lookup(UnicornDetail::line_break_trie, c);
+            switch (lb) {
+                case LB::AI:
+                case LB::SG:
+                case LB::XX:
+                    return LB::AL;
+                case LB::CJ:
+                    return LB::NS;
+                case LB::SA: {
+                    auto gc = char_general_category(c);
+                    return gc == GC::Mc || gc == GC::Mn ? LB::CM : LB::AL;
+                }
+                default:
+                    return lb;
+            }
         }
 
-    }
+        constexpr int line_break_state(LB lb, int flags) noexcept {
+            return UnicornDetail::segment_accept | int(lb) << 8 | flags;
+        }
 
-    namespace UnicornDetail {
+        // Chunks smaller than this are not worth a thread of their own
 
-        // Unicode Standard Annex #29: Unicode Text Segmentation
-        // http://www.unicode.org/reports/tr29
+        constexpr size_t min_parallel_chunk = 0x10000;
 
-        size_t find_grapheme_break(const std::deque<Grapheme_Cluster_Break>& buf, bool /*eof*/) {
-            using P = Grapheme_Cluster_Break;
-            if (buf.empty())
-                return 0;
-            size_t size = buf.size();
-            for (size_t i = 1; i < size; ++i) {
-                // Break at the start and end of text.
-                // GB1. sot ÷
-                // GB2. ÷ eot
-                // Do not break between a CR and LF. Otherwise, break before and after controls.
-                // GB3. CR × LF
-                // GB4. (Control | CR | LF) ÷
-                // GB5. ÷ (Control | CR | LF)
-                P prev(prop(buf, i - 1));
-                P next(prop(buf, i));
-                if (prev == P::CR && next == P::LF)
-                    continue;
-                if (prev == P::Control || prev == P::CR || prev == P::LF
-                        || next == P::Control || next == P::CR || next == P::LF)
-                    return i;
-                // Do not break Hangul syllable sequences.
-                // GB6. L × (L | V | LV | LVT)
-                if (prev == P::L
-                        && (next == P::L || next == P::V || next == P::LV || next == P::LVT))
-                    continue;
-                // GB7. (LV | V) × (V | T)
-                if ((prev == P::LV || prev == P::V) && (next == P::V || next == P::T))
-                    continue;
-                // GB8. (LVT | T) × T
-                if ((prev == P::LVT || prev == P::T) && next == P::T)
-                    continue;
-                // Do not break between regional indicator symbols.
-                // GB8a. Regional_Indicator × Regional_Indicator
-                if (prev == P::Regional_Indicator && next == P::Regional_Indicator)
-                    continue;
-                // Do not break before extending characters.
-                // GB9. × Extend
-                // Do not break before SpacingMarks, or after Prepend characters.
-                // GB9a. × SpacingMark
-                // GB9b. Prepend ×
-                if (prev == P::Prepend || next == P::Extend || next == P::SpacingMark)
-                    continue;
-                // Otherwise, break everywhere.
-                // GB10. Any ÷ Any
-                return i;
+        // A position is a safe place to split the text for word breaking if
+        // the sequential algorithm always breaks there, whatever came before:
+        // after a line break (WB3a), or after an Other character that is not
+        // followed by Extend or Format (nothing before WB14 can apply). Looks
+        // for one in [pos,limit) and returns npos if there is none.
+
+        size_t find_safe_word_break(const Ustring& src, size_t pos, size_t limit) noexcept {
+            using WB = Word_Break;
+            while (pos < src.size() && (uint8_t(src[pos]) & 0xc0) == 0x80)
+                ++pos;
+            if (pos >= limit)
+                return npos;
+            auto i = Utf8Iterator(src, pos), e = utf_end(src);
+            auto prev = trie_lookup(UnicornDetail::word_break_trie, *i);
+            for (++i; i != e && i.offset() < limit; ++i) {
+                auto next = trie_lookup(UnicornDetail::word_break_trie, *i);
+                if (prev == WB::LF || prev == WB::Newline || (prev == WB::CR && next != WB::LF)
+                        || (prev == WB::Other && next != WB::Extend && next != WB::Format))
+                    return i.offset();
+                prev = next;
             }
-            return 0;
+            return npos;
         }
 
-        size_t find_word_break(const std::deque<Word_Break>& buf, bool eof) {
-            using P = Word_Break;
-            if (buf.empty())
-                return 0;
-            size_t size = buf.size();
-            for (size_t i = 1; i < size; ++i) {
-                // Break at the start and end of text.
-                // WB1. sot ÷
-                // WB2. ÷ eot
-                // Do not break within CRLF.
-                // WB3. CR × LF
-                P prev(prop(buf, i - 1));
-                P next(prop(buf, i));
-                if (prev == P::CR && next == P::LF)
-                    continue;
-                // Otherwise break before and after Newlines (including CR and LF)
-                // WB3a. (Newline | CR | LF) ÷
-                // WB3b. ÷ (Newline | CR | LF)
-                if (prev == P::CR || prev == P::LF || prev == P::Newline
-                        || next == P::CR || next == P::LF || next == P::Newline)
-                    return i;
-                // Ignore Format and Extend characters, except when they
-                // appear at the beginning of a region of text.
-                // WB4. X (Extend | Format)* → X
-                if (next == P::Extend || next == P::Format)
-                    continue;
-                size_t j = i;
-                do prev = prop(buf, --j);
-                    while (prev == P::Extend || prev == P::Format);
-                P prev2;
-                do prev2 = prop(buf, --j);
-                    while (prev2 == P::Extend || prev2 == P::Format);
-                j = i;
-                P next2;
-                do next2 = prop(buf, ++j);
-                    while (next2 == P::Extend || next2 == P::Format);
-                // Do not break between most letters.
-                // WB5. (ALetter | Hebrew_Letter) × (ALetter | Hebrew_Letter)
-                if ((prev == P::ALetter || prev == P::Hebrew_Letter)
-                        && (next == P::ALetter || next == P::Hebrew_Letter))
-                    continue;
-                // Do not break letters across certain punctuation.
-                // WB6. (ALetter | Hebrew_Letter) × (MidLetter | MidNumLet | Single_Quote) (ALetter | Hebrew_Letter)
-                if ((prev == P::ALetter || prev == P::Hebrew_Letter)
-                        && (next == P::MidLetter || next == P::MidNumLet || next == P::Single_Quote)) {
-                    if (next2 == P::EOT && ! eof)
-                        return 0;
-                    if (next2 == P::ALetter || next2 == P::Hebrew_Letter)
-                        continue;
+        // The chunk is scanned to the end of the string and stopped by
+        // offset, so a character that straddles the cut can't carry the
+        // scan past its end.
+
+        std::vector<size_t> word_breaks_in(const Ustring& src, size_t begin, size_t end) {
+            std::vector<size_t> breaks;
+            for (auto& word: word_range(Utf8Iterator(src, begin), utf_end(src))) {
+                if (word.begin().offset() >= end)
+                    break;
+                breaks.push_back(word.begin().offset());
+            }
+            breaks.push_back(end);
+            return breaks;
+        }
+
+        // Boundary offsets are written directly from the UTF-8 code units,
+        // decoding the same way as a default UtfIterator.
+
+        using FindBlockOffsets = std::pair<size_t, size_t> (*)(std::string_view, size_t);
+
+        char32_t decode_at(std::string_view src, size_t pos, size_t& units) noexcept {
+            char32_t c = 0;
+            units = UnicornDetail::UtfEncoding<char>::decode_fast(src.data() + pos, src.size() - pos, c);
+            return c;
+        }
+
+        void check_offset_range(std::string_view src) {
+            if (src.size() > std::numeric_limits<uint32_t>::max())
+                throw std::length_error("String is too long for 32-bit offsets");
+        }
+
+        template <typename Pred>
+        bool any_char(std::string_view src, size_t pos, size_t end, Pred p) noexcept {
+            size_t units = 0;
+            for (; pos < end; pos += units)
+                if (p(decode_at(src, pos, units)))
+                    return true;
+            return false;
+        }
+
+        void dfa_boundaries(std::string_view src, std::vector<uint32_t>& out, UnicornDetail::SegmentStep step, uint32_t flags) {
+            using namespace UnicornDetail;
+            check_offset_range(src);
+            out.clear();
+            size_t next = 0, units = 0;
+            while (next < src.size()) {
+                size_t begin = next;
+                int state = segment_start;
+                for (size_t i = begin; i < src.size();) {
+                    state = step(state, decode_at(src, i, units));
+                    if (state == 0)
+                        break;
+                    i += units;
+                    if (state & segment_accept)
+                        next = i;
                 }
-                // WB7. (ALetter | Hebrew_Letter) (MidLetter | MidNumLet | Single_Quote) × (ALetter | Hebrew_Letter)
-                if ((prev2 == P::ALetter || prev2 == P::Hebrew_Letter)
-                        && (prev == P::MidLetter || prev == P::MidNumLet || prev == P::Single_Quote)
-                        && (next == P::ALetter || next == P::Hebrew_Letter))
+                if ((flags & Segment::graphic) && ! any_char(src, begin, next, [] (char32_t c) { return ! char_is_white_space(c); }))
                     continue;
-                // WB7a. Hebrew_Letter × Single_Quote
-                if (prev == P::Hebrew_Letter && next == P::Single_Quote)
+                if ((flags & Segment::alpha) && ! any_char(src, begin, next, char_is_alphanumeric))
                     continue;
-                // WB7b. Hebrew_Letter × Double_Quote Hebrew_Letter
-                if (prev == P::Hebrew_Letter && next == P::Double_Quote) {
-                    if (next2 == P::EOT && ! eof)
-                        return 0;
-                    if (next2 == P::Hebrew_Letter)
-                        continue;
+                out.push_back(uint32_t(begin));
+                out.push_back(uint32_t(next));
+            }
+        }
+
+        // These follow the FindBlockFunction templates in segment.hpp,
+        // returning the offsets delimiting the next end-of-block marker.
+
+        template <typename Pred>
+        std::pair<size_t, size_t> find_block_break(std::string_view src, size_t pos, Pred p) noexcept {
+            size_t units = 0;
+            for (; pos < src.size(); pos += units) {
+                char32_t c = decode_at(src, pos, units);
+                if (p(c)) {
+                    size_t end = pos + units;
+                    if (c == U'\r' && end < src.size() && src[end] == '\n')
+                        ++end;
+                    return {pos, end};
                 }
-                // WB7c. Hebrew_Letter Double_Quote × Hebrew_Letter
-                if (prev2 == P::Hebrew_Letter && prev == P::Double_Quote && next == P::Hebrew_Letter)
-                    continue;
-                // Do not break within sequences of digits, or digits adjacent to letters.
-                // WB8. Numeric × Numeric
-                // WB9. (ALetter | Hebrew_Letter) × Numeric
-                if ((prev == P::ALetter || prev == P::Hebrew_Letter || prev == P::Numeric)
-                        && next == P::Numeric)
-                    continue;
-                // WB10. Numeric × (ALetter | Hebrew_Letter)
-                if (prev == P::Numeric && (next == P::ALetter || next == P::Hebrew_Letter))
-                    continue;
-                // Do not break within sequences, such as “3.2” or “3,456.789”.
-                // WB11. Numeric (MidNum | MidNumLet | Single_Quote) × Numeric
-                if (prev2 == P::Numeric
-                        && (prev == P::MidNum || prev == P::MidNumLet || prev == P::Single_Quote)
-                        && next == P::Numeric)
+            }
+            return {pos, pos};
+        }
+
+        std::pair<size_t, size_t> find_end_of_line_offsets(std::string_view src, size_t pos) noexcept {
+            return find_block_break(src, pos, char_is_line_break);
+        }
+
+        std::pair<size_t, size_t> find_basic_para_offsets(std::string_view src, size_t pos) noexcept {
+            return find_block_break(src, pos, UnicornDetail::is_basic_para_break);
+        }
+
+        std::pair<size_t, size_t> find_multiline_para_offsets(std::string_view src, size_t pos) noexcept {
+            size_t units = 0;
+            for (;;) {
+                auto brk = find_end_of_line_offsets(src, pos);
+                if (brk.first == src.size())
+                    return brk;
+                char32_t c = decode_at(src, brk.first, units);
+                if (c == paragraph_separator_char)
+                    return brk;
+                if (c == line_separator_char || c == U'\f') {
+                    pos = brk.second;
                     continue;
-                // WB12. Numeric × (MidNum | MidNumLet | Single_Quote) Numeric
-                if (prev == P::Numeric
-                        && (next == P::MidNum || next == P::MidNumLet || next == P::Single_Quote)) {
-                    if (next2 == P::EOT && ! eof)
-                        return 0;
-                    if (next2 == P::Numeric)
-                        continue;
                 }
-                // Do not break between Katakana.
-                // WB13. Katakana × Katakana
-                if (prev == P::Katakana && next == P::Katakana)
-                    continue;
-                // Do not break from extenders.
-                // WB13a. (ALetter | Hebrew_Letter | Numeric | Katakana | ExtendNumLet) × ExtendNumLet
-                if ((prev == P::ALetter || prev == P::ExtendNumLet || prev == P::Hebrew_Letter
-                            || prev == P::Katakana || prev == P::Numeric)
-                        && next == P::ExtendNumLet)
-                    continue;
-                // WB13b. ExtendNumLet × (ALetter | Hebrew_Letter | Numeric | Katakana)
-                if (prev == P::ExtendNumLet
-                        && (next == P::ALetter || next == P::Hebrew_Letter || next == P::Katakana
-                            || next == P::Numeric))
-                    continue;
-                // Do not break between regional indicator symbols.
-                // WB13c. Regional_Indicator × Regional_Indicator
-                if (prev == P::Regional_Indicator && next == P::Regional_Indicator)
-                    continue;
-                // Otherwise, break everywhere (including around ideographs).
-                // WB14. Any ÷ Any
-                return i;
+                int linebreaks = 1;
+                size_t end = brk.second;
+                while (end < src.size() && UnicornDetail::is_restricted_line_break(decode_at(src, end, units))) {
+                    end = find_end_of_line_offsets(src, end).second;
+                    ++linebreaks;
+                }
+                if (linebreaks >= 2)
+                    return {brk.first, end};
+                pos = end;
             }
-            return 0;
         }
 
-        size_t find_sentence_break(const std::deque<Sentence_Break>& buf, bool eof) {
-            using P = Sentence_Break;
-            if (buf.empty())
+        std::pair<size_t, size_t> find_unicode_para_offsets(std::string_view src, size_t pos) noexcept {
+            return find_block_break(src, pos, [] (char32_t c) { return c == paragraph_separator_char; });
+        }
+
+        void block_boundaries(std::string_view src, std::vector<uint32_t>& out, FindBlockOffsets find, uint32_t flags) {
+            check_offset_range(src);
+            out.clear();
+            size_t next = 0;
+            while (next < src.size()) {
+                auto brk = find(src, next);
+                out.push_back(uint32_t(next));
+                out.push_back(uint32_t(flags & Segment::strip ? brk.first : brk.second));
+                next = brk.second;
+            }
+        }
+
+    }
+
+    namespace UnicornDetail {
+
+        // Unicode Standard Annex #29: Unicode Text Segmentation
+        // http://www.unicode.org/reports/tr29
+
+        // The state machines are generated from the UAX29 rules by
+        // make-tables; see the segmentation section there for the rules.
+
+        int grapheme_break_step(int state, char32_t c) noexcept {
+            auto p = int(trie_lookup(grapheme_cluster_break_trie, c));
+            return grapheme_break_dfa_table.begin()[state & ~ segment_accept][p];
+        }
+
+        int word_break_step(int state, char32_t c) noexcept {
+            auto p = int(trie_lookup(word_break_trie, c));
+            return word_break_dfa_table.begin()[state & ~ segment_accept][p];
+        }
+
+        int sentence_break_step(int state, char32_t c) noexcept {
+            auto p = int(trie_lookup(sentence_break_trie, c));
+            return sentence_break_dfa_table.begin()[state & ~ segment_accept][p];
+        }
+
+        // Unicode Standard Annex #14: Unicode Line Breaking Algorithm
+        // http://www.unicode.org/reports/tr14
+
+        // The pair table is generated by make-tables; see the line breaking
+        // section there for the rules it encodes.
+
+        int line_break_step(int state, char32_t c) noexcept {
+            auto next = resolve_line_break(c);
+            if (state == segment_start) {
+                // LB2. Never break at the start of text.
+                // LB10. Treat any remaining combining mark as AL.
+                // Leading spaces follow an implicit WJ, so they stay
+                // together but can be broken after (LB18).
+                if (next == LB::SP)
+                    return line_break_state(LB::WJ, lb_space);
+                if (next == LB::CM)
+                    next = LB::AL;
+                return line_break_state(next, 0);
+            }
+            auto prev = LB(state >> 8 & 0xff);
+            int pair = line_break_pair_table.begin()[int(prev)][int(next)];
+            // Most pairs are settled by the table alone
+            if (! (pair & lb_pair_special) && ! (state & (lb_space | lb_hl)))
+                return pair & lb_pair_direct ? 0 : line_break_state(next, 0);
+            bool spaces = state & lb_space;
+            // LB4. Always break after hard line breaks.
+            // LB5. Treat CR followed by LF, as well as CR, LF, and NL as hard line breaks.
+            if (prev == LB::BK || prev == LB::LF || prev == LB::NL)
                 return 0;
-            size_t size = buf.size();
-            for (size_t i = 1; i < size; ++i) {
-                // Break at the start and end of text.
-                // SB1. sot ÷
-                // SB2. ÷ eot
-                // Do not break within CRLF.
-                // SB3. CR × LF
-                P prev(prop(buf, i - 1));
-                P next(prop(buf, i));
-                if (prev == P::CR && next == P::LF)
-                    continue;
-                // Break after paragraph separators.
-                // SB4. Sep | CR | LF ÷
-                if (prev == P::CR || prev == P::LF || prev == P::Sep)
-                    return i;
-                // Ignore Format and Extend characters, except when they
-                // appear at the beginning of a region of text.
-                // SB5. X (Extend | Format)* → X
-                if (next == P::Extend || next == P::Format)
-                    continue;
-                size_t j = i;
-                do prev = prop(buf, --j);
-                    while (prev == P::Extend || prev == P::Format);
-                P prev2;
-                do prev2 = prop(buf, --j);
-                    while (prev2 == P::Extend || prev2 == P::Format);
-                // Do not break after ambiguous terminators like period, if
-                // they are immediately followed by a number or lowercase
-                // letter, if they are between uppercase letters, if the first
-                // following letter (optionally after certain punctuation) is
-                // lowercase, or if they are followed by “continuation”
-                // punctuation such as comma, colon, or semicolon.
-                // SB6. ATerm × Numeric
-                if (prev == P::ATerm && next == P::Numeric)
-                    continue;
-                // SB7. (Upper | Lower) ATerm × Upper
-                if ((prev2 == P::Upper || prev2 == P::Lower) && prev == P::ATerm && next == P::Upper)
-                    continue;
-                // SB8. ATerm Close* Sp* × (¬(OLetter | Upper | Lower | Sep | CR | LF | STerm | ATerm))* Lower
-                j = i;
-                P pre_cs;
-                do pre_cs = prop(buf, --j);
-                    while (pre_cs == P::Extend || pre_cs == P::Format || pre_cs == P::Sp);
-                while (pre_cs == P::Extend || pre_cs == P::Format || pre_cs == P::Close)
-                    pre_cs = prop(buf, --j);
-                if (pre_cs == P::ATerm) {
-                    j = i;
-                    P post(prop(buf, j));
-                    while (post == P::Extend || post == P::Format
-                            || (post != P::ATerm && post != P::EOT && post != P::CR && post != P::LF && post != P::Lower
-                                && post != P::OLetter && post != P::Sep && post != P::STerm && post != P::Upper))
-                        post = prop(buf, ++j);
-                    if (post == P::EOT && ! eof)
-                        return 0;
-                    if (post == P::Lower)
-                        continue;
-                }
-                // SB8a. (STerm | ATerm) Close* Sp* × (SContinue | STerm | ATerm)
-                if ((pre_cs == P::ATerm || pre_cs == P::STerm)
-                        && (next == P::ATerm || next == P::SContinue || next == P::STerm))
-                    continue;
-                // Break after sentence terminators, but include closing
-                // punctuation, trailing spaces, and a paragraph separator (if
-                // present).
-                // SB9. (STerm | ATerm) Close* × (Close | Sp | Sep | CR | LF)
-                j = i;
-                P pre_c;
-                do pre_c = prop(buf, --j);
-                    while (pre_c == P::Extend || pre_c == P::Format || pre_c == P::Close);
-                if ((pre_c == P::ATerm || pre_c == P::STerm)
-                        && (next == P::Close || next == P::CR || next == P::LF || next == P::Sep || next == P::Sp))
-                    continue;
-                // SB10. (STerm | ATerm) Close* Sp* × (Sp | Sep | CR | LF)
-                if ((pre_cs == P::ATerm || pre_cs == P::STerm)
-                        && (next == P::CR || next == P::LF || next == P::Sep || next == P::Sp))
-                    continue;
-                // SB11. (STerm | ATerm) Close* Sp* (Sep | CR | LF)? ÷
-                j = i;
-                P pre_csx;
-                do pre_csx = prop(buf, --j);
-                    while (pre_csx == P::Extend || pre_csx == P::Format);
-                if (pre_csx == P::CR || pre_csx == P::LF || pre_csx == P::Sep)
-                    pre_csx = prop(buf, --j);
-                while (pre_csx == P::Extend || pre_csx == P::Format || pre_csx == P::Sp)
-                    pre_csx = prop(buf, --j);
-                while (pre_csx == P::Extend || pre_csx == P::Format || pre_csx == P::Close)
-                    pre_csx = prop(buf, --j);
-                if (pre_csx == P::ATerm || pre_csx == P::STerm)
-                    return i;
-                // Otherwise, do not break.
-                // SB12. Any × Any
+            if (prev == LB::CR)
+                return next == LB::LF ? line_break_state(LB::BK, 0) : 0;
+            // LB6. Do not break before hard line breaks.
+            if (next == LB::BK || next == LB::CR || next == LB::LF || next == LB::NL)
+                return line_break_state(next, 0);
+            // LB7. Do not break before spaces or zero width space.
+            if (next == LB::SP)
+                return line_break_state(prev, lb_space);
+            // LB9. Do not break a combining character sequence; treat it as if
+            // it has the line breaking class of the base character.
+            // LB10. Treat any remaining combining mark as AL.
+            if (next == LB::CM) {
+                if (! spaces && prev != LB::ZW)
+                    return state;
+                next = LB::AL;
+                pair = line_break_pair_table.begin()[int(prev)][int(next)];
             }
-            return 0;
+            bool allowed = pair & (spaces ? lb_pair_spaces : lb_pair_direct);
+            // LB21a. Don't break after Hebrew + Hyphen.
+            if (allowed && (state & lb_hl) && ! spaces && next != LB::CB)
+                allowed = false;
+            if (allowed)
+                return 0;
+            int flags = ! spaces && prev == LB::HL && (next == LB::BA || next == LB::HY) ? lb_hl : 0;
+            return line_break_state(next, flags);
+        }
+
+    }
+
+    // Parallel segmentation
+
+    std::vector<size_t> parallel_word_breaks(const Ustring& src, size_t threads) {
+        if (src.empty())
+            return {};
+        if (threads == 0)
+            threads = std::thread::hardware_concurrency();
+        // Cut points can't be trusted if the decoder may step over them
+        if (! valid_string(src))
+            threads = 1;
+        threads = std::max(std::min(threads, src.size() / min_parallel_chunk), size_t(1));
+        std::vector<size_t> cuts = {0};
+        for (size_t k = 1; k < threads; ++k) {
+            size_t cut = find_safe_word_break(src, std::max(k * src.size() / threads, cuts.back()),
+                (k + 1) * src.size() / threads);
+            if (cut != npos && cut > cuts.back())
+                cuts.push_back(cut);
         }
+        cuts.push_back(src.size());
+        std::vector<std::future<std::vector<size_t>>> tasks;
+        for (size_t k = 1; k + 1 < cuts.size(); ++k)
+            tasks.push_back(std::async(std::launch::async, word_breaks_in, std::cref(src), cuts[k], cuts[k + 1]));
+        auto breaks = word_breaks_in(src, cuts[0], cuts[1]);
+        for (auto& task: tasks) {
+            auto chunk = task.get();
+            breaks.insert(breaks.end(), chunk.begin() + 1, chunk.end());
+        }
+        return breaks;
+    }
+
+    // Segment boundary offsets
+
+    void grapheme_boundaries(std::string_view src, std::vector<uint32_t>& out) {
+        dfa_boundaries(src, out, UnicornDetail::grapheme_break_step, 0);
+    }
+
+    void word_boundaries(std::string_view src, std::vector<uint32_t>& out, uint32_t flags) {
+        if (popcount(flags & (Segment::unicode | Segment::graphic | Segment::alpha)) > 1)
+            throw std::invalid_argument("Inconsistent word breaking flags");
+        dfa_boundaries(src, out, UnicornDetail::word_break_step, flags);
+    }
+
+    void sentence_boundaries(std::string_view src, std::vector<uint32_t>& out) {
+        dfa_boundaries(src, out, UnicornDetail::sentence_break_step, 0);
+    }
+
+    void line_boundaries(std::string_view src, std::vector<uint32_t>& out, uint32_t flags) {
+        if (popcount(flags & (Segment::keep | Segment::strip)) > 1)
+            throw std::invalid_argument("Inconsistent line breaking flags");
+        block_boundaries(src, out, find_end_of_line_offsets, flags);
+    }
 
+    void paragraph_boundaries(std::string_view src, std::vector<uint32_t>& out, uint32_t flags) {
+        if (popcount(flags & (Segment::keep | Segment::strip)) > 1
+                || popcount(flags & (Segment::multiline | Segment::line | Segment::unicode)) > 1)
+            throw std::invalid_argument("Inconsistent paragraph breaking flags");
+        FindBlockOffsets f;
+        if (flags & Segment::unicode)
+            f = find_unicode_para_offsets;
+        else if (flags & Segment::line)
+            f = find_basic_para_offsets;
+        else
+            f = find_multiline_para_offsets;
+        block_boundaries(src, out, f, flags);
     }
 
 }
@@ -4,11 +4,12 @@
 #include "unicorn/utf.hpp"
 #include "unicorn/utility.hpp"
 #include <algorithm>
-#include <deque>
 #include <iterator>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <utility>
+#include <vector>
 
 namespace RS::Unicorn {
 
@@ -30,63 +31,67 @@ namespace RS::Unicorn {
 
     namespace UnicornDetail {
 
-        template <typename Property> using PropertyQuery = Property (*)(char32_t);
-        template <typename Property> using SegmentFunction = size_t (*)(const std::deque<Property>&, bool);
+        // Each step function looks up the segmentation property of a
+        // character and advances the UAX29 state machine by one step.
+        // State 0 means no further extension of the segment is possible;
+        // the accept bit marks states where the segment could end.
 
-        size_t find_grapheme_break(const std::deque<Grapheme_Cluster_Break>& buf, bool eof);
-        size_t find_word_break(const std::deque<Word_Break>& buf, bool eof);
-        size_t find_sentence_break(const std::deque<Sentence_Break>& buf, bool eof);
+        constexpr int segment_start = 1;
+        constexpr int segment_accept = 0x80; // Must match segmentation_dfa() in make-tables
+
+        using SegmentStep = int (*)(int, char32_t) noexcept;
+
+        int grapheme_break_step(int state, char32_t c) noexcept;
+        int word_break_step(int state, char32_t c) noexcept;
+        int sentence_break_step(int state, char32_t c) noexcept;
+        int line_break_step(int state, char32_t c) noexcept;
 
     }
 
-    template <typename C, typename Property, UnicornDetail::PropertyQuery<Property> PQ, UnicornDetail::SegmentFunction<Property> SF>
+    // U is UtfIterator<C>, UtfViewIterator<C>, or UtfLeanIterator<C,F>
+
+    template <typename U, UnicornDetail::SegmentStep SS>
     class BasicSegmentIterator:
-    public ForwardIterator<BasicSegmentIterator<C, Property, PQ, SF>, const Irange<UtfIterator<C>>> {
+    public ForwardIterator<BasicSegmentIterator<U, SS>, const Irange<U>> {
     public:
-        using utf_iterator = UtfIterator<C>;
+        using utf_iterator = U;
         BasicSegmentIterator() noexcept {}
         BasicSegmentIterator(const utf_iterator& i, const utf_iterator& j, uint32_t flags):
-            seg{i, i}, ends(j), next(i), bufsize(initsize), mode(flags) { ++*this; }
+            seg{i, i}, ends(j), mode(flags) { ++*this; }
         const Irange<utf_iterator>& operator*() const noexcept { return seg; }
         BasicSegmentIterator& operator++() noexcept;
         bool operator==(const BasicSegmentIterator& rhs) const noexcept { return seg.begin() == rhs.seg.begin(); }
     private:
-        static constexpr size_t initsize = 16;
         Irange<utf_iterator> seg;  // Iterator pair marking current segment
-        size_t len = 0;            // Length of segment
         utf_iterator ends;         // End of source string
-        utf_iterator next;         // End of buffer contents
-        std::deque<Property> buf;  // Property lookahead buffer
-        size_t bufsize = 0;        // Current lookahead limit
         uint32_t mode = 0;         // Mode flags
         bool select_segment() const noexcept;
     };
 
-    template <typename C, typename Property, UnicornDetail::PropertyQuery<Property> PQ, UnicornDetail::SegmentFunction<Property> SF>
-    BasicSegmentIterator<C, Property, PQ, SF>& BasicSegmentIterator<C, Property, PQ, SF>::operator++() noexcept {
+    template <typename U, UnicornDetail::SegmentStep SS>
+    BasicSegmentIterator<U, SS>& BasicSegmentIterator<U, SS>::operator++() noexcept {
+        using namespace UnicornDetail;
         do {
             seg.first = seg.second;
             if (seg.first == ends)
                 break;
-            buf.erase(buf.begin(), buf.begin() + len);
-            for (;;) {
-                while (next != ends && buf.size() < bufsize)
-                    buf.push_back(PQ(*next++));
-                len = SF(buf, next == ends);
-                if (len || next == ends)
+            // Run the state machine until it dies, breaking after the last
+            // accepting state (the first character is always accepted)
+            int state = segment_start;
+            for (auto i = seg.first; i != ends;) {
+                state = SS(state, *i);
+                if (state == 0)
                     break;
-                bufsize += initsize;
+                ++i;
+                if (state & segment_accept)
+                    seg.second = i;
             }
-            if (len == 0)
-                seg.second = ends;
-            else
-                std::advance(seg.second, len);
         } while (! select_segment());
         return *this;
     }
 
-    template <typename C, typename Property, UnicornDetail::PropertyQuery<Property> PQ, UnicornDetail::SegmentFunction<Property> SF>
-    bool BasicSegmentIterator<C, Property, PQ, SF>::select_segment() const noexcept {
+    template <typename U, UnicornDetail::SegmentStep SS>
+    bool BasicSegmentIterator<U, SS>::select_segment() const noexcept {
         if (mode & Segment::graphic)
             return std::find_if_not(seg.begin(), seg.end(), char_is_white_space) != seg.end();
         else if (mode & Segment::alpha)
@@ -97,7 +102,9 @@ namespace RS::Unicorn {
 
     // Grapheme cluster boundaries
 
-    template <typename C> using GraphemeIterator = BasicSegmentIterator<C, Grapheme_Cluster_Break, grapheme_cluster_break, UnicornDetail::find_grapheme_break>;
+    template <typename C> using GraphemeIterator = BasicSegmentIterator<UtfIterator<C>, UnicornDetail::grapheme_break_step>;
+    template <typename C> using GraphemeViewIterator = BasicSegmentIterator<UtfViewIterator<C>, UnicornDetail::grapheme_break_step>;
+    template <typename C, uint32_t F = Utf::ignore> using GraphemeLeanIterator = BasicSegmentIterator<UtfLeanIterator<C, F>, UnicornDetail::grapheme_break_step>;
 
     template <typename C> Irange<GraphemeIterator<C>>
     grapheme_range(const UtfIterator<C>& i, const UtfIterator<C>& j) {
@@ -114,9 +121,38 @@ namespace RS::Unicorn {
         return grapheme_range(utf_range(source));
     }
 
+    template <typename C> Irange<GraphemeViewIterator<C>>
+    grapheme_range(const UtfViewIterator<C>& i, const UtfViewIterator<C>& j) {
+        return {{i, j, {}}, {j, j, {}}};
+    }
+
+    template <typename C> Irange<GraphemeViewIterator<C>>
+    grapheme_range(const Irange<UtfViewIterator<C>>& source) {
+        return grapheme_range(source.begin(), source.end());
+    }
+
+    template <typename C> Irange<GraphemeViewIterator<C>>
+    grapheme_range(std::basic_string_view<C> source) {
+        return grapheme_range(utf_range(source));
+    }
+
+    template <typename C, uint32_t F> Irange<GraphemeLeanIterator<C, F>>
+    grapheme_range(const UtfLeanIterator<C, F>& i, const UtfLeanIterator<C, F>& j) {
+        return {{i, j, {}}, {j, j, {}}};
+    }
+
+    template <typename C, uint32_t F> Irange<GraphemeLeanIterator<C, F>>
+    grapheme_range(const Irange<UtfLeanIterator<C, F>>& source) {
+        return grapheme_range(source.begin(), source.end());
+    }
+
+    void grapheme_boundaries(std::string_view src, std::vector<uint32_t>& out);
+
     // Word boundaries
 
-    template <typename C> using WordIterator = BasicSegmentIterator<C, Word_Break, word_break, UnicornDetail::find_word_break>;
+    template <typename C> using WordIterator = BasicSegmentIterator<UtfIterator<C>, UnicornDetail::word_break_step>;
+    template <typename C> using WordViewIterator = BasicSegmentIterator<UtfViewIterator<C>, UnicornDetail::word_break_step>;
+    template <typename C, uint32_t F = Utf::ignore> using WordLeanIterator = BasicSegmentIterator<UtfLeanIterator<C, F>, UnicornDetail::word_break_step>;
 
     template <typename C> Irange<WordIterator<C>>
     word_range(const UtfIterator<C>& i, const UtfIterator<C>& j, uint32_t flags = 0) {
@@ -135,9 +171,43 @@ namespace RS::Unicorn {
         return word_range(utf_range(source), flags);
     }
 
+    template <typename C> Irange<WordViewIterator<C>>
+    word_range(const UtfViewIterator<C>& i, const UtfViewIterator<C>& j, uint32_t flags = 0) {
+        if (popcount(flags & (Segment::unicode | Segment::graphic | Segment::alpha)) > 1)
+            throw std::invalid_argument("Inconsistent word breaking flags");
+        return {{i, j, flags}, {j, j, flags}};
+    }
+
+    template <typename C> Irange<WordViewIterator<C>>
+    word_range(const Irange<UtfViewIterator<C>>& source, uint32_t flags = 0) {
+        return word_range(source.begin(), source.end(), flags);
+    }
+
+    template <typename C> Irange<WordViewIterator<C>>
+    word_range(std::basic_string_view<C> source, uint32_t flags = 0) {
+        return word_range(utf_range(source), flags);
+    }
+
+    template <typename C, uint32_t F> Irange<WordLeanIterator<C, F>>
+    word_range(const UtfLeanIterator<C, F>& i, const UtfLeanIterator<C, F>& j, uint32_t flags = 0) {
+        if (popcount(flags & (Segment::unicode | Segment::graphic | Segment::alpha)) > 1)
+            throw std::invalid_argument("Inconsistent word breaking flags");
+        return {{i, j, flags}, {j, j, flags}};
+    }
+
+    template <typename C, uint32_t F> Irange<WordLeanIterator<C, F>>
+    word_range(const Irange<UtfLeanIterator<C, F>>& source, uint32_t flags = 0) {
+        return word_range(source.begin(), source.end(), flags);
+    }
+
+    std::vector<size_t> parallel_word_breaks(const Ustring& src, size_t threads = 0);
+    void word_boundaries(std::string_view src, std::vector<uint32_t>& out, uint32_t flags = 0);
+
     // Sentence boundaries
 
-    template <typename C> using SentenceIterator = BasicSegmentIterator<C, Sentence_Break, sentence_break, UnicornDetail::find_sentence_break>;
+    template <typename C> using SentenceIterator = BasicSegmentIterator<UtfIterator<C>, UnicornDetail::sentence_break_step>;
+    template <typename C> using SentenceViewIterator = BasicSegmentIterator<UtfViewIterator<C>, UnicornDetail::sentence_break_step>;
+    template <typename C, uint32_t F = Utf::ignore> using SentenceLeanIterator = BasicSegmentIterator<UtfLeanIterator<C, F>, UnicornDetail::sentence_break_step>;
 
     template <typename C> Irange<SentenceIterator<C>>
     sentence_range(const UtfIterator<C>& i, const UtfIterator<C>& j) {
@@ -154,6 +224,73 @@ namespace RS::Unicorn {
         return sentence_range(utf_range(source));
     }
 
+    template <typename C> Irange<SentenceViewIterator<C>>
+    sentence_range(const UtfViewIterator<C>& i, const UtfViewIterator<C>& j) {
+        return {{i, j, {}}, {j, j, {}}};
+    }
+
+    template <typename C> Irange<SentenceViewIterator<C>>
+    sentence_range(const Irange<UtfViewIterator<C>>& source) {
+        return sentence_range(source.begin(), source.end());
+    }
+
+    template <typename C> Irange<SentenceViewIterator<C>>
+    sentence_range(std::basic_string_view<C> source) {
+        return sentence_range(utf_range(source));
+    }
+
+    template <typename C, uint32_t F> Irange<SentenceLeanIterator<C, F>>
+    sentence_range(const UtfLeanIterator<C, F>& i, const UtfLeanIterator<C, F>& j) {
+        return {{i, j, {}}, {j, j, {}}};
+    }
+
+    template <typename C, uint32_t F> Irange<SentenceLeanIterator<C, F>>
+    sentence_range(const Irange<UtfLeanIterator<C, F>>& source) {
+        return sentence_range(source.begin(), source.end());
+    }
+
+    void sentence_boundaries(std::string_view src, std::vector<uint32_t>& out);
+
+    // Line break opportunities
+
+    template <typename C>
+    class LineBreakIterator:
+    public ForwardIterator<LineBreakIterator<C>, const Irange<UtfIterator<C>>> {
+    public:
+        using utf_iterator = UtfIterator<C>;
+        LineBreakIterator() noexcept {}
+        LineBreakIterator(const utf_iterator& i, const utf_iterator& j): base(i, j, 0) {}
+        const Irange<utf_iterator>& operator*() const noexcept { return *base; }
+        LineBreakIterator& operator++() noexcept { ++base; return *this; }
+        bool operator==(const LineBreakIterator& rhs) const noexcept { return base == rhs.base; }
+        bool mandatory() const noexcept;
+    private:
+        BasicSegmentIterator<UtfIterator<C>, UnicornDetail::line_break_step> base;
+    };
+
+    template <typename C>
+    bool LineBreakIterator<C>::mandatory() const noexcept {
+        if (base->empty())
+            return false;
+        auto lb = line_break(*std::prev(base->end()));
+        return lb == Line_Break::BK || lb == Line_Break::CR || lb == Line_Break::LF || lb == Line_Break::NL;
+    }
+
+    template <typename C> Irange<LineBreakIterator<C>>
+    line_break_range(const UtfIterator<C>& i, const UtfIterator<C>& j) {
+        return {{i, j}, {j, j}};
+    }
+
+    template <typename C> Irange<LineBreakIterator<C>>
+    line_break_range(const Irange<UtfIterator<C>>& source) {
+        return line_break_range(source.begin(), source.end());
+    }
+
+    template <typename C> Irange<LineBreakIterator<C>>
+    line_break_range(const std::basic_string<C>& source) {
+        return line_break_range(utf_range(source));
+    }
+
     // Common base template for line and paragraph iterators
 
     namespace UnicornDetail {
@@ -286,6 +423,8 @@ namespace RS::Unicorn {
         return line_range(utf_range(source), flags);
     }
 
+    void line_boundaries(std::string_view src, std::vector<uint32_t>& out, uint32_t flags = 0);
+
     // Paragraph boundaries
 
     template <typename C> using ParagraphIterator = BlockSegmentIterator<C>;
@@ -316,4 +455,6 @@ namespace RS::Unicorn {
         return paragraph_range(utf_range(source), flags);
     }
 
+    void paragraph_boundaries(std::string_view src, std::vector<uint32_t>& out, uint32_t flags = 0);
+
 }
@@ -119,4 +119,21 @@ void test_unicorn_string_case_conversions() {
     s = "ǅǅǅ ǅǅǅ";        TRY(str_initial_titlecase_in(s));  TEST_EQUAL(s, "ǅǅǅ ǅǅǅ");
     s = "ǆǆǆ ǆǆǆ";        TRY(str_initial_titlecase_in(s));  TEST_EQUAL(s, "ǅǆǆ ǆǆǆ");
 
+    TEST_EQUAL(str_uppercase("Hello wörld ßtraße"s), "HELLO WÖRLD SSTRASSE");
+    TEST_EQUAL(str_lowercase("Hello WÖRLD"s), "hello wörld");
+    TEST_EQUAL(str_casefold("Hello WÖRLD ß"s), "hello wörld ss");
+    TEST_EQUAL(str_lowercase("ABCΣ"s), "abcς");
+    TEST_EQUAL(str_lowercase("A.Σ"s), "a.ς");
+    TEST_EQUAL(str_lowercase("A Σ"s), "a σ");
+    TEST_EQUAL(str_lowercase("AΣB"s), "aσb");
+
+    std::string_view v = "(hello wörld ß)";
+    TEST_EQUAL(str_uppercase(v.substr(1, 12)), "HELLO WÖRLD");
+    TEST_EQUAL(str_lowercase(v.substr(1, 12)), "hello wörld");
+    TEST_EQUAL(str_titlecase(v.substr(1, 12)), "Hello Wörld");
+    TEST_EQUAL(str_casefold(v.substr(7)), "wörld ss)");
+    TEST_EQUAL(str_initial_titlecase(v.substr(8, 5)), "Örld");
+    TEST_EQUAL(str_case(v.substr(1, 5), Case::none), "hello");
+    TEST_EQUAL(str_case(v.substr(1, 5), Case::upper), "HELLO");
+
 }
@@ -5,15 +5,38 @@ namespace RS::Unicorn {
 
     namespace {
 
+        constexpr char ascii_upper(char c) noexcept { return c >= 'a' && c <= 'z' ? char(c - 32) : c; }
+        constexpr char ascii_lower(char c) noexcept { return c >= 'A' && c <= 'Z' ? char(c + 32) : c; }
+        constexpr bool ascii_is_cased(char c) noexcept { return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z'); }
+
+        // ASCII characters that are Case_Ignorable (Word_Break=MidLetter,
+        // MidNumLet, or Single_Quote, or General_Category=Sk)
+
+        constexpr bool ascii_is_case_ignorable(char c) noexcept { return c == '\'' || c == '.' || c == ':' || c == '^' || c == '`'; }
+
+        // Case mapping is trivial for ASCII; only characters beyond that
+        // need the full mapping tables.
+
         template <typename F>
-        const Ustring casemap_helper(const Ustring& src, F f) {
+        Ustring casemap_helper(std::string_view src, F f, char (*af)(char)) {
+            using namespace UnicornDetail;
             Ustring dst;
+            dst.reserve(src.size());
             char32_t buf[max_case_decomposition];
-            auto out = utf_writer(dst);
-            for (auto c: utf_range(src)) {
-                auto n = f(c, buf);
-                std::copy_n(buf, n, out);
+            UtfAppender<char, Utf::ignore> out(dst);
+            size_t pos = 0, size = src.size();
+            while (pos < size) {
+                size_t n = ascii_prefix(src.data() + pos, size - pos);
+                for (size_t end = pos + n; pos < end; ++pos)
+                    out.put_unit(af(src[pos]));
+                if (pos == size)
+                    break;
+                char32_t c = 0;
+                pos += UtfEncoding<char>::decode_fast(src.data() + pos, size - pos, c);
+                auto m = f(c, buf);
+                out.put(buf, m);
             }
+            out.flush();
             return dst;
         }
 
@@ -21,9 +44,11 @@ namespace RS::Unicorn {
         bool next_cased(FwdIter i, FwdIter e) {
             if (i == e)
                 return false;
-            for (++i; i != e; ++i)
-                if (! char_is_case_ignorable(*i))
-                    return char_is_cased(*i);
+            for (++i; i != e; ++i) {
+                auto props = char_props(*i);
+                if (! props.is_case_ignorable())
+                    return props.is_cased();
+            }
             return false;
         }
 
@@ -32,43 +57,60 @@ namespace RS::Unicorn {
             static constexpr char32_t final_sigma = 0x3c2;
             bool last_cased = false;
             char32_t buf[max_case_decomposition];
-            template <typename FwdIter, typename OutIter> void convert(FwdIter i, FwdIter e, OutIter to) {
+            template <typename FwdIter> void convert(FwdIter i, FwdIter e, UtfAppender<char, Utf::ignore>& to) {
                 auto n = char_to_full_lowercase(*i, buf);
                 if (buf[0] == sigma && last_cased && ! next_cased(i, e))
                     buf[0] = final_sigma;
-                std::copy_n(buf, n, to);
-                if (! char_is_case_ignorable(*i))
-                    last_cased = char_is_cased(*i);
+                to.put(buf, n);
+                auto props = char_props(*i);
+                if (! props.is_case_ignorable())
+                    last_cased = props.is_cased();
             }
         };
 
     }
 
-    Ustring str_uppercase(const Ustring& str) {
-        return casemap_helper(str, char_to_full_uppercase);
+    Ustring str_uppercase(std::string_view str) {
+        return casemap_helper(str, char_to_full_uppercase, ascii_upper);
     }
 
-    Ustring str_lowercase(const Ustring& str) {
+    Ustring str_lowercase(std::string_view str) {
+        using namespace UnicornDetail;
         Ustring dst;
+        dst.reserve(str.size());
         LowerChar lc;
-        auto range = utf_range(str);
-        auto out = utf_writer(dst);
-        for (auto i = range.begin(), e = range.end(); i != e; ++i)
+        UtfAppender<char, Utf::ignore> out(dst);
+        auto e = utf_end(str);
+        size_t pos = 0, size = str.size();
+        while (pos < size) {
+            size_t n = ascii_prefix(str.data() + pos, size - pos);
+            for (size_t end = pos + n; pos < end; ++pos) {
+                char c = str[pos];
+                out.put_unit(ascii_lower(c));
+                if (! ascii_is_case_ignorable(c))
+                    lc.last_cased = ascii_is_cased(c);
+            }
+            if (pos == size)
+                break;
+            auto i = utf_iterator(str, pos);
             lc.convert(i, e, out);
+            pos = (++i).offset();
+        }
+        out.flush();
         return dst;
     }
 
-    Ustring str_titlecase(const Ustring& str) {
+    Ustring str_titlecase(std::string_view str) {
         Ustring dst;
         LowerChar lc;
         auto e = utf_end(str);
-        auto out = utf_writer(dst);
+        UtfAppender<char, Utf::ignore> out(dst);
         for (auto& w: word_range(str)) {
             bool initial = true;
             for (auto i = w.begin(); i != w.end(); ++i) {
                 if (initial && char_is_cased(*i)) {
                     auto n = char_to_full_titlecase(*i, lc.buf);
-                    std::copy_n(lc.buf, n, out);
+                    out.put(lc.buf, n);
                     lc.last_cased = true;
                     initial = false;
                 } else {
@@ -76,24 +118,25 @@ namespace RS::Unicorn {
                 }
             }
         }
+        out.flush();
         return dst;
     }
 
-    Ustring str_casefold(const Ustring& str) {
-        return casemap_helper(str, char_to_full_casefold);
+    Ustring str_casefold(std::string_view str) {
+        return casemap_helper(str, char_to_full_casefold, ascii_lower);
     }
 
-    Ustring str_case(const Ustring& str, Case c) {
+    Ustring str_case(std::string_view str, Case c) {
         switch (c) {
             case Case::fold:   return str_casefold(str);
             case Case::lower:  return str_lowercase(str);
             case Case::title:  return str_titlecase(str);
             case Case::upper:  return str_uppercase(str);
-            default:           return str;
+            default:           return Ustring(str);
         }
     }
 
-    Ustring str_initial_titlecase(const Ustring& str) {
+    Ustring str_initial_titlecase(std::string_view str) {
         if (str.empty())
             return {};
         auto i = utf_begin(str);
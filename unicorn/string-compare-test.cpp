@@ -166,6 +166,12 @@ void test_unicorn_string_compare_icase() {
     TEST_EQUAL(cmp_tif("hello world"s, "HELLO!WORLD"s), -1);
     TEST_EQUAL(cmp_tif("HELLO WORLD"s, "hello!world"s), -1);
 
+    TEST_EQUAL(cmp_ti("hello wörld"s, "HELLO WÖRLD"s), 0);
+    TEST_EQUAL(cmp_ti("HELLO ß"s, "hello ss"s), 0);
+    TEST_EQUAL(cmp_ti("abc"s, "ABCé"s), -1);
+    TEST_EQUAL(cmp_ti("ABCé"s, "abc"s), 1);
+    TEST_EQUAL(cmp_ti("abcé"s, "ABCÉ"s), 0);
+
 }
 
 void test_unicorn_string_compare_natural() {
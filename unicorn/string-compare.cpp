@@ -9,6 +9,10 @@ namespace RS::Unicorn {
             return c >= U'0' && c <= U'9';
         }
 
+        char32_t ascii_casefold(char c) noexcept {
+            return c >= 'A' && c <= 'Z' ? char32_t(c + 32) : char32_t(c);
+        }
+
         bool char_is_significant(char32_t c) noexcept {
             char cat = char_primary_category(c);
             return cat == 'L' || cat == 'M' || cat == 'N' || cat == 'S';
@@ -91,9 +95,18 @@ namespace RS::Unicorn {
         }
 
         int do_compare_icase(const Ustring& lhs, const Ustring& rhs) {
-            if (lhs.empty() || rhs.empty())
-                return ! rhs.empty() ? -1 : ! lhs.empty() ? 1 : 0;
-            auto u1 = utf_range(lhs), u2 = utf_range(rhs);
+            // ASCII characters fold to a single lower case character, so
+            // matching ASCII prefixes can be compared byte by byte
+            size_t ascii = std::min(ascii_prefix(lhs.data(), lhs.size()), ascii_prefix(rhs.data(), rhs.size()));
+            size_t pos = 0;
+            for (; pos < ascii; ++pos) {
+                char32_t c1 = ascii_casefold(lhs[pos]), c2 = ascii_casefold(rhs[pos]);
+                if (c1 != c2)
+                    return c1 < c2 ? -1 : 1;
+            }
+            if (pos == lhs.size() || pos == rhs.size())
+                return pos < rhs.size() ? -1 : pos < lhs.size() ? 1 : 0;
+            auto u1 = irange(utf_iterator(lhs, pos), utf_end(lhs)), u2 = irange(utf_iterator(rhs, pos), utf_end(rhs));
             auto i1 = u1.begin(), i2 = u2.begin();
             char32_t buf1[max_case_decomposition], buf2[max_case_decomposition];
             size_t p1 = 0, p2 = 0;
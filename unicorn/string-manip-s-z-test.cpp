@@ -163,6 +163,9 @@ void test_unicorn_string_manip_squeeze() {
     s = "/*-+Hello/*-+world/*-+"s;                           TRY(str_squeeze_trim_in(s, "+-*/"s));  TEST_EQUAL(s, "Hello+world"s);
     s = "∇∃∀€uro∇∃∀∈lement∇∃∀"s;                             TRY(str_squeeze_trim_in(s, "∀∃∇"s));   TEST_EQUAL(s, "€uro∀∈lement"s);
 
+    TEST_EQUAL(str_squeeze("a \u3000 b\u2028"s), "a b ");
+    TEST_EQUAL(str_squeeze_trim("\u3000 a \u3000 b \u2028"s), "a b");
+
 }
 
 void test_unicorn_string_manip_substring() {
@@ -361,6 +364,12 @@ void test_unicorn_string_manip_trim() {
     s = "≤≤≤€uro≥≥≥";                TRY(str_trim_right_in(s, "≤≥"));  TEST_EQUAL(s, "≤≤≤€uro");
     s = "≤≤≤€uro≥≥≥ ≤≤≤∈lement≥≥≥";  TRY(str_trim_right_in(s, "≤≥"));  TEST_EQUAL(s, "≤≤≤€uro≥≥≥ ≤≤≤∈lement");
 
+    TEST_EQUAL(str_trim("\t x \u3000"s), "x");
+    TEST_EQUAL(str_trim("\u3000 x\u00a0y \u3000 "s), "x\u00a0y");
+    TEST_EQUAL(str_trim_left("\u3000 x \u3000"s), "x \u3000");
+    TEST_EQUAL(str_trim_right("\u3000 x \u3000 \t"s), "\u3000 x");
+    s = " \u3000x\u3000 ";  TRY(str_trim_in(s));  TEST_EQUAL(s, "x");
+
 }
 
 void test_unicorn_string_manip_trim_if() {
@@ -616,4 +625,34 @@ void test_unicorn_string_manip_wrap() {
     TRY(str_wrap_in(s, Wrap::preserve, Wrap::width=40));
     TEST_EQUAL(s, t);
 
+    s = "Hello-world, state-of-the-art (wrapping) test";
+    t =
+        //...:....1....:....2
+        "Hello-world,\n"
+        "state-of-\n"
+        "the-art\n"
+        "(wrapping)\n"
+        "test\n";
+    TEST_EQUAL(str_wrap(s, Wrap::width=12), t);
+
+    s = "\u65e5\u672c\u8a9e\u306e\u30c6\u30ad\u30b9\u30c8\u3067\u3059\u3002";
+    t =
+        "\u65e5\u672c\u8a9e\u306e\u30c6\n"
+        "\u30ad\u30b9\u30c8\u3067\n"
+        "\u3059\u3002\n";
+    TEST_EQUAL(str_wrap(s, Wrap::width=5), t);
+    t =
+        "\u65e5\u672c\u8a9e\u306e\u30c6\n"
+        "\u30ad\u30b9\u30c8\u3067\n"
+        "\u3059\u3002\n";
+    TEST_EQUAL(str_wrap(s, Wrap::width=10, Wrap::flags=Length::wide), t);
+
+    // Whitespace inside a line breaking segment is collapsed too
+    TEST_EQUAL(str_wrap("Hello  !"s), "Hello !\n");
+    TEST_EQUAL(str_wrap("Hello\t!"s), "Hello !\n");
+    TEST_EQUAL(str_wrap("( x"s), "( x\n");
+    TEST_EQUAL(str_wrap("x (   y z"s), "x ( y z\n");
+    TEST_EQUAL(str_wrap("\u040c\t\u1e97\u200d"s), "\u040c \u1e97\u200d\n");
+    TEST_EQUAL(str_wrap("abc (   def ghi"s, Wrap::width=9), "abc ( def\nghi\n");
+
 }
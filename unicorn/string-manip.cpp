@@ -56,19 +56,72 @@ namespace RS::Unicorn {
             }
         }
 
+        // White space in ASCII is HT, LF, VT, FF, CR, and space
+
+        constexpr bool ascii_is_white_space(char c) noexcept { return c == ' ' || (c >= '\t' && c <= '\r'); }
+
+        // Classify the character at pos without decoding it if it's ASCII
+
+        bool white_space_at(const Ustring& str, size_t pos, size_t& units) noexcept {
+            if (uint8_t(str[pos]) <= 0x7f) {
+                units = 1;
+                return ascii_is_white_space(str[pos]);
+            }
+            char32_t c = 0;
+            units = UnicornDetail::UtfEncoding<char>::decode_fast(str.data() + pos, str.size() - pos, c);
+            return char_is_white_space(c);
+        }
+
+        // Byte offsets of the string with leading and/or trailing white
+        // space removed
+
+        std::pair<size_t, size_t> trim_white_space(const Ustring& str, int mode) {
+            using namespace UnicornDetail;
+            size_t i = 0, j = str.size(), units = 0;
+            if (mode & trimleft)
+                while (i < j && white_space_at(str, i, units))
+                    i += units;
+            if (mode & trimright) {
+                while (j > i && uint8_t(str[j - 1]) <= 0x7f && ascii_is_white_space(str[j - 1]))
+                    --j;
+                if (j > i && uint8_t(str[j - 1]) > 0x7f) {
+                    auto b = utf_iterator(str, i), k = utf_iterator(str, j);
+                    while (k != b) {
+                        --k;
+                        if (! char_is_white_space(*k)) {
+                            ++k;
+                            break;
+                        }
+                    }
+                    j = k.offset();
+                }
+            }
+            return {i, j};
+        }
+
         void squeeze_helper(const Ustring& src, Ustring& dst, bool trim) {
-            auto i = utf_begin(src), end = utf_end(src);
-            if (trim)
-                i = std::find_if_not(i, end, char_is_white_space);
-            while (i != end) {
-                auto j = std::find_if(i, end, char_is_white_space);
-                str_append(dst, i, j);
-                if (j == end)
-                    break;
-                i = std::find_if_not(j, end, char_is_white_space);
-                if (! trim || i != end)
-                    dst += ' ';
+            size_t pos = 0, size = src.size(), start = 0, units = 0;
+            bool started = ! trim, space = false;
+            dst.reserve(size);
+            while (pos < size) {
+                if (white_space_at(src, pos, units)) {
+                    if (start < pos)
+                        dst.append(src, start, pos - start);
+                    space = started;
+                    pos += units;
+                    start = pos;
+                } else {
+                    if (space && start == pos)
+                        dst += ' ';
+                    space = false;
+                    started = true;
+                    pos += units;
+                }
             }
+            if (start < size)
+                dst.append(src, start, size - start);
+            else if (space && ! trim)
+                dst += ' ';
         }
 
         void squeeze_helper(const Ustring& src, Ustring& dst, bool trim, const Ustring& chars) {
@@ -674,7 +727,8 @@ namespace RS::Unicorn {
     }
 
     Ustring str_trim(const Ustring& str) {
-        return str_trim_if(str, char_is_white_space);
+        auto range = trim_white_space(str, UnicornDetail::trimleft | UnicornDetail::trimright);
+        return str.substr(range.first, range.second - range.first);
     }
 
     Ustring str_trim_left(const Ustring& str, const Ustring& chars) {
@@ -682,7 +736,8 @@ namespace RS::Unicorn {
     }
 
     Ustring str_trim_left(const Ustring& str) {
-        return str_trim_left_if(str, char_is_white_space);
+        auto range = trim_white_space(str, UnicornDetail::trimleft);
+        return str.substr(range.first, range.second - range.first);
     }
 
     Ustring str_trim_right(const Ustring& str, const Ustring& chars) {
@@ -690,7 +745,8 @@ namespace RS::Unicorn {
     }
 
     Ustring str_trim_right(const Ustring& str) {
-        return str_trim_right_if(str, char_is_white_space);
+        auto range = trim_white_space(str, UnicornDetail::trimright);
+        return str.substr(range.first, range.second - range.first);
     }
 
     void str_trim_in(Ustring& str, const Ustring& chars) {
@@ -698,7 +754,9 @@ namespace RS::Unicorn {
     }
 
     void str_trim_in(Ustring& str) {
-        str_trim_in_if(str, char_is_white_space);
+        auto range = trim_white_space(str, UnicornDetail::trimleft | UnicornDetail::trimright);
+        str.erase(range.second, npos);
+        str.erase(0, range.first);
     }
 
     void str_trim_left_in(Ustring& str, const Ustring& chars) {
@@ -706,7 +764,9 @@ namespace RS::Unicorn {
     }
 
     void str_trim_left_in(Ustring& str) {
-        str_trim_left_in_if(str, char_is_white_space);
+        auto range = trim_white_space(str, UnicornDetail::trimleft);
+        str.erase(range.second, npos);
+        str.erase(0, range.first);
     }
 
     void str_trim_right_in(Ustring& str, const Ustring& chars) {
@@ -714,7 +774,9 @@ namespace RS::Unicorn {
     }
 
     void str_trim_right_in(Ustring& str) {
-        str_trim_right_in_if(str, char_is_white_space);
+        auto range = trim_white_space(str, UnicornDetail::trimright);
+        str.erase(range.second, npos);
+        str.erase(0, range.first);
     }
 
     Ustring str_unify_lines(const Ustring& str, const Ustring& newline) {
@@ -780,13 +842,25 @@ namespace RS::Unicorn {
 
     void Wrap::do_wrap(const Ustring& src, Ustring& dst) const {
         using namespace UnicornDetail;
-        auto i = utf_begin(src), end = utf_end(src);
-        size_t linewidth = 0, words = 0, linebreaks = 0, spaces = margin_, tailspaces = 0;
-        while (i != end) {
-            auto j = std::find_if_not(i, end, char_is_white_space);
-            if (j == end)
-                break;
-            check_whitespace(i, j, linebreaks, tailspaces);
+        Length measure(flags_ & all_length_flags);
+        auto range = line_break_range(src);
+        auto gap = utf_begin(src), end = utf_end(src);
+        size_t linewidth = 0, words = 0, linebreaks = 0, spaces = margin_, tailspaces = 0, skip = 0;
+        Ustring word;
+        for (auto& seg: range) {
+            // Each segment ends at a line break opportunity; the word is the
+            // segment without surrounding whitespace, and gap marks the
+            // whitespace between it and the previous word.
+            if (seg.begin().offset() < skip)
+                continue;
+            auto i = std::find_if_not(seg.begin(), seg.end(), char_is_white_space);
+            if (i == seg.end())
+                continue;
+            auto j = seg.end();
+            do --j;
+                while (char_is_white_space(*j));
+            ++j;
+            check_whitespace(gap, i, linebreaks, tailspaces);
             if (! dst.empty() && linebreaks >= pbreak_) {
                 if (words > 0) {
                     dst += newpara_;
@@ -796,39 +870,52 @@ namespace RS::Unicorn {
                 }
                 spaces = margin_;
             }
-            i = j;
             if (preserve_ && linebreaks >= 1 && tailspaces >= 1) {
                 if (words > 0)
                     dst += newline_;
                 dst.append(tailspaces, ' ');
-                j = std::find_if(i, end, char_is_line_break);
-                dst += str_unify_lines(u_str(i, j), newline_);
+                gap = std::find_if(i, end, char_is_line_break);
+                dst += str_unify_lines(u_str(i, gap), newline_);
                 words = linewidth = 0;
-            } else {
-                j = std::find_if(i, end, char_is_white_space);
-                auto word = u_str(i, j);
-                auto wordlen = str_length(word, flags_ & all_length_flags);
-                if (words > 0) {
-                    if (linewidth + wordlen + spacing_ > size_t(width_)) {
-                        dst += newline_;
-                        words = linewidth = 0;
-                    } else {
-                        dst += ' ';
-                        linewidth += spacing_;
-                    }
-                }
-                if (words == 0) {
-                    dst.append(spaces, ' ');
-                    linewidth = spaces * spacing_;
-                    spaces = margin2_;
+                skip = gap.offset();
+                continue;
+            }
+            // Some line breaking rules keep whitespace inside a segment
+            // (e.g. before "!" or after "("); collapse each run of it to a
+            // single space, the same as the whitespace between segments
+            word.clear();
+            size_t wordlen = 0;
+            for (auto k = i;;) {
+                auto w = std::find_if(k, j, char_is_white_space);
+                word.append(src, k.offset(), w.offset() - k.offset());
+                wordlen += measure(k, w);
+                if (w == j)
+                    break;
+                k = std::find_if_not(w, j, char_is_white_space);
+                word += ' ';
+                wordlen += spacing_;
+            }
+            if (words > 0) {
+                size_t space = gap == i ? 0 : spacing_;
+                if (linewidth + space + wordlen > size_t(width_)) {
+                    dst += newline_;
+                    words = linewidth = 0;
+                } else if (space) {
+                    dst += ' ';
+                    linewidth += space;
                 }
-                dst += word;
-                ++words;
-                linewidth += wordlen;
-                if (enforce_ && linewidth > size_t(width_))
-                    throw std::length_error("Word is too long for wrapping width");
             }
-            i = j;
+            if (words == 0) {
+                dst.append(spaces, ' ');
+                linewidth = spaces * spacing_;
+                spaces = margin2_;
+            }
+            dst += word;
+            ++words;
+            linewidth += wordlen;
+            if (enforce_ && linewidth > size_t(width_))
+                throw std::length_error("Word is too long for wrapping width");
+            gap = j;
         }
         if (words > 0)
             dst += newline_;
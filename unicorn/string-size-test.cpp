@@ -246,6 +246,22 @@ void test_unicorn_string_size_measurement_flags() {
     TEST_EQUAL(str_length(s8, Length::graphemes | Length::narrow), 10);
     TEST_EQUAL(str_length(s8, Length::graphemes | Length::wide), 10);
 
+    TEST_EQUAL(str_length("abc\r\nxe\u0301"s, Length::graphemes), 6);
+    TEST_EQUAL(str_length("abc\r\n\u0301"s, Length::graphemes), 4);
+    TEST_EQUAL(str_length("abc\r\n\u0301"s, Length::characters), 6);
+    TEST_EQUAL(str_length("abc\r\n\u0301"s, Length::narrow), 5);
+    TEST_EQUAL(str_length("abc\u3000"s, Length::graphemes | Length::narrow), 5);
+
+    TEST_EQUAL(str_length(""sv, Length::characters), 0);
+    TEST_EQUAL(str_length(std::string_view(utf8_example), Length::characters), 4);
+    TEST_EQUAL(str_length(std::string_view(utf8_example).substr(2, 7), Length::characters), 2);
+    TEST_EQUAL(str_length(std::u16string_view(utf16_example), Length::characters), 4);
+    TEST_EQUAL(str_length("a\u0301e\u0301i\u0301o\u0301u\u0301"sv, Length::graphemes), 5);
+    TEST_EQUAL(str_length("\ufe00Hello \ufe01world"sv, Length::graphemes), 11);
+    TEST_EQUAL(str_length("abc\r\n\u0301"sv, Length::narrow), 5);
+    TEST_EQUAL(str_length("abc\u3000"sv.substr(0, 3), Length::graphemes | Length::narrow), 3);
+    TEST_EQUAL(str_length(utf_range("Hello world"sv)), 11);
+
 }
 
 void test_unicorn_string_size_find_offset() {
@@ -89,6 +89,9 @@ namespace RS::Unicorn {
         template <typename C> size_t operator()(const std::basic_string<C>& str) const;
         template <typename C> size_t operator()(const Irange<UtfIterator<C>>& range) const;
         template <typename C> size_t operator()(const UtfIterator<C>& b, const UtfIterator<C>& e) const;
+        template <typename C> size_t operator()(std::basic_string_view<C> str) const;
+        template <typename C> size_t operator()(const Irange<UtfViewIterator<C>>& range) const;
+        template <typename C> size_t operator()(const UtfViewIterator<C>& b, const UtfViewIterator<C>& e) const;
     };
 
     namespace UnicornDetail {
@@ -97,11 +100,11 @@ namespace RS::Unicorn {
         constexpr auto all_length_flags = Length::characters | Length::graphemes | east_asian_flags;
 
         inline bool char_is_advancing(char32_t c) {
-            return char_general_category(c) != GC::Mn;
+            return char_props(c).general_category() != GC::Mn;
         }
 
-        template <typename C>
-        inline bool grapheme_is_advancing(Irange<UtfIterator<C>> g) {
+        template <typename U>
+        inline bool grapheme_is_advancing(Irange<U> g) {
             return ! g.empty() && char_is_advancing(*g.begin());
         }
 
@@ -117,8 +120,9 @@ namespace RS::Unicorn {
         public:
             explicit EastAsianCount(uint32_t flags) noexcept: count(), fset(flags) { memset(count, 0, sizeof(count)); }
             void add(char32_t c) noexcept {
-                if (char_is_advancing(c))
-                    ++count[unsigned(east_asian_width(c))];
+                auto props = char_props(c);
+                if (props.general_category() != GC::Mn)
+                    ++count[unsigned(props.east_asian_width())];
             }
             size_t get() const noexcept {
                 size_t default_width = fset & Length::wide ? 2 : 1;
@@ -136,9 +140,31 @@ namespace RS::Unicorn {
             uint32_t fset;
         };
 
-        template <typename C>
-        std::pair<UtfIterator<C>, bool> find_position(const Irange<UtfIterator<C>>& range, size_t pos, uint32_t flags = 0) {
-            check_length_flags(flags);
+        // Measure a leading run of ASCII text without going through the
+        // character tables. Returns the number of code units consumed and
+        // sets count to their length. When counting graphemes the last ASCII
+        // character is left out (unless the run is the whole string), since
+        // it may start a cluster that continues past the run.
+
+        inline size_t ascii_length_prefix(const char* src, size_t n, uint32_t flags, size_t& count) noexcept {
+            size_t k = ascii_prefix(src, n);
+            count = k;
+            if (! (flags & Length::graphemes) && (flags & all_length_flags))
+                return k;
+            if (k < n && k > 0) {
+                --k;
+                if (k > 0 && src[k - 1] == '\r' && src[k] == '\n')
+                    --k;
+            }
+            count = k;
+            for (size_t i = 1; i < k; ++i)
+                if (src[i - 1] == '\r' && src[i] == '\n')
+                    --count;
+            return k;
+        }
+
+        template <typename U>
+        std::pair<U, bool> find_position_in(const Irange<U>& range, size_t pos, uint32_t flags) {
             if (pos == 0)
                 return {range.begin(), true};
             if (flags & Length::characters) {
@@ -181,6 +207,20 @@ namespace RS::Unicorn {
             }
         }
 
+        // Unless the caller's iterator is checking for encoding errors, the
+        // search runs on lean iterators, which keep the inner loops in
+        // registers, and the result is converted back.
+
+        template <typename C>
+        std::pair<UtfIterator<C>, bool> find_position(const Irange<UtfIterator<C>>& range, size_t pos, uint32_t flags = 0) {
+            check_length_flags(flags);
+            if (! (range.begin().flags() & Utf::ignore))
+                return find_position_in(range, pos, flags);
+            auto b = range.begin().ptr(), e = range.end().ptr();
+            auto [i, found] = find_position_in(irange(UtfLeanIterator<C>(b, e), UtfLeanIterator<C>(e, e)), pos, flags);
+            return {range.begin().offset_by(i.ptr() - b), found};
+        }
+
     }
 
     inline Length::Length(uint32_t length_flags):
@@ -193,25 +233,51 @@ namespace RS::Unicorn {
         return (*this)(utf_range(str));
     }
 
-    template <typename C>
-    size_t Length::operator()(const Irange<UtfIterator<C>>& range) const {
-        using namespace UnicornDetail;
-        if (flags & Length::characters) {
-            return range_count(range);
-        } else if (flags & east_asian_flags) {
-            EastAsianCount eac(flags);
-            if (flags & Length::graphemes) {
-                for (auto g: grapheme_range(range))
-                    eac.add(*g.begin());
+    namespace UnicornDetail {
+
+        template <typename U>
+        size_t count_length(const Irange<U>& range, uint32_t flags) {
+            if (flags & Length::characters) {
+                return range_count(range);
+            } else if (flags & east_asian_flags) {
+                EastAsianCount eac(flags);
+                if (flags & Length::graphemes) {
+                    for (auto g: grapheme_range(range))
+                        eac.add(*g.begin());
+                } else {
+                    for (auto c: range)
+                        eac.add(c);
+                }
+                return eac.get();
             } else {
-                for (auto c: range)
-                    eac.add(c);
+                auto gr = grapheme_range(range);
+                return std::count_if(gr.begin(), gr.end(), grapheme_is_advancing<U>);
             }
-            return eac.get();
-        } else {
-            auto gr = grapheme_range(range);
-            return std::count_if(gr.begin(), gr.end(), grapheme_is_advancing<C>);
         }
+
+        template <typename U>
+        size_t utf_length(const Irange<U>& range, uint32_t flags) {
+            using C = typename U::code_unit;
+            auto rest = range;
+            size_t prefix = 0;
+            if constexpr (std::is_same_v<C, char>) {
+                size_t begin = range.begin().offset(), size = range.end().offset() - begin;
+                size_t units = ascii_length_prefix(range.begin().source().data() + begin, size, flags, prefix);
+                if (units == size)
+                    return prefix;
+                rest.first = range.begin().offset_by(units);
+            }
+            if (! (range.begin().flags() & Utf::ignore))
+                return prefix + count_length(rest, flags);
+            auto b = rest.begin().ptr(), e = rest.end().ptr();
+            return prefix + count_length(irange(UtfLeanIterator<C>(b, e), UtfLeanIterator<C>(e, e)), flags);
+        }
+
+    }
+
+    template <typename C>
+    size_t Length::operator()(const Irange<UtfIterator<C>>& range) const {
+        return UnicornDetail::utf_length(range, flags);
     }
 
     template <typename C>
@@ -219,6 +285,21 @@ namespace RS::Unicorn {
         return (*this)(irange(b, e));
     }
 
+    template <typename C>
+    size_t Length::operator()(std::basic_string_view<C> str) const {
+        return (*this)(utf_range(str));
+    }
+
+    template <typename C>
+    size_t Length::operator()(const Irange<UtfViewIterator<C>>& range) const {
+        return UnicornDetail::utf_length(range, flags);
+    }
+
+    template <typename C>
+    size_t Length::operator()(const UtfViewIterator<C>& b, const UtfViewIterator<C>& e) const {
+        return (*this)(irange(b, e));
+    }
+
     template <typename C>
     size_t str_length(const std::basic_string<C>& str, uint32_t flags = 0) {
         return Length(flags)(str);
@@ -234,6 +315,21 @@ namespace RS::Unicorn {
         return Length(flags)(b, e);
     }
 
+    template <typename C>
+    size_t str_length(std::basic_string_view<C> str, uint32_t flags = 0) {
+        return Length(flags)(str);
+    }
+
+    template <typename C>
+    size_t str_length(const Irange<UtfViewIterator<C>>& range, uint32_t flags = 0) {
+        return Length(flags)(range);
+    }
+
+    template <typename C>
+    size_t str_length(const UtfViewIterator<C>& b, const UtfViewIterator<C>& e, uint32_t flags = 0) {
+        return Length(flags)(b, e);
+    }
+
     template <typename C>
     UtfIterator<C> str_find_index(const Irange<UtfIterator<C>>& range, size_t pos, uint32_t flags = 0) {
         return UnicornDetail::find_position(range, pos, flags).first;
@@ -838,12 +934,12 @@ namespace RS::Unicorn {
     // Case mapping functions
     // Defined in string-case.cpp
 
-    Ustring str_uppercase(const Ustring& str);
-    Ustring str_lowercase(const Ustring& str);
-    Ustring str_titlecase(const Ustring& str);
-    Ustring str_casefold(const Ustring& str);
-    Ustring str_case(const Ustring& str, Case c);
-    Ustring str_initial_titlecase(const Ustring& str);
+    Ustring str_uppercase(std::string_view str);
+    Ustring str_lowercase(std::string_view str);
+    Ustring str_titlecase(std::string_view str);
+    Ustring str_casefold(std::string_view str);
+    Ustring str_case(std::string_view str, Case c);
+    Ustring str_initial_titlecase(std::string_view str);
     void str_uppercase_in(Ustring& str);
     void str_lowercase_in(Ustring& str);
     void str_titlecase_in(Ustring& str);
@@ -2,484 +2,659 @@
 
 namespace RS::Unicorn::UnicornDetail {
 
-const std::array<KeyValue<char32_t, int>, 474> combining_class_array = {{
-{0x0,0},
-{0x300,230},
-{0x315,232},
-{0x316,220},
-{0x31a,232},
-{0x31b,216},
-{0x31c,220},
-{0x321,202},
-{0x323,220},
-{0x327,202},
-{0x329,220},
-{0x334,1},
-{0x339,220},
-{0x33d,230},
-{0x345,240},
-{0x346,230},
-{0x347,220},
-{0x34a,230},
-{0x34d,220},
-{0x34f,0},
-{0x350,230},
-{0x353,220},
-{0x357,230},
-{0x358,232},
-{0x359,220},
-{0x35b,230},
-{0x35c,233},
-{0x35d,234},
-{0x35f,233},
-{0x360,234},
-{0x362,233},
-{0x363,230},
-{0x370,0},
-{0x483,230},
-{0x488,0},
-{0x591,220},
-{0x592,230},
-{0x596,220},
-{0x597,230},
-{0x59a,222},
-{0x59b,220},
-{0x59c,230},
-{0x5a2,220},
-{0x5a8,230},
-{0x5aa,220},
-{0x5ab,230},
-{0x5ad,222},
-{0x5ae,228},
-{0x5af,230},
-{0x5b0,10},
-{0x5b1,11},
-{0x5b2,12},
-{0x5b3,13},
-{0x5b4,14},
-{0x5b5,15},
-{0x5b6,16},
-{0x5b7,17},
-{0x5b8,18},
-{0x5b9,19},
-{0x5bb,20},
-{0x5bc,21},
-{0x5bd,22},
-{0x5be,0},
-{0x5bf,23},
-{0x5c0,0},
-{0x5c1,24},
-{0x5c2,25},
-{0x5c3,0},
-{0x5c4,230},
-{0x5c5,220},
-{0x5c6,0},
-{0x5c7,18},
-{0x5c8,0},
-{0x610,230},
-{0x618,30},
-{0x619,31},
-{0x61a,32},
-{0x61b,0},
-{0x64b,27},
-{0x64c,28},
-{0x64d,29},
-{0x64e,30},
-{0x64f,31},
-{0x650,32},
-{0x651,33},
-{0x652,34},
-{0x653,230},
-{0x655,220},
-{0x657,230},
-{0x65c,220},
-{0x65d,230},
-{0x65f,220},
-{0x660,0},
-{0x670,35},
-{0x671,0},
-{0x6d6,230},
-{0x6dd,0},
-{0x6df,230},
-{0x6e3,220},
-{0x6e4,230},
-{0x6e5,0},
-{0x6e7,230},
-{0x6e9,0},
-{0x6ea,220},
-{0x6eb,230},
-{0x6ed,220},
-{0x6ee,0},
-{0x711,36},
-{0x712,0},
-{0x730,230},
-{0x731,220},
-{0x732,230},
-{0x734,220},
-{0x735,230},
-{0x737,220},
-{0x73a,230},
-{0x73b,220},
-{0x73d,230},
-{0x73e,220},
-{0x73f,230},
-{0x742,220},
-{0x743,230},
-{0x744,220},
-{0x745,230},
-{0x746,220},
-{0x747,230},
-{0x748,220},
-{0x749,230},
-{0x74b,0},
-{0x7eb,230},
-{0x7f2,220},
-{0x7f3,230},
-{0x7f4,0},
-{0x816,230},
-{0x81a,0},
-{0x81b,230},
-{0x824,0},
-{0x825,230},
-{0x828,0},
-{0x829,230},
-{0x82e,0},
-{0x859,220},
-{0x85c,0},
-{0x8e3,220},
-{0x8e4,230},
-{0x8e6,220},
-{0x8e7,230},
-{0x8e9,220},
-{0x8ea,230},
-{0x8ed,220},
-{0x8f0,27},
-{0x8f1,28},
-{0x8f2,29},
-{0x8f3,230},
-{0x8f6,220},
-{0x8f7,230},
-{0x8f9,220},
-{0x8fb,230},
-{0x900,0},
-{0x93c,7},
-{0x93d,0},
-{0x94d,9},
-{0x94e,0},
-{0x951,230},
-{0x952,220},
-{0x953,230},
-{0x955,0},
-{0x9bc,7},
-{0x9bd,0},
-{0x9cd,9},
-{0x9ce,0},
-{0xa3c,7},
-{0xa3d,0},
-{0xa4d,9},
-{0xa4e,0},
-{0xabc,7},
-{0xabd,0},
-{0xacd,9},
-{0xace,0},
-{0xb3c,7},
-{0xb3d,0},
-{0xb4d,9},
-{0xb4e,0},
-{0xbcd,9},
-{0xbce,0},
-{0xc4d,9},
-{0xc4e,0},
-{0xc55,84},
-{0xc56,91},
-{0xc57,0},
-{0xcbc,7},
-{0xcbd,0},
-{0xccd,9},
-{0xcce,0},
-{0xd4d,9},
-{0xd4e,0},
-{0xdca,9},
-{0xdcb,0},
-{0xe38,103},
-{0xe3a,9},
-{0xe3b,0},
-{0xe48,107},
-{0xe4c,0},
-{0xeb8,118},
-{0xeba,0},
-{0xec8,122},
-{0xecc,0},
-{0xf18,220},
-{0xf1a,0},
-{0xf35,220},
-{0xf36,0},
-{0xf37,220},
-{0xf38,0},
-{0xf39,216},
-{0xf3a,0},
-{0xf71,129},
-{0xf72,130},
-{0xf73,0},
-{0xf74,132},
-{0xf75,0},
-{0xf7a,130},
-{0xf7e,0},
-{0xf80,130},
-{0xf81,0},
-{0xf82,230},
-{0xf84,9},
-{0xf85,0},
-{0xf86,230},
-{0xf88,0},
-{0xfc6,220},
-{0xfc7,0},
-{0x1037,7},
-{0x1038,0},
-{0x1039,9},
-{0x103b,0},
-{0x108d,220},
-{0x108e,0},
-{0x135d,230},
-{0x1360,0},
-{0x1714,9},
-{0x1715,0},
-{0x1734,9},
-{0x1735,0},
-{0x17d2,9},
-{0x17d3,0},
-{0x17dd,230},
-{0x17de,0},
-{0x18a9,228},
-{0x18aa,0},
-{0x1939,222},
-{0x193a,230},
-{0x193b,220},
-{0x193c,0},
-{0x1a17,230},
-{0x1a18,220},
-{0x1a19,0},
-{0x1a60,9},
-{0x1a61,0},
-{0x1a75,230},
-{0x1a7d,0},
-{0x1a7f,220},
-{0x1a80,0},
-{0x1ab0,230},
-{0x1ab5,220},
-{0x1abb,230},
-{0x1abd,220},
-{0x1abe,0},
-{0x1b34,7},
-{0x1b35,0},
-{0x1b44,9},
-{0x1b45,0},
-{0x1b6b,230},
-{0x1b6c,220},
-{0x1b6d,230},
-{0x1b74,0},
-{0x1baa,9},
-{0x1bac,0},
-{0x1be6,7},
-{0x1be7,0},
-{0x1bf2,9},
-{0x1bf4,0},
-{0x1c37,7},
-{0x1c38,0},
-{0x1cd0,230},
-{0x1cd3,0},
-{0x1cd4,1},
-{0x1cd5,220},
-{0x1cda,230},
-{0x1cdc,220},
-{0x1ce0,230},
-{0x1ce1,0},
-{0x1ce2,1},
-{0x1ce9,0},
-{0x1ced,220},
-{0x1cee,0},
-{0x1cf4,230},
-{0x1cf5,0},
-{0x1cf8,230},
-{0x1cfa,0},
-{0x1dc0,230},
-{0x1dc2,220},
-{0x1dc3,230},
-{0x1dca,220},
-{0x1dcb,230},
-{0x1dcd,234},
-{0x1dce,214},
-{0x1dcf,220},
-{0x1dd0,202},
-{0x1dd1,230},
-{0x1df6,0},
-{0x1dfc,233},
-{0x1dfd,220},
-{0x1dfe,230},
-{0x1dff,220},
-{0x1e00,0},
-{0x20d0,230},
-{0x20d2,1},
-{0x20d4,230},
-{0x20d8,1},
-{0x20db,230},
-{0x20dd,0},
-{0x20e1,230},
-{0x20e2,0},
-{0x20e5,1},
-{0x20e7,230},
-{0x20e8,220},
-{0x20e9,230},
-{0x20ea,1},
-{0x20ec,220},
-{0x20f0,230},
-{0x20f1,0},
-{0x2cef,230},
-{0x2cf2,0},
-{0x2d7f,9},
-{0x2d80,0},
-{0x2de0,230},
-{0x2e00,0},
-{0x302a,218},
-{0x302b,228},
-{0x302c,232},
-{0x302d,222},
-{0x302e,224},
-{0x3030,0},
-{0x3099,8},
-{0x309b,0},
-{0xa66f,230},
-{0xa670,0},
-{0xa674,230},
-{0xa67e,0},
-{0xa69e,230},
-{0xa6a0,0},
-{0xa6f0,230},
-{0xa6f2,0},
-{0xa806,9},
-{0xa807,0},
-{0xa8c4,9},
-{0xa8c5,0},
-{0xa8e0,230},
-{0xa8f2,0},
-{0xa92b,220},
-{0xa92e,0},
-{0xa953,9},
-{0xa954,0},
-{0xa9b3,7},
-{0xa9b4,0},
-{0xa9c0,9},
-{0xa9c1,0},
-{0xaab0,230},
-{0xaab1,0},
-{0xaab2,230},
-{0xaab4,220},
-{0xaab5,0},
-{0xaab7,230},
-{0xaab9,0},
-{0xaabe,230},
-{0xaac0,0},
-{0xaac1,230},
-{0xaac2,0},
-{0xaaf6,9},
-{0xaaf7,0},
-{0xabed,9},
-{0xabee,0},
-{0xfb1e,26},
-{0xfb1f,0},
-{0xfe20,230},
-{0xfe27,220},
-{0xfe2e,230},
-{0xfe30,0},
-{0x101fd,220},
-{0x101fe,0},
-{0x102e0,220},
-{0x102e1,0},
-{0x10376,230},
-{0x1037b,0},
-{0x10a0d,220},
-{0x10a0e,0},
-{0x10a0f,230},
-{0x10a10,0},
-{0x10a38,230},
-{0x10a39,1},
-{0x10a3a,220},
-{0x10a3b,0},
-{0x10a3f,9},
-{0x10a40,0},
-{0x10ae5,230},
-{0x10ae6,220},
-{0x10ae7,0},
-{0x11046,9},
-{0x11047,0},
-{0x1107f,9},
-{0x11080,0},
-{0x110b9,9},
-{0x110ba,7},
-{0x110bb,0},
-{0x11100,230},
-{0x11103,0},
-{0x11133,9},
-{0x11135,0},
-{0x11173,7},
-{0x11174,0},
-{0x111c0,9},
-{0x111c1,0},
-{0x111ca,7},
-{0x111cb,0},
-{0x11235,9},
-{0x11236,7},
-{0x11237,0},
-{0x112e9,7},
-{0x112ea,9},
-{0x112eb,0},
-{0x1133c,7},
-{0x1133d,0},
-{0x1134d,9},
-{0x1134e,0},
-{0x11366,230},
-{0x1136d,0},
-{0x11370,230},
-{0x11375,0},
-{0x114c2,9},
-{0x114c3,7},
-{0x114c4,0},
-{0x115bf,9},
-{0x115c0,7},
-{0x115c1,0},
-{0x1163f,9},
-{0x11640,0},
-{0x116b6,9},
-{0x116b7,7},
-{0x116b8,0},
-{0x1172b,9},
-{0x1172c,0},
-{0x16af0,1},
-{0x16af5,0},
-{0x16b30,230},
-{0x16b37,0},
-{0x1bc9e,1},
-{0x1bc9f,0},
-{0x1d165,216},
-{0x1d167,1},
-{0x1d16a,0},
-{0x1d16d,226},
-{0x1d16e,216},
-{0x1d173,0},
-{0x1d17b,220},
-{0x1d183,0},
-{0x1d185,230},
-{0x1d18a,220},
-{0x1d18c,0},
-{0x1d1aa,230},
-{0x1d1ae,0},
-{0x1d242,230},
-{0x1d245,0},
-{0x1e8d0,220},
-{0x1e8d7,0},
+const std::array<uint16_t, 978> combining_class_index = {{
+0,0,0,0,0,0,1,0,0,2,0,3,4,5,6,7,
+8,9,10,11,11,11,11,12,13,11,12,14,15,16,17,18,
+19,20,0,0,0,0,21,0,0,0,0,0,0,0,22,23,
+0,24,25,0,26,27,28,29,30,31,0,32,0,0,0,0,
+0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,34,35,36,0,0,0,0,
+37,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,39,40,0,0,
+41,42,43,44,0,45,0,46,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,47,0,0,0,0,0,48,0,0,0,
+0,0,0,49,0,50,51,0,0,0,0,0,0,0,0,0,
+0,0,0,0,52,53,0,0,0,0,0,0,0,0,0,0,
+54,55,56,57,58,59,60,0,0,61,0,62,63,64,65,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,66,67,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,68,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,69,70,71,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,72,
 }};
 
-const TableView<char32_t, int> combining_class_table {&combining_class_array[0], &combining_class_array[0] + combining_class_array.size()};
+const std::array<uint8_t, 9344> combining_class_leaves = {{
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,
+230,230,230,230,230,232,220,220,220,220,232,216,220,220,220,220,
+220,202,202,220,220,220,220,202,202,220,220,220,220,220,220,220,
+220,220,220,220,1,1,1,1,1,220,220,220,220,230,230,230,
+230,230,230,230,230,240,230,220,220,220,230,230,230,220,220,0,
+230,230,230,220,220,220,220,230,232,220,220,230,233,234,234,233,
+234,234,233,230,230,230,230,230,230,230,230,230,230,230,230,230,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,230,230,230,230,230,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,220,230,230,230,230,220,230,230,230,222,220,230,230,230,230,
+230,230,220,220,220,220,220,220,230,230,220,230,230,222,228,230,
+10,11,12,13,14,15,16,17,18,19,19,20,21,22,0,23,
+0,24,25,0,230,220,0,18,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+230,230,230,230,230,230,230,230,30,31,32,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,27,28,29,30,31,
+32,33,34,230,230,220,220,230,230,230,230,230,220,230,230,220,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,230,230,230,230,230,230,230,0,0,230,
+230,230,230,220,230,0,0,230,230,0,220,230,230,220,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+230,220,230,230,220,230,230,220,220,220,230,220,220,230,220,230,
+230,230,220,230,220,230,220,230,220,230,230,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,230,230,230,230,230,
+230,230,220,230,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,230,230,230,230,0,230,230,230,230,230,
+230,230,230,230,0,230,230,230,0,230,230,230,230,230,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,220,220,220,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,220,230,230,220,230,230,220,230,230,230,220,220,220,
+27,28,29,230,230,230,220,230,230,220,220,230,230,230,230,230,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,7,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,
+0,230,220,230,230,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,7,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,
+0,0,0,0,0,84,91,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,9,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,103,103,9,0,0,0,0,0,
+0,0,0,0,0,0,0,0,107,107,107,107,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,118,118,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,122,122,122,122,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,220,220,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,220,0,220,0,216,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,129,130,0,132,0,0,0,0,0,130,130,130,130,0,0,
+130,0,230,230,9,0,230,230,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,220,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,7,0,9,9,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,220,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,230,230,230,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,9,0,0,0,0,0,0,0,0,0,0,230,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,228,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,222,230,220,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,230,220,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,230,230,230,230,230,230,230,230,0,0,220,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+230,230,230,230,230,220,220,220,220,220,220,230,230,220,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,230,220,230,230,230,
+230,230,230,230,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,9,9,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,7,0,0,0,0,0,0,0,0,0,
+0,0,9,9,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+230,230,230,0,1,220,220,220,220,220,230,230,220,220,220,220,
+230,0,1,1,1,1,1,1,1,0,0,0,0,220,0,0,
+0,0,0,0,230,0,0,0,230,230,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+230,230,220,230,230,230,230,230,230,230,220,230,230,234,214,220,
+202,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,
+230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,
+230,230,230,230,230,230,0,0,0,0,0,0,233,220,230,220,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+230,230,1,1,230,230,230,230,1,1,1,230,230,0,0,0,
+0,230,0,0,0,1,1,230,220,230,1,1,220,220,220,220,
+230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,230,
+230,230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,
+230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,218,228,232,222,224,224,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,8,8,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,230,
+0,0,0,0,230,230,230,230,230,230,230,230,230,230,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,230,230,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+230,230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,230,
+230,230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,220,220,220,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,0,
+9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+230,0,230,230,220,0,0,230,230,0,0,0,0,0,230,230,
+0,230,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+230,230,230,230,230,230,230,220,220,220,220,220,220,220,230,230,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,220,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,230,230,230,230,230,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,220,0,230,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,230,1,220,0,0,0,0,9,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,230,220,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,9,7,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+230,230,230,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,9,9,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+9,0,0,0,0,0,0,0,0,0,7,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,9,7,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,7,9,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,7,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,230,230,230,230,230,230,230,0,0,0,
+230,230,230,230,230,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,9,7,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,
+7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,9,7,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+230,230,230,230,230,230,230,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,216,216,1,1,1,0,0,0,226,216,216,
+216,216,216,0,0,0,0,0,0,0,0,220,220,220,220,220,
+220,220,220,0,0,230,230,230,230,230,220,220,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,230,230,230,230,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,230,230,230,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+220,220,220,220,220,220,220,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+}};
+
+const TrieTable<int, uint8_t> combining_class_trie {{&combining_class_index[0], &combining_class_index[0] + combining_class_index.size()}, &combining_class_leaves[0], 0};
 
 const std::array<KeyValue<char32_t, std::array<char32_t, 2>>, 2060> canonical_array = {{
 {0xc0,{{0x41,0x300}}},
@@ -6217,949 +6392,4315 @@ const std::array<KeyValue<char32_t, std::array<char32_t, 18>>, 89> long_compatib
 
 const TableView<char32_t, std::array<char32_t, 18>> long_compatibility_table {&long_compatibility_array[0], &long_compatibility_array[0] + long_compatibility_array.size()};
 
-const std::array<KeyValue<std::array<char32_t, 2>, char32_t>, 940> composition_array = {{
-{{{0x3c,0x338}},0x226e},
-{{{0x3d,0x338}},0x2260},
-{{{0x3e,0x338}},0x226f},
-{{{0x41,0x300}},0xc0},
-{{{0x41,0x301}},0xc1},
-{{{0x41,0x302}},0xc2},
-{{{0x41,0x303}},0xc3},
-{{{0x41,0x304}},0x100},
-{{{0x41,0x306}},0x102},
-{{{0x41,0x307}},0x226},
-{{{0x41,0x308}},0xc4},
-{{{0x41,0x309}},0x1ea2},
-{{{0x41,0x30a}},0xc5},
-{{{0x41,0x30c}},0x1cd},
-{{{0x41,0x30f}},0x200},
-{{{0x41,0x311}},0x202},
-{{{0x41,0x323}},0x1ea0},
-{{{0x41,0x325}},0x1e00},
-{{{0x41,0x328}},0x104},
-{{{0x42,0x307}},0x1e02},
-{{{0x42,0x323}},0x1e04},
-{{{0x42,0x331}},0x1e06},
-{{{0x43,0x301}},0x106},
-{{{0x43,0x302}},0x108},
-{{{0x43,0x307}},0x10a},
-{{{0x43,0x30c}},0x10c},
-{{{0x43,0x327}},0xc7},
-{{{0x44,0x307}},0x1e0a},
-{{{0x44,0x30c}},0x10e},
-{{{0x44,0x323}},0x1e0c},
-{{{0x44,0x327}},0x1e10},
-{{{0x44,0x32d}},0x1e12},
-{{{0x44,0x331}},0x1e0e},
-{{{0x45,0x300}},0xc8},
-{{{0x45,0x301}},0xc9},
-{{{0x45,0x302}},0xca},
-{{{0x45,0x303}},0x1ebc},
-{{{0x45,0x304}},0x112},
-{{{0x45,0x306}},0x114},
-{{{0x45,0x307}},0x116},
-{{{0x45,0x308}},0xcb},
-{{{0x45,0x309}},0x1eba},
-{{{0x45,0x30c}},0x11a},
-{{{0x45,0x30f}},0x204},
-{{{0x45,0x311}},0x206},
-{{{0x45,0x323}},0x1eb8},
-{{{0x45,0x327}},0x228},
-{{{0x45,0x328}},0x118},
-{{{0x45,0x32d}},0x1e18},
-{{{0x45,0x330}},0x1e1a},
-{{{0x46,0x307}},0x1e1e},
-{{{0x47,0x301}},0x1f4},
-{{{0x47,0x302}},0x11c},
-{{{0x47,0x304}},0x1e20},
-{{{0x47,0x306}},0x11e},
-{{{0x47,0x307}},0x120},
-{{{0x47,0x30c}},0x1e6},
-{{{0x47,0x327}},0x122},
-{{{0x48,0x302}},0x124},
-{{{0x48,0x307}},0x1e22},
-{{{0x48,0x308}},0x1e26},
-{{{0x48,0x30c}},0x21e},
-{{{0x48,0x323}},0x1e24},
-{{{0x48,0x327}},0x1e28},
-{{{0x48,0x32e}},0x1e2a},
-{{{0x49,0x300}},0xcc},
-{{{0x49,0x301}},0xcd},
-{{{0x49,0x302}},0xce},
-{{{0x49,0x303}},0x128},
-{{{0x49,0x304}},0x12a},
-{{{0x49,0x306}},0x12c},
-{{{0x49,0x307}},0x130},
-{{{0x49,0x308}},0xcf},
-{{{0x49,0x309}},0x1ec8},
-{{{0x49,0x30c}},0x1cf},
-{{{0x49,0x30f}},0x208},
-{{{0x49,0x311}},0x20a},
-{{{0x49,0x323}},0x1eca},
-{{{0x49,0x328}},0x12e},
-{{{0x49,0x330}},0x1e2c},
-{{{0x4a,0x302}},0x134},
-{{{0x4b,0x301}},0x1e30},
-{{{0x4b,0x30c}},0x1e8},
-{{{0x4b,0x323}},0x1e32},
-{{{0x4b,0x327}},0x136},
-{{{0x4b,0x331}},0x1e34},
-{{{0x4c,0x301}},0x139},
-{{{0x4c,0x30c}},0x13d},
-{{{0x4c,0x323}},0x1e36},
-{{{0x4c,0x327}},0x13b},
-{{{0x4c,0x32d}},0x1e3c},
-{{{0x4c,0x331}},0x1e3a},
-{{{0x4d,0x301}},0x1e3e},
-{{{0x4d,0x307}},0x1e40},
-{{{0x4d,0x323}},0x1e42},
-{{{0x4e,0x300}},0x1f8},
-{{{0x4e,0x301}},0x143},
-{{{0x4e,0x303}},0xd1},
-{{{0x4e,0x307}},0x1e44},
-{{{0x4e,0x30c}},0x147},
-{{{0x4e,0x323}},0x1e46},
-{{{0x4e,0x327}},0x145},
-{{{0x4e,0x32d}},0x1e4a},
-{{{0x4e,0x331}},0x1e48},
-{{{0x4f,0x300}},0xd2},
-{{{0x4f,0x301}},0xd3},
-{{{0x4f,0x302}},0xd4},
-{{{0x4f,0x303}},0xd5},
-{{{0x4f,0x304}},0x14c},
-{{{0x4f,0x306}},0x14e},
-{{{0x4f,0x307}},0x22e},
-{{{0x4f,0x308}},0xd6},
-{{{0x4f,0x309}},0x1ece},
-{{{0x4f,0x30b}},0x150},
-{{{0x4f,0x30c}},0x1d1},
-{{{0x4f,0x30f}},0x20c},
-{{{0x4f,0x311}},0x20e},
-{{{0x4f,0x31b}},0x1a0},
-{{{0x4f,0x323}},0x1ecc},
-{{{0x4f,0x328}},0x1ea},
-{{{0x50,0x301}},0x1e54},
-{{{0x50,0x307}},0x1e56},
-{{{0x52,0x301}},0x154},
-{{{0x52,0x307}},0x1e58},
-{{{0x52,0x30c}},0x158},
-{{{0x52,0x30f}},0x210},
-{{{0x52,0x311}},0x212},
-{{{0x52,0x323}},0x1e5a},
-{{{0x52,0x327}},0x156},
-{{{0x52,0x331}},0x1e5e},
-{{{0x53,0x301}},0x15a},
-{{{0x53,0x302}},0x15c},
-{{{0x53,0x307}},0x1e60},
-{{{0x53,0x30c}},0x160},
-{{{0x53,0x323}},0x1e62},
-{{{0x53,0x326}},0x218},
-{{{0x53,0x327}},0x15e},
-{{{0x54,0x307}},0x1e6a},
-{{{0x54,0x30c}},0x164},
-{{{0x54,0x323}},0x1e6c},
-{{{0x54,0x326}},0x21a},
-{{{0x54,0x327}},0x162},
-{{{0x54,0x32d}},0x1e70},
-{{{0x54,0x331}},0x1e6e},
-{{{0x55,0x300}},0xd9},
-{{{0x55,0x301}},0xda},
-{{{0x55,0x302}},0xdb},
-{{{0x55,0x303}},0x168},
-{{{0x55,0x304}},0x16a},
-{{{0x55,0x306}},0x16c},
-{{{0x55,0x308}},0xdc},
-{{{0x55,0x309}},0x1ee6},
-{{{0x55,0x30a}},0x16e},
-{{{0x55,0x30b}},0x170},
-{{{0x55,0x30c}},0x1d3},
-{{{0x55,0x30f}},0x214},
-{{{0x55,0x311}},0x216},
-{{{0x55,0x31b}},0x1af},
-{{{0x55,0x323}},0x1ee4},
-{{{0x55,0x324}},0x1e72},
-{{{0x55,0x328}},0x172},
-{{{0x55,0x32d}},0x1e76},
-{{{0x55,0x330}},0x1e74},
-{{{0x56,0x303}},0x1e7c},
-{{{0x56,0x323}},0x1e7e},
-{{{0x57,0x300}},0x1e80},
-{{{0x57,0x301}},0x1e82},
-{{{0x57,0x302}},0x174},
-{{{0x57,0x307}},0x1e86},
-{{{0x57,0x308}},0x1e84},
-{{{0x57,0x323}},0x1e88},
-{{{0x58,0x307}},0x1e8a},
-{{{0x58,0x308}},0x1e8c},
-{{{0x59,0x300}},0x1ef2},
-{{{0x59,0x301}},0xdd},
-{{{0x59,0x302}},0x176},
-{{{0x59,0x303}},0x1ef8},
-{{{0x59,0x304}},0x232},
-{{{0x59,0x307}},0x1e8e},
-{{{0x59,0x308}},0x178},
-{{{0x59,0x309}},0x1ef6},
-{{{0x59,0x323}},0x1ef4},
-{{{0x5a,0x301}},0x179},
-{{{0x5a,0x302}},0x1e90},
-{{{0x5a,0x307}},0x17b},
-{{{0x5a,0x30c}},0x17d},
-{{{0x5a,0x323}},0x1e92},
-{{{0x5a,0x331}},0x1e94},
-{{{0x61,0x300}},0xe0},
-{{{0x61,0x301}},0xe1},
-{{{0x61,0x302}},0xe2},
-{{{0x61,0x303}},0xe3},
-{{{0x61,0x304}},0x101},
-{{{0x61,0x306}},0x103},
-{{{0x61,0x307}},0x227},
-{{{0x61,0x308}},0xe4},
-{{{0x61,0x309}},0x1ea3},
-{{{0x61,0x30a}},0xe5},
-{{{0x61,0x30c}},0x1ce},
-{{{0x61,0x30f}},0x201},
-{{{0x61,0x311}},0x203},
-{{{0x61,0x323}},0x1ea1},
-{{{0x61,0x325}},0x1e01},
-{{{0x61,0x328}},0x105},
-{{{0x62,0x307}},0x1e03},
-{{{0x62,0x323}},0x1e05},
-{{{0x62,0x331}},0x1e07},
-{{{0x63,0x301}},0x107},
-{{{0x63,0x302}},0x109},
-{{{0x63,0x307}},0x10b},
-{{{0x63,0x30c}},0x10d},
-{{{0x63,0x327}},0xe7},
-{{{0x64,0x307}},0x1e0b},
-{{{0x64,0x30c}},0x10f},
-{{{0x64,0x323}},0x1e0d},
-{{{0x64,0x327}},0x1e11},
-{{{0x64,0x32d}},0x1e13},
-{{{0x64,0x331}},0x1e0f},
-{{{0x65,0x300}},0xe8},
-{{{0x65,0x301}},0xe9},
-{{{0x65,0x302}},0xea},
-{{{0x65,0x303}},0x1ebd},
-{{{0x65,0x304}},0x113},
-{{{0x65,0x306}},0x115},
-{{{0x65,0x307}},0x117},
-{{{0x65,0x308}},0xeb},
-{{{0x65,0x309}},0x1ebb},
-{{{0x65,0x30c}},0x11b},
-{{{0x65,0x30f}},0x205},
-{{{0x65,0x311}},0x207},
-{{{0x65,0x323}},0x1eb9},
-{{{0x65,0x327}},0x229},
-{{{0x65,0x328}},0x119},
-{{{0x65,0x32d}},0x1e19},
-{{{0x65,0x330}},0x1e1b},
-{{{0x66,0x307}},0x1e1f},
-{{{0x67,0x301}},0x1f5},
-{{{0x67,0x302}},0x11d},
-{{{0x67,0x304}},0x1e21},
-{{{0x67,0x306}},0x11f},
-{{{0x67,0x307}},0x121},
-{{{0x67,0x30c}},0x1e7},
-{{{0x67,0x327}},0x123},
-{{{0x68,0x302}},0x125},
-{{{0x68,0x307}},0x1e23},
-{{{0x68,0x308}},0x1e27},
-{{{0x68,0x30c}},0x21f},
-{{{0x68,0x323}},0x1e25},
-{{{0x68,0x327}},0x1e29},
-{{{0x68,0x32e}},0x1e2b},
-{{{0x68,0x331}},0x1e96},
-{{{0x69,0x300}},0xec},
-{{{0x69,0x301}},0xed},
-{{{0x69,0x302}},0xee},
-{{{0x69,0x303}},0x129},
-{{{0x69,0x304}},0x12b},
-{{{0x69,0x306}},0x12d},
-{{{0x69,0x308}},0xef},
-{{{0x69,0x309}},0x1ec9},
-{{{0x69,0x30c}},0x1d0},
-{{{0x69,0x30f}},0x209},
-{{{0x69,0x311}},0x20b},
-{{{0x69,0x323}},0x1ecb},
-{{{0x69,0x328}},0x12f},
-{{{0x69,0x330}},0x1e2d},
-{{{0x6a,0x302}},0x135},
-{{{0x6a,0x30c}},0x1f0},
-{{{0x6b,0x301}},0x1e31},
-{{{0x6b,0x30c}},0x1e9},
-{{{0x6b,0x323}},0x1e33},
-{{{0x6b,0x327}},0x137},
-{{{0x6b,0x331}},0x1e35},
-{{{0x6c,0x301}},0x13a},
-{{{0x6c,0x30c}},0x13e},
-{{{0x6c,0x323}},0x1e37},
-{{{0x6c,0x327}},0x13c},
-{{{0x6c,0x32d}},0x1e3d},
-{{{0x6c,0x331}},0x1e3b},
-{{{0x6d,0x301}},0x1e3f},
-{{{0x6d,0x307}},0x1e41},
-{{{0x6d,0x323}},0x1e43},
-{{{0x6e,0x300}},0x1f9},
-{{{0x6e,0x301}},0x144},
-{{{0x6e,0x303}},0xf1},
-{{{0x6e,0x307}},0x1e45},
-{{{0x6e,0x30c}},0x148},
-{{{0x6e,0x323}},0x1e47},
-{{{0x6e,0x327}},0x146},
-{{{0x6e,0x32d}},0x1e4b},
-{{{0x6e,0x331}},0x1e49},
-{{{0x6f,0x300}},0xf2},
-{{{0x6f,0x301}},0xf3},
-{{{0x6f,0x302}},0xf4},
-{{{0x6f,0x303}},0xf5},
-{{{0x6f,0x304}},0x14d},
-{{{0x6f,0x306}},0x14f},
-{{{0x6f,0x307}},0x22f},
-{{{0x6f,0x308}},0xf6},
-{{{0x6f,0x309}},0x1ecf},
-{{{0x6f,0x30b}},0x151},
-{{{0x6f,0x30c}},0x1d2},
-{{{0x6f,0x30f}},0x20d},
-{{{0x6f,0x311}},0x20f},
-{{{0x6f,0x31b}},0x1a1},
-{{{0x6f,0x323}},0x1ecd},
-{{{0x6f,0x328}},0x1eb},
-{{{0x70,0x301}},0x1e55},
-{{{0x70,0x307}},0x1e57},
-{{{0x72,0x301}},0x155},
-{{{0x72,0x307}},0x1e59},
-{{{0x72,0x30c}},0x159},
-{{{0x72,0x30f}},0x211},
-{{{0x72,0x311}},0x213},
-{{{0x72,0x323}},0x1e5b},
-{{{0x72,0x327}},0x157},
-{{{0x72,0x331}},0x1e5f},
-{{{0x73,0x301}},0x15b},
-{{{0x73,0x302}},0x15d},
-{{{0x73,0x307}},0x1e61},
-{{{0x73,0x30c}},0x161},
-{{{0x73,0x323}},0x1e63},
-{{{0x73,0x326}},0x219},
-{{{0x73,0x327}},0x15f},
-{{{0x74,0x307}},0x1e6b},
-{{{0x74,0x308}},0x1e97},
-{{{0x74,0x30c}},0x165},
-{{{0x74,0x323}},0x1e6d},
-{{{0x74,0x326}},0x21b},
-{{{0x74,0x327}},0x163},
-{{{0x74,0x32d}},0x1e71},
-{{{0x74,0x331}},0x1e6f},
-{{{0x75,0x300}},0xf9},
-{{{0x75,0x301}},0xfa},
-{{{0x75,0x302}},0xfb},
-{{{0x75,0x303}},0x169},
-{{{0x75,0x304}},0x16b},
-{{{0x75,0x306}},0x16d},
-{{{0x75,0x308}},0xfc},
-{{{0x75,0x309}},0x1ee7},
-{{{0x75,0x30a}},0x16f},
-{{{0x75,0x30b}},0x171},
-{{{0x75,0x30c}},0x1d4},
-{{{0x75,0x30f}},0x215},
-{{{0x75,0x311}},0x217},
-{{{0x75,0x31b}},0x1b0},
-{{{0x75,0x323}},0x1ee5},
-{{{0x75,0x324}},0x1e73},
-{{{0x75,0x328}},0x173},
-{{{0x75,0x32d}},0x1e77},
-{{{0x75,0x330}},0x1e75},
-{{{0x76,0x303}},0x1e7d},
-{{{0x76,0x323}},0x1e7f},
-{{{0x77,0x300}},0x1e81},
-{{{0x77,0x301}},0x1e83},
-{{{0x77,0x302}},0x175},
-{{{0x77,0x307}},0x1e87},
-{{{0x77,0x308}},0x1e85},
-{{{0x77,0x30a}},0x1e98},
-{{{0x77,0x323}},0x1e89},
-{{{0x78,0x307}},0x1e8b},
-{{{0x78,0x308}},0x1e8d},
-{{{0x79,0x300}},0x1ef3},
-{{{0x79,0x301}},0xfd},
-{{{0x79,0x302}},0x177},
-{{{0x79,0x303}},0x1ef9},
-{{{0x79,0x304}},0x233},
-{{{0x79,0x307}},0x1e8f},
-{{{0x79,0x308}},0xff},
-{{{0x79,0x309}},0x1ef7},
-{{{0x79,0x30a}},0x1e99},
-{{{0x79,0x323}},0x1ef5},
-{{{0x7a,0x301}},0x17a},
-{{{0x7a,0x302}},0x1e91},
-{{{0x7a,0x307}},0x17c},
-{{{0x7a,0x30c}},0x17e},
-{{{0x7a,0x323}},0x1e93},
-{{{0x7a,0x331}},0x1e95},
-{{{0xa8,0x300}},0x1fed},
-{{{0xa8,0x301}},0x385},
-{{{0xa8,0x342}},0x1fc1},
-{{{0xc2,0x300}},0x1ea6},
-{{{0xc2,0x301}},0x1ea4},
-{{{0xc2,0x303}},0x1eaa},
-{{{0xc2,0x309}},0x1ea8},
-{{{0xc4,0x304}},0x1de},
-{{{0xc5,0x301}},0x1fa},
-{{{0xc6,0x301}},0x1fc},
-{{{0xc6,0x304}},0x1e2},
-{{{0xc7,0x301}},0x1e08},
-{{{0xca,0x300}},0x1ec0},
-{{{0xca,0x301}},0x1ebe},
-{{{0xca,0x303}},0x1ec4},
-{{{0xca,0x309}},0x1ec2},
-{{{0xcf,0x301}},0x1e2e},
-{{{0xd4,0x300}},0x1ed2},
-{{{0xd4,0x301}},0x1ed0},
-{{{0xd4,0x303}},0x1ed6},
-{{{0xd4,0x309}},0x1ed4},
-{{{0xd5,0x301}},0x1e4c},
-{{{0xd5,0x304}},0x22c},
-{{{0xd5,0x308}},0x1e4e},
-{{{0xd6,0x304}},0x22a},
-{{{0xd8,0x301}},0x1fe},
-{{{0xdc,0x300}},0x1db},
-{{{0xdc,0x301}},0x1d7},
-{{{0xdc,0x304}},0x1d5},
-{{{0xdc,0x30c}},0x1d9},
-{{{0xe2,0x300}},0x1ea7},
-{{{0xe2,0x301}},0x1ea5},
-{{{0xe2,0x303}},0x1eab},
-{{{0xe2,0x309}},0x1ea9},
-{{{0xe4,0x304}},0x1df},
-{{{0xe5,0x301}},0x1fb},
-{{{0xe6,0x301}},0x1fd},
-{{{0xe6,0x304}},0x1e3},
-{{{0xe7,0x301}},0x1e09},
-{{{0xea,0x300}},0x1ec1},
-{{{0xea,0x301}},0x1ebf},
-{{{0xea,0x303}},0x1ec5},
-{{{0xea,0x309}},0x1ec3},
-{{{0xef,0x301}},0x1e2f},
-{{{0xf4,0x300}},0x1ed3},
-{{{0xf4,0x301}},0x1ed1},
-{{{0xf4,0x303}},0x1ed7},
-{{{0xf4,0x309}},0x1ed5},
-{{{0xf5,0x301}},0x1e4d},
-{{{0xf5,0x304}},0x22d},
-{{{0xf5,0x308}},0x1e4f},
-{{{0xf6,0x304}},0x22b},
-{{{0xf8,0x301}},0x1ff},
-{{{0xfc,0x300}},0x1dc},
-{{{0xfc,0x301}},0x1d8},
-{{{0xfc,0x304}},0x1d6},
-{{{0xfc,0x30c}},0x1da},
-{{{0x102,0x300}},0x1eb0},
-{{{0x102,0x301}},0x1eae},
-{{{0x102,0x303}},0x1eb4},
-{{{0x102,0x309}},0x1eb2},
-{{{0x103,0x300}},0x1eb1},
-{{{0x103,0x301}},0x1eaf},
-{{{0x103,0x303}},0x1eb5},
-{{{0x103,0x309}},0x1eb3},
-{{{0x112,0x300}},0x1e14},
-{{{0x112,0x301}},0x1e16},
-{{{0x113,0x300}},0x1e15},
-{{{0x113,0x301}},0x1e17},
-{{{0x14c,0x300}},0x1e50},
-{{{0x14c,0x301}},0x1e52},
-{{{0x14d,0x300}},0x1e51},
-{{{0x14d,0x301}},0x1e53},
-{{{0x15a,0x307}},0x1e64},
-{{{0x15b,0x307}},0x1e65},
-{{{0x160,0x307}},0x1e66},
-{{{0x161,0x307}},0x1e67},
-{{{0x168,0x301}},0x1e78},
-{{{0x169,0x301}},0x1e79},
-{{{0x16a,0x308}},0x1e7a},
-{{{0x16b,0x308}},0x1e7b},
-{{{0x17f,0x307}},0x1e9b},
-{{{0x1a0,0x300}},0x1edc},
-{{{0x1a0,0x301}},0x1eda},
-{{{0x1a0,0x303}},0x1ee0},
-{{{0x1a0,0x309}},0x1ede},
-{{{0x1a0,0x323}},0x1ee2},
-{{{0x1a1,0x300}},0x1edd},
-{{{0x1a1,0x301}},0x1edb},
-{{{0x1a1,0x303}},0x1ee1},
-{{{0x1a1,0x309}},0x1edf},
-{{{0x1a1,0x323}},0x1ee3},
-{{{0x1af,0x300}},0x1eea},
-{{{0x1af,0x301}},0x1ee8},
-{{{0x1af,0x303}},0x1eee},
-{{{0x1af,0x309}},0x1eec},
-{{{0x1af,0x323}},0x1ef0},
-{{{0x1b0,0x300}},0x1eeb},
-{{{0x1b0,0x301}},0x1ee9},
-{{{0x1b0,0x303}},0x1eef},
-{{{0x1b0,0x309}},0x1eed},
-{{{0x1b0,0x323}},0x1ef1},
-{{{0x1b7,0x30c}},0x1ee},
-{{{0x1ea,0x304}},0x1ec},
-{{{0x1eb,0x304}},0x1ed},
-{{{0x226,0x304}},0x1e0},
-{{{0x227,0x304}},0x1e1},
-{{{0x228,0x306}},0x1e1c},
-{{{0x229,0x306}},0x1e1d},
-{{{0x22e,0x304}},0x230},
-{{{0x22f,0x304}},0x231},
-{{{0x292,0x30c}},0x1ef},
-{{{0x391,0x300}},0x1fba},
-{{{0x391,0x301}},0x386},
-{{{0x391,0x304}},0x1fb9},
-{{{0x391,0x306}},0x1fb8},
-{{{0x391,0x313}},0x1f08},
-{{{0x391,0x314}},0x1f09},
-{{{0x391,0x345}},0x1fbc},
-{{{0x395,0x300}},0x1fc8},
-{{{0x395,0x301}},0x388},
-{{{0x395,0x313}},0x1f18},
-{{{0x395,0x314}},0x1f19},
-{{{0x397,0x300}},0x1fca},
-{{{0x397,0x301}},0x389},
-{{{0x397,0x313}},0x1f28},
-{{{0x397,0x314}},0x1f29},
-{{{0x397,0x345}},0x1fcc},
-{{{0x399,0x300}},0x1fda},
-{{{0x399,0x301}},0x38a},
-{{{0x399,0x304}},0x1fd9},
-{{{0x399,0x306}},0x1fd8},
-{{{0x399,0x308}},0x3aa},
-{{{0x399,0x313}},0x1f38},
-{{{0x399,0x314}},0x1f39},
-{{{0x39f,0x300}},0x1ff8},
-{{{0x39f,0x301}},0x38c},
-{{{0x39f,0x313}},0x1f48},
-{{{0x39f,0x314}},0x1f49},
-{{{0x3a1,0x314}},0x1fec},
-{{{0x3a5,0x300}},0x1fea},
-{{{0x3a5,0x301}},0x38e},
-{{{0x3a5,0x304}},0x1fe9},
-{{{0x3a5,0x306}},0x1fe8},
-{{{0x3a5,0x308}},0x3ab},
-{{{0x3a5,0x314}},0x1f59},
-{{{0x3a9,0x300}},0x1ffa},
-{{{0x3a9,0x301}},0x38f},
-{{{0x3a9,0x313}},0x1f68},
-{{{0x3a9,0x314}},0x1f69},
-{{{0x3a9,0x345}},0x1ffc},
-{{{0x3ac,0x345}},0x1fb4},
-{{{0x3ae,0x345}},0x1fc4},
-{{{0x3b1,0x300}},0x1f70},
-{{{0x3b1,0x301}},0x3ac},
-{{{0x3b1,0x304}},0x1fb1},
-{{{0x3b1,0x306}},0x1fb0},
-{{{0x3b1,0x313}},0x1f00},
-{{{0x3b1,0x314}},0x1f01},
-{{{0x3b1,0x342}},0x1fb6},
-{{{0x3b1,0x345}},0x1fb3},
-{{{0x3b5,0x300}},0x1f72},
-{{{0x3b5,0x301}},0x3ad},
-{{{0x3b5,0x313}},0x1f10},
-{{{0x3b5,0x314}},0x1f11},
-{{{0x3b7,0x300}},0x1f74},
-{{{0x3b7,0x301}},0x3ae},
-{{{0x3b7,0x313}},0x1f20},
-{{{0x3b7,0x314}},0x1f21},
-{{{0x3b7,0x342}},0x1fc6},
-{{{0x3b7,0x345}},0x1fc3},
-{{{0x3b9,0x300}},0x1f76},
-{{{0x3b9,0x301}},0x3af},
-{{{0x3b9,0x304}},0x1fd1},
-{{{0x3b9,0x306}},0x1fd0},
-{{{0x3b9,0x308}},0x3ca},
-{{{0x3b9,0x313}},0x1f30},
-{{{0x3b9,0x314}},0x1f31},
-{{{0x3b9,0x342}},0x1fd6},
-{{{0x3bf,0x300}},0x1f78},
-{{{0x3bf,0x301}},0x3cc},
-{{{0x3bf,0x313}},0x1f40},
-{{{0x3bf,0x314}},0x1f41},
-{{{0x3c1,0x313}},0x1fe4},
-{{{0x3c1,0x314}},0x1fe5},
-{{{0x3c5,0x300}},0x1f7a},
-{{{0x3c5,0x301}},0x3cd},
-{{{0x3c5,0x304}},0x1fe1},
-{{{0x3c5,0x306}},0x1fe0},
-{{{0x3c5,0x308}},0x3cb},
-{{{0x3c5,0x313}},0x1f50},
-{{{0x3c5,0x314}},0x1f51},
-{{{0x3c5,0x342}},0x1fe6},
-{{{0x3c9,0x300}},0x1f7c},
-{{{0x3c9,0x301}},0x3ce},
-{{{0x3c9,0x313}},0x1f60},
-{{{0x3c9,0x314}},0x1f61},
-{{{0x3c9,0x342}},0x1ff6},
-{{{0x3c9,0x345}},0x1ff3},
-{{{0x3ca,0x300}},0x1fd2},
-{{{0x3ca,0x301}},0x390},
-{{{0x3ca,0x342}},0x1fd7},
-{{{0x3cb,0x300}},0x1fe2},
-{{{0x3cb,0x301}},0x3b0},
-{{{0x3cb,0x342}},0x1fe7},
-{{{0x3ce,0x345}},0x1ff4},
-{{{0x3d2,0x301}},0x3d3},
-{{{0x3d2,0x308}},0x3d4},
-{{{0x406,0x308}},0x407},
-{{{0x410,0x306}},0x4d0},
-{{{0x410,0x308}},0x4d2},
-{{{0x413,0x301}},0x403},
-{{{0x415,0x300}},0x400},
-{{{0x415,0x306}},0x4d6},
-{{{0x415,0x308}},0x401},
-{{{0x416,0x306}},0x4c1},
-{{{0x416,0x308}},0x4dc},
-{{{0x417,0x308}},0x4de},
-{{{0x418,0x300}},0x40d},
-{{{0x418,0x304}},0x4e2},
-{{{0x418,0x306}},0x419},
-{{{0x418,0x308}},0x4e4},
-{{{0x41a,0x301}},0x40c},
-{{{0x41e,0x308}},0x4e6},
-{{{0x423,0x304}},0x4ee},
-{{{0x423,0x306}},0x40e},
-{{{0x423,0x308}},0x4f0},
-{{{0x423,0x30b}},0x4f2},
-{{{0x427,0x308}},0x4f4},
-{{{0x42b,0x308}},0x4f8},
-{{{0x42d,0x308}},0x4ec},
-{{{0x430,0x306}},0x4d1},
-{{{0x430,0x308}},0x4d3},
-{{{0x433,0x301}},0x453},
-{{{0x435,0x300}},0x450},
-{{{0x435,0x306}},0x4d7},
-{{{0x435,0x308}},0x451},
-{{{0x436,0x306}},0x4c2},
-{{{0x436,0x308}},0x4dd},
-{{{0x437,0x308}},0x4df},
-{{{0x438,0x300}},0x45d},
-{{{0x438,0x304}},0x4e3},
-{{{0x438,0x306}},0x439},
-{{{0x438,0x308}},0x4e5},
-{{{0x43a,0x301}},0x45c},
-{{{0x43e,0x308}},0x4e7},
-{{{0x443,0x304}},0x4ef},
-{{{0x443,0x306}},0x45e},
-{{{0x443,0x308}},0x4f1},
-{{{0x443,0x30b}},0x4f3},
-{{{0x447,0x308}},0x4f5},
-{{{0x44b,0x308}},0x4f9},
-{{{0x44d,0x308}},0x4ed},
-{{{0x456,0x308}},0x457},
-{{{0x474,0x30f}},0x476},
-{{{0x475,0x30f}},0x477},
-{{{0x4d8,0x308}},0x4da},
-{{{0x4d9,0x308}},0x4db},
-{{{0x4e8,0x308}},0x4ea},
-{{{0x4e9,0x308}},0x4eb},
-{{{0x627,0x653}},0x622},
-{{{0x627,0x654}},0x623},
-{{{0x627,0x655}},0x625},
-{{{0x648,0x654}},0x624},
-{{{0x64a,0x654}},0x626},
-{{{0x6c1,0x654}},0x6c2},
-{{{0x6d2,0x654}},0x6d3},
-{{{0x6d5,0x654}},0x6c0},
-{{{0x928,0x93c}},0x929},
-{{{0x930,0x93c}},0x931},
-{{{0x933,0x93c}},0x934},
-{{{0x9c7,0x9be}},0x9cb},
-{{{0x9c7,0x9d7}},0x9cc},
-{{{0xb47,0xb3e}},0xb4b},
-{{{0xb47,0xb56}},0xb48},
-{{{0xb47,0xb57}},0xb4c},
-{{{0xb92,0xbd7}},0xb94},
-{{{0xbc6,0xbbe}},0xbca},
-{{{0xbc6,0xbd7}},0xbcc},
-{{{0xbc7,0xbbe}},0xbcb},
-{{{0xc46,0xc56}},0xc48},
-{{{0xcbf,0xcd5}},0xcc0},
-{{{0xcc6,0xcc2}},0xcca},
-{{{0xcc6,0xcd5}},0xcc7},
-{{{0xcc6,0xcd6}},0xcc8},
-{{{0xcca,0xcd5}},0xccb},
-{{{0xd46,0xd3e}},0xd4a},
-{{{0xd46,0xd57}},0xd4c},
-{{{0xd47,0xd3e}},0xd4b},
-{{{0xdd9,0xdca}},0xdda},
-{{{0xdd9,0xdcf}},0xddc},
-{{{0xdd9,0xddf}},0xdde},
-{{{0xddc,0xdca}},0xddd},
-{{{0x1025,0x102e}},0x1026},
-{{{0x1b05,0x1b35}},0x1b06},
-{{{0x1b07,0x1b35}},0x1b08},
-{{{0x1b09,0x1b35}},0x1b0a},
-{{{0x1b0b,0x1b35}},0x1b0c},
-{{{0x1b0d,0x1b35}},0x1b0e},
-{{{0x1b11,0x1b35}},0x1b12},
-{{{0x1b3a,0x1b35}},0x1b3b},
-{{{0x1b3c,0x1b35}},0x1b3d},
-{{{0x1b3e,0x1b35}},0x1b40},
-{{{0x1b3f,0x1b35}},0x1b41},
-{{{0x1b42,0x1b35}},0x1b43},
-{{{0x1e36,0x304}},0x1e38},
-{{{0x1e37,0x304}},0x1e39},
-{{{0x1e5a,0x304}},0x1e5c},
-{{{0x1e5b,0x304}},0x1e5d},
-{{{0x1e62,0x307}},0x1e68},
-{{{0x1e63,0x307}},0x1e69},
-{{{0x1ea0,0x302}},0x1eac},
-{{{0x1ea0,0x306}},0x1eb6},
-{{{0x1ea1,0x302}},0x1ead},
-{{{0x1ea1,0x306}},0x1eb7},
-{{{0x1eb8,0x302}},0x1ec6},
-{{{0x1eb9,0x302}},0x1ec7},
-{{{0x1ecc,0x302}},0x1ed8},
-{{{0x1ecd,0x302}},0x1ed9},
-{{{0x1f00,0x300}},0x1f02},
-{{{0x1f00,0x301}},0x1f04},
-{{{0x1f00,0x342}},0x1f06},
-{{{0x1f00,0x345}},0x1f80},
-{{{0x1f01,0x300}},0x1f03},
-{{{0x1f01,0x301}},0x1f05},
-{{{0x1f01,0x342}},0x1f07},
-{{{0x1f01,0x345}},0x1f81},
-{{{0x1f02,0x345}},0x1f82},
-{{{0x1f03,0x345}},0x1f83},
-{{{0x1f04,0x345}},0x1f84},
-{{{0x1f05,0x345}},0x1f85},
-{{{0x1f06,0x345}},0x1f86},
-{{{0x1f07,0x345}},0x1f87},
-{{{0x1f08,0x300}},0x1f0a},
-{{{0x1f08,0x301}},0x1f0c},
-{{{0x1f08,0x342}},0x1f0e},
-{{{0x1f08,0x345}},0x1f88},
-{{{0x1f09,0x300}},0x1f0b},
-{{{0x1f09,0x301}},0x1f0d},
-{{{0x1f09,0x342}},0x1f0f},
-{{{0x1f09,0x345}},0x1f89},
-{{{0x1f0a,0x345}},0x1f8a},
-{{{0x1f0b,0x345}},0x1f8b},
-{{{0x1f0c,0x345}},0x1f8c},
-{{{0x1f0d,0x345}},0x1f8d},
-{{{0x1f0e,0x345}},0x1f8e},
-{{{0x1f0f,0x345}},0x1f8f},
-{{{0x1f10,0x300}},0x1f12},
-{{{0x1f10,0x301}},0x1f14},
-{{{0x1f11,0x300}},0x1f13},
-{{{0x1f11,0x301}},0x1f15},
-{{{0x1f18,0x300}},0x1f1a},
-{{{0x1f18,0x301}},0x1f1c},
-{{{0x1f19,0x300}},0x1f1b},
-{{{0x1f19,0x301}},0x1f1d},
-{{{0x1f20,0x300}},0x1f22},
-{{{0x1f20,0x301}},0x1f24},
-{{{0x1f20,0x342}},0x1f26},
-{{{0x1f20,0x345}},0x1f90},
-{{{0x1f21,0x300}},0x1f23},
-{{{0x1f21,0x301}},0x1f25},
-{{{0x1f21,0x342}},0x1f27},
-{{{0x1f21,0x345}},0x1f91},
-{{{0x1f22,0x345}},0x1f92},
-{{{0x1f23,0x345}},0x1f93},
-{{{0x1f24,0x345}},0x1f94},
-{{{0x1f25,0x345}},0x1f95},
-{{{0x1f26,0x345}},0x1f96},
-{{{0x1f27,0x345}},0x1f97},
-{{{0x1f28,0x300}},0x1f2a},
-{{{0x1f28,0x301}},0x1f2c},
-{{{0x1f28,0x342}},0x1f2e},
-{{{0x1f28,0x345}},0x1f98},
-{{{0x1f29,0x300}},0x1f2b},
-{{{0x1f29,0x301}},0x1f2d},
-{{{0x1f29,0x342}},0x1f2f},
-{{{0x1f29,0x345}},0x1f99},
-{{{0x1f2a,0x345}},0x1f9a},
-{{{0x1f2b,0x345}},0x1f9b},
-{{{0x1f2c,0x345}},0x1f9c},
-{{{0x1f2d,0x345}},0x1f9d},
-{{{0x1f2e,0x345}},0x1f9e},
-{{{0x1f2f,0x345}},0x1f9f},
-{{{0x1f30,0x300}},0x1f32},
-{{{0x1f30,0x301}},0x1f34},
-{{{0x1f30,0x342}},0x1f36},
-{{{0x1f31,0x300}},0x1f33},
-{{{0x1f31,0x301}},0x1f35},
-{{{0x1f31,0x342}},0x1f37},
-{{{0x1f38,0x300}},0x1f3a},
-{{{0x1f38,0x301}},0x1f3c},
-{{{0x1f38,0x342}},0x1f3e},
-{{{0x1f39,0x300}},0x1f3b},
-{{{0x1f39,0x301}},0x1f3d},
-{{{0x1f39,0x342}},0x1f3f},
-{{{0x1f40,0x300}},0x1f42},
-{{{0x1f40,0x301}},0x1f44},
-{{{0x1f41,0x300}},0x1f43},
-{{{0x1f41,0x301}},0x1f45},
-{{{0x1f48,0x300}},0x1f4a},
-{{{0x1f48,0x301}},0x1f4c},
-{{{0x1f49,0x300}},0x1f4b},
-{{{0x1f49,0x301}},0x1f4d},
-{{{0x1f50,0x300}},0x1f52},
-{{{0x1f50,0x301}},0x1f54},
-{{{0x1f50,0x342}},0x1f56},
-{{{0x1f51,0x300}},0x1f53},
-{{{0x1f51,0x301}},0x1f55},
-{{{0x1f51,0x342}},0x1f57},
-{{{0x1f59,0x300}},0x1f5b},
-{{{0x1f59,0x301}},0x1f5d},
-{{{0x1f59,0x342}},0x1f5f},
-{{{0x1f60,0x300}},0x1f62},
-{{{0x1f60,0x301}},0x1f64},
-{{{0x1f60,0x342}},0x1f66},
-{{{0x1f60,0x345}},0x1fa0},
-{{{0x1f61,0x300}},0x1f63},
-{{{0x1f61,0x301}},0x1f65},
-{{{0x1f61,0x342}},0x1f67},
-{{{0x1f61,0x345}},0x1fa1},
-{{{0x1f62,0x345}},0x1fa2},
-{{{0x1f63,0x345}},0x1fa3},
-{{{0x1f64,0x345}},0x1fa4},
-{{{0x1f65,0x345}},0x1fa5},
-{{{0x1f66,0x345}},0x1fa6},
-{{{0x1f67,0x345}},0x1fa7},
-{{{0x1f68,0x300}},0x1f6a},
-{{{0x1f68,0x301}},0x1f6c},
-{{{0x1f68,0x342}},0x1f6e},
-{{{0x1f68,0x345}},0x1fa8},
-{{{0x1f69,0x300}},0x1f6b},
-{{{0x1f69,0x301}},0x1f6d},
-{{{0x1f69,0x342}},0x1f6f},
-{{{0x1f69,0x345}},0x1fa9},
-{{{0x1f6a,0x345}},0x1faa},
-{{{0x1f6b,0x345}},0x1fab},
-{{{0x1f6c,0x345}},0x1fac},
-{{{0x1f6d,0x345}},0x1fad},
-{{{0x1f6e,0x345}},0x1fae},
-{{{0x1f6f,0x345}},0x1faf},
-{{{0x1f70,0x345}},0x1fb2},
-{{{0x1f74,0x345}},0x1fc2},
-{{{0x1f7c,0x345}},0x1ff2},
-{{{0x1fb6,0x345}},0x1fb7},
-{{{0x1fbf,0x300}},0x1fcd},
-{{{0x1fbf,0x301}},0x1fce},
-{{{0x1fbf,0x342}},0x1fcf},
-{{{0x1fc6,0x345}},0x1fc7},
-{{{0x1ff6,0x345}},0x1ff7},
-{{{0x1ffe,0x300}},0x1fdd},
-{{{0x1ffe,0x301}},0x1fde},
-{{{0x1ffe,0x342}},0x1fdf},
-{{{0x2190,0x338}},0x219a},
-{{{0x2192,0x338}},0x219b},
-{{{0x2194,0x338}},0x21ae},
-{{{0x21d0,0x338}},0x21cd},
-{{{0x21d2,0x338}},0x21cf},
-{{{0x21d4,0x338}},0x21ce},
-{{{0x2203,0x338}},0x2204},
-{{{0x2208,0x338}},0x2209},
-{{{0x220b,0x338}},0x220c},
-{{{0x2223,0x338}},0x2224},
-{{{0x2225,0x338}},0x2226},
-{{{0x223c,0x338}},0x2241},
-{{{0x2243,0x338}},0x2244},
-{{{0x2245,0x338}},0x2247},
-{{{0x2248,0x338}},0x2249},
-{{{0x224d,0x338}},0x226d},
-{{{0x2261,0x338}},0x2262},
-{{{0x2264,0x338}},0x2270},
-{{{0x2265,0x338}},0x2271},
-{{{0x2272,0x338}},0x2274},
-{{{0x2273,0x338}},0x2275},
-{{{0x2276,0x338}},0x2278},
-{{{0x2277,0x338}},0x2279},
-{{{0x227a,0x338}},0x2280},
-{{{0x227b,0x338}},0x2281},
-{{{0x227c,0x338}},0x22e0},
-{{{0x227d,0x338}},0x22e1},
-{{{0x2282,0x338}},0x2284},
-{{{0x2283,0x338}},0x2285},
-{{{0x2286,0x338}},0x2288},
-{{{0x2287,0x338}},0x2289},
-{{{0x2291,0x338}},0x22e2},
-{{{0x2292,0x338}},0x22e3},
-{{{0x22a2,0x338}},0x22ac},
-{{{0x22a8,0x338}},0x22ad},
-{{{0x22a9,0x338}},0x22ae},
-{{{0x22ab,0x338}},0x22af},
-{{{0x22b2,0x338}},0x22ea},
-{{{0x22b3,0x338}},0x22eb},
-{{{0x22b4,0x338}},0x22ec},
-{{{0x22b5,0x338}},0x22ed},
-{{{0x3046,0x3099}},0x3094},
-{{{0x304b,0x3099}},0x304c},
-{{{0x304d,0x3099}},0x304e},
-{{{0x304f,0x3099}},0x3050},
-{{{0x3051,0x3099}},0x3052},
-{{{0x3053,0x3099}},0x3054},
-{{{0x3055,0x3099}},0x3056},
-{{{0x3057,0x3099}},0x3058},
-{{{0x3059,0x3099}},0x305a},
-{{{0x305b,0x3099}},0x305c},
-{{{0x305d,0x3099}},0x305e},
-{{{0x305f,0x3099}},0x3060},
-{{{0x3061,0x3099}},0x3062},
-{{{0x3064,0x3099}},0x3065},
-{{{0x3066,0x3099}},0x3067},
-{{{0x3068,0x3099}},0x3069},
-{{{0x306f,0x3099}},0x3070},
-{{{0x306f,0x309a}},0x3071},
-{{{0x3072,0x3099}},0x3073},
-{{{0x3072,0x309a}},0x3074},
-{{{0x3075,0x3099}},0x3076},
-{{{0x3075,0x309a}},0x3077},
-{{{0x3078,0x3099}},0x3079},
-{{{0x3078,0x309a}},0x307a},
-{{{0x307b,0x3099}},0x307c},
-{{{0x307b,0x309a}},0x307d},
-{{{0x309d,0x3099}},0x309e},
-{{{0x30a6,0x3099}},0x30f4},
-{{{0x30ab,0x3099}},0x30ac},
-{{{0x30ad,0x3099}},0x30ae},
-{{{0x30af,0x3099}},0x30b0},
-{{{0x30b1,0x3099}},0x30b2},
-{{{0x30b3,0x3099}},0x30b4},
-{{{0x30b5,0x3099}},0x30b6},
-{{{0x30b7,0x3099}},0x30b8},
-{{{0x30b9,0x3099}},0x30ba},
-{{{0x30bb,0x3099}},0x30bc},
-{{{0x30bd,0x3099}},0x30be},
-{{{0x30bf,0x3099}},0x30c0},
-{{{0x30c1,0x3099}},0x30c2},
-{{{0x30c4,0x3099}},0x30c5},
-{{{0x30c6,0x3099}},0x30c7},
-{{{0x30c8,0x3099}},0x30c9},
-{{{0x30cf,0x3099}},0x30d0},
-{{{0x30cf,0x309a}},0x30d1},
-{{{0x30d2,0x3099}},0x30d3},
-{{{0x30d2,0x309a}},0x30d4},
-{{{0x30d5,0x3099}},0x30d6},
-{{{0x30d5,0x309a}},0x30d7},
-{{{0x30d8,0x3099}},0x30d9},
-{{{0x30d8,0x309a}},0x30da},
-{{{0x30db,0x3099}},0x30dc},
-{{{0x30db,0x309a}},0x30dd},
-{{{0x30ef,0x3099}},0x30f7},
-{{{0x30f0,0x3099}},0x30f8},
-{{{0x30f1,0x3099}},0x30f9},
-{{{0x30f2,0x3099}},0x30fa},
-{{{0x30fd,0x3099}},0x30fe},
-{{{0x11099,0x110ba}},0x1109a},
-{{{0x1109b,0x110ba}},0x1109c},
-{{{0x110a5,0x110ba}},0x110ab},
-{{{0x11131,0x11127}},0x1112e},
-{{{0x11132,0x11127}},0x1112f},
-{{{0x11347,0x1133e}},0x1134b},
-{{{0x11347,0x11357}},0x1134c},
-{{{0x114b9,0x114b0}},0x114bc},
-{{{0x114b9,0x114ba}},0x114bb},
-{{{0x114b9,0x114bd}},0x114be},
-{{{0x115b8,0x115af}},0x115ba},
-{{{0x115b9,0x115af}},0x115bb},
+const std::array<uint16_t, 556> composition_start_index = {{
+0,1,2,3,4,5,6,7,8,9,6,6,10,11,6,6,
+6,6,12,13,6,6,14,15,16,17,18,19,6,6,6,6,
+20,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,21,6,6,6,6,6,22,23,24,25,
+6,6,6,26,27,28,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+29,30,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,31,32,6,6,6,33,6,6,34,6,35,
+}};
+
+const std::array<uint16_t, 4608> composition_start_leaves = {{
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,1,3,5,0,
+0,7,24,28,34,41,59,61,69,77,93,95,101,108,112,122,
+139,0,142,151,159,167,187,190,197,200,210,0,0,0,0,0,
+0,217,234,238,244,251,269,271,279,288,303,306,312,319,323,333,
+350,0,353,362,370,379,399,402,410,413,424,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,431,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,435,0,440,442,444,447,0,0,449,0,0,0,0,454,
+0,0,0,0,456,461,465,0,467,0,0,0,469,0,0,0,
+0,0,474,0,479,481,483,486,0,0,488,0,0,0,0,493,
+0,0,0,0,495,500,504,0,506,0,0,0,508,0,0,0,
+0,0,513,518,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,523,526,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,529,532,0,0,
+0,0,0,0,0,0,0,0,0,0,535,537,0,0,0,0,
+539,541,0,0,0,0,0,0,543,545,547,549,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,551,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+553,559,0,0,0,0,0,0,0,0,0,0,0,0,0,565,
+571,0,0,0,0,0,0,577,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,579,581,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,583,585,587,589,0,0,0,0,591,593,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,595,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,597,0,0,0,605,0,610,0,616,0,0,0,0,0,624,
+0,629,0,0,0,631,0,0,0,638,0,0,644,0,646,0,
+0,648,0,0,0,657,0,662,0,669,0,0,0,0,0,678,
+0,683,0,0,0,686,0,0,0,695,702,706,0,0,710,0,
+0,0,712,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,715,0,0,0,0,0,0,0,0,0,
+717,0,0,720,0,722,726,729,731,0,736,0,0,0,738,0,
+0,0,0,740,0,0,0,745,0,0,0,747,0,749,0,0,
+751,0,0,754,0,756,760,763,765,0,770,0,0,0,772,0,
+0,0,0,774,0,0,0,779,0,0,0,781,0,783,0,0,
+0,0,0,0,0,0,785,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,787,789,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,791,793,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,795,797,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,799,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,803,0,805,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,807,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,809,0,0,811,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,813,0,0,0,0,0,0,0,
+815,0,0,817,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,819,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,822,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,826,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,828,831,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,833,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,835,
+0,0,0,0,0,0,837,0,0,0,841,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,843,846,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,848,0,0,852,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,854,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,856,0,858,0,860,0,862,0,864,0,0,
+0,866,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,868,0,870,0,872,874,
+0,0,876,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,878,880,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,882,884,0,0,0,0,
+0,0,886,888,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+890,893,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,896,898,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,900,902,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+904,909,914,916,918,920,922,924,926,931,936,938,940,942,944,946,
+948,951,0,0,0,0,0,0,954,957,0,0,0,0,0,0,
+960,965,970,972,974,976,978,980,982,987,992,994,996,998,1000,1002,
+1004,1008,0,0,0,0,0,0,1012,1016,0,0,0,0,0,0,
+1020,1023,0,0,0,0,0,0,1026,1029,0,0,0,0,0,0,
+1032,1036,0,0,0,0,0,0,0,1040,0,0,0,0,0,0,
+1044,1049,1054,1056,1058,1060,1062,1064,1066,1071,1076,1078,1080,1082,1084,1086,
+1088,0,0,0,1090,0,0,0,0,0,0,0,1092,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,1094,0,0,0,0,0,0,0,0,1096,
+0,0,0,0,0,0,1100,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,1102,0,0,0,0,0,0,0,1104,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1108,0,1110,0,1112,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1114,0,1116,0,1118,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,1120,0,0,0,0,1122,0,0,1124,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,1126,0,1128,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,1130,0,0,0,
+0,0,0,1132,0,1134,0,0,1136,0,0,0,0,1138,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,1140,0,0,1142,1144,0,0,0,0,0,0,0,0,0,0,
+0,0,1146,1148,0,0,1150,1152,0,0,1154,1156,1158,1160,0,0,
+0,0,1162,1164,0,0,1166,1168,0,0,0,0,0,0,0,0,
+0,1170,1172,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,1174,0,0,0,0,0,1176,1178,0,1180,0,0,0,0,
+0,0,1182,1184,1186,1188,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,1190,0,0,0,0,1192,0,1194,0,1196,
+0,1198,0,1200,0,1202,0,1204,0,1206,0,1208,0,1210,0,1212,
+0,1214,0,0,1216,0,1218,0,1220,0,0,0,0,0,0,1222,
+0,0,1225,0,0,1228,0,0,1231,0,0,1234,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,1237,0,0,
+0,0,0,0,0,0,1239,0,0,0,0,1241,0,1243,0,1245,
+0,1247,0,1249,0,1251,0,1253,0,1255,0,1257,0,1259,0,1261,
+0,1263,0,0,1265,0,1267,0,1269,0,0,0,0,0,0,1271,
+0,0,1274,0,0,1277,0,0,1280,0,0,1283,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1286,
+1288,1290,1292,0,0,0,0,0,0,0,0,0,0,1294,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,1296,0,1298,0,0,0,0,
+0,0,0,0,0,1300,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,1302,1304,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,1306,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,1309,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1313,1315,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+}};
+
+const TrieTable<uint16_t, uint16_t> composition_start_trie {{&composition_start_index[0], &composition_start_index[0] + composition_start_index.size()}, &composition_start_leaves[0], 0};
+
+const std::array<std::array<char32_t, 2>, 1316> composition_list_array = {{
+{{0x338,0x226e}},
+{{0,0}},
+{{0x338,0x2260}},
+{{0,0}},
+{{0x338,0x226f}},
+{{0,0}},
+{{0x300,0xc0}},
+{{0x301,0xc1}},
+{{0x302,0xc2}},
+{{0x303,0xc3}},
+{{0x304,0x100}},
+{{0x306,0x102}},
+{{0x307,0x226}},
+{{0x308,0xc4}},
+{{0x309,0x1ea2}},
+{{0x30a,0xc5}},
+{{0x30c,0x1cd}},
+{{0x30f,0x200}},
+{{0x311,0x202}},
+{{0x323,0x1ea0}},
+{{0x325,0x1e00}},
+{{0x328,0x104}},
+{{0,0}},
+{{0x307,0x1e02}},
+{{0x323,0x1e04}},
+{{0x331,0x1e06}},
+{{0,0}},
+{{0x301,0x106}},
+{{0x302,0x108}},
+{{0x307,0x10a}},
+{{0x30c,0x10c}},
+{{0x327,0xc7}},
+{{0,0}},
+{{0x307,0x1e0a}},
+{{0x30c,0x10e}},
+{{0x323,0x1e0c}},
+{{0x327,0x1e10}},
+{{0x32d,0x1e12}},
+{{0x331,0x1e0e}},
+{{0,0}},
+{{0x300,0xc8}},
+{{0x301,0xc9}},
+{{0x302,0xca}},
+{{0x303,0x1ebc}},
+{{0x304,0x112}},
+{{0x306,0x114}},
+{{0x307,0x116}},
+{{0x308,0xcb}},
+{{0x309,0x1eba}},
+{{0x30c,0x11a}},
+{{0x30f,0x204}},
+{{0x311,0x206}},
+{{0x323,0x1eb8}},
+{{0x327,0x228}},
+{{0x328,0x118}},
+{{0x32d,0x1e18}},
+{{0x330,0x1e1a}},
+{{0,0}},
+{{0x307,0x1e1e}},
+{{0,0}},
+{{0x301,0x1f4}},
+{{0x302,0x11c}},
+{{0x304,0x1e20}},
+{{0x306,0x11e}},
+{{0x307,0x120}},
+{{0x30c,0x1e6}},
+{{0x327,0x122}},
+{{0,0}},
+{{0x302,0x124}},
+{{0x307,0x1e22}},
+{{0x308,0x1e26}},
+{{0x30c,0x21e}},
+{{0x323,0x1e24}},
+{{0x327,0x1e28}},
+{{0x32e,0x1e2a}},
+{{0,0}},
+{{0x300,0xcc}},
+{{0x301,0xcd}},
+{{0x302,0xce}},
+{{0x303,0x128}},
+{{0x304,0x12a}},
+{{0x306,0x12c}},
+{{0x307,0x130}},
+{{0x308,0xcf}},
+{{0x309,0x1ec8}},
+{{0x30c,0x1cf}},
+{{0x30f,0x208}},
+{{0x311,0x20a}},
+{{0x323,0x1eca}},
+{{0x328,0x12e}},
+{{0x330,0x1e2c}},
+{{0,0}},
+{{0x302,0x134}},
+{{0,0}},
+{{0x301,0x1e30}},
+{{0x30c,0x1e8}},
+{{0x323,0x1e32}},
+{{0x327,0x136}},
+{{0x331,0x1e34}},
+{{0,0}},
+{{0x301,0x139}},
+{{0x30c,0x13d}},
+{{0x323,0x1e36}},
+{{0x327,0x13b}},
+{{0x32d,0x1e3c}},
+{{0x331,0x1e3a}},
+{{0,0}},
+{{0x301,0x1e3e}},
+{{0x307,0x1e40}},
+{{0x323,0x1e42}},
+{{0,0}},
+{{0x300,0x1f8}},
+{{0x301,0x143}},
+{{0x303,0xd1}},
+{{0x307,0x1e44}},
+{{0x30c,0x147}},
+{{0x323,0x1e46}},
+{{0x327,0x145}},
+{{0x32d,0x1e4a}},
+{{0x331,0x1e48}},
+{{0,0}},
+{{0x300,0xd2}},
+{{0x301,0xd3}},
+{{0x302,0xd4}},
+{{0x303,0xd5}},
+{{0x304,0x14c}},
+{{0x306,0x14e}},
+{{0x307,0x22e}},
+{{0x308,0xd6}},
+{{0x309,0x1ece}},
+{{0x30b,0x150}},
+{{0x30c,0x1d1}},
+{{0x30f,0x20c}},
+{{0x311,0x20e}},
+{{0x31b,0x1a0}},
+{{0x323,0x1ecc}},
+{{0x328,0x1ea}},
+{{0,0}},
+{{0x301,0x1e54}},
+{{0x307,0x1e56}},
+{{0,0}},
+{{0x301,0x154}},
+{{0x307,0x1e58}},
+{{0x30c,0x158}},
+{{0x30f,0x210}},
+{{0x311,0x212}},
+{{0x323,0x1e5a}},
+{{0x327,0x156}},
+{{0x331,0x1e5e}},
+{{0,0}},
+{{0x301,0x15a}},
+{{0x302,0x15c}},
+{{0x307,0x1e60}},
+{{0x30c,0x160}},
+{{0x323,0x1e62}},
+{{0x326,0x218}},
+{{0x327,0x15e}},
+{{0,0}},
+{{0x307,0x1e6a}},
+{{0x30c,0x164}},
+{{0x323,0x1e6c}},
+{{0x326,0x21a}},
+{{0x327,0x162}},
+{{0x32d,0x1e70}},
+{{0x331,0x1e6e}},
+{{0,0}},
+{{0x300,0xd9}},
+{{0x301,0xda}},
+{{0x302,0xdb}},
+{{0x303,0x168}},
+{{0x304,0x16a}},
+{{0x306,0x16c}},
+{{0x308,0xdc}},
+{{0x309,0x1ee6}},
+{{0x30a,0x16e}},
+{{0x30b,0x170}},
+{{0x30c,0x1d3}},
+{{0x30f,0x214}},
+{{0x311,0x216}},
+{{0x31b,0x1af}},
+{{0x323,0x1ee4}},
+{{0x324,0x1e72}},
+{{0x328,0x172}},
+{{0x32d,0x1e76}},
+{{0x330,0x1e74}},
+{{0,0}},
+{{0x303,0x1e7c}},
+{{0x323,0x1e7e}},
+{{0,0}},
+{{0x300,0x1e80}},
+{{0x301,0x1e82}},
+{{0x302,0x174}},
+{{0x307,0x1e86}},
+{{0x308,0x1e84}},
+{{0x323,0x1e88}},
+{{0,0}},
+{{0x307,0x1e8a}},
+{{0x308,0x1e8c}},
+{{0,0}},
+{{0x300,0x1ef2}},
+{{0x301,0xdd}},
+{{0x302,0x176}},
+{{0x303,0x1ef8}},
+{{0x304,0x232}},
+{{0x307,0x1e8e}},
+{{0x308,0x178}},
+{{0x309,0x1ef6}},
+{{0x323,0x1ef4}},
+{{0,0}},
+{{0x301,0x179}},
+{{0x302,0x1e90}},
+{{0x307,0x17b}},
+{{0x30c,0x17d}},
+{{0x323,0x1e92}},
+{{0x331,0x1e94}},
+{{0,0}},
+{{0x300,0xe0}},
+{{0x301,0xe1}},
+{{0x302,0xe2}},
+{{0x303,0xe3}},
+{{0x304,0x101}},
+{{0x306,0x103}},
+{{0x307,0x227}},
+{{0x308,0xe4}},
+{{0x309,0x1ea3}},
+{{0x30a,0xe5}},
+{{0x30c,0x1ce}},
+{{0x30f,0x201}},
+{{0x311,0x203}},
+{{0x323,0x1ea1}},
+{{0x325,0x1e01}},
+{{0x328,0x105}},
+{{0,0}},
+{{0x307,0x1e03}},
+{{0x323,0x1e05}},
+{{0x331,0x1e07}},
+{{0,0}},
+{{0x301,0x107}},
+{{0x302,0x109}},
+{{0x307,0x10b}},
+{{0x30c,0x10d}},
+{{0x327,0xe7}},
+{{0,0}},
+{{0x307,0x1e0b}},
+{{0x30c,0x10f}},
+{{0x323,0x1e0d}},
+{{0x327,0x1e11}},
+{{0x32d,0x1e13}},
+{{0x331,0x1e0f}},
+{{0,0}},
+{{0x300,0xe8}},
+{{0x301,0xe9}},
+{{0x302,0xea}},
+{{0x303,0x1ebd}},
+{{0x304,0x113}},
+{{0x306,0x115}},
+{{0x307,0x117}},
+{{0x308,0xeb}},
+{{0x309,0x1ebb}},
+{{0x30c,0x11b}},
+{{0x30f,0x205}},
+{{0x311,0x207}},
+{{0x323,0x1eb9}},
+{{0x327,0x229}},
+{{0x328,0x119}},
+{{0x32d,0x1e19}},
+{{0x330,0x1e1b}},
+{{0,0}},
+{{0x307,0x1e1f}},
+{{0,0}},
+{{0x301,0x1f5}},
+{{0x302,0x11d}},
+{{0x304,0x1e21}},
+{{0x306,0x11f}},
+{{0x307,0x121}},
+{{0x30c,0x1e7}},
+{{0x327,0x123}},
+{{0,0}},
+{{0x302,0x125}},
+{{0x307,0x1e23}},
+{{0x308,0x1e27}},
+{{0x30c,0x21f}},
+{{0x323,0x1e25}},
+{{0x327,0x1e29}},
+{{0x32e,0x1e2b}},
+{{0x331,0x1e96}},
+{{0,0}},
+{{0x300,0xec}},
+{{0x301,0xed}},
+{{0x302,0xee}},
+{{0x303,0x129}},
+{{0x304,0x12b}},
+{{0x306,0x12d}},
+{{0x308,0xef}},
+{{0x309,0x1ec9}},
+{{0x30c,0x1d0}},
+{{0x30f,0x209}},
+{{0x311,0x20b}},
+{{0x323,0x1ecb}},
+{{0x328,0x12f}},
+{{0x330,0x1e2d}},
+{{0,0}},
+{{0x302,0x135}},
+{{0x30c,0x1f0}},
+{{0,0}},
+{{0x301,0x1e31}},
+{{0x30c,0x1e9}},
+{{0x323,0x1e33}},
+{{0x327,0x137}},
+{{0x331,0x1e35}},
+{{0,0}},
+{{0x301,0x13a}},
+{{0x30c,0x13e}},
+{{0x323,0x1e37}},
+{{0x327,0x13c}},
+{{0x32d,0x1e3d}},
+{{0x331,0x1e3b}},
+{{0,0}},
+{{0x301,0x1e3f}},
+{{0x307,0x1e41}},
+{{0x323,0x1e43}},
+{{0,0}},
+{{0x300,0x1f9}},
+{{0x301,0x144}},
+{{0x303,0xf1}},
+{{0x307,0x1e45}},
+{{0x30c,0x148}},
+{{0x323,0x1e47}},
+{{0x327,0x146}},
+{{0x32d,0x1e4b}},
+{{0x331,0x1e49}},
+{{0,0}},
+{{0x300,0xf2}},
+{{0x301,0xf3}},
+{{0x302,0xf4}},
+{{0x303,0xf5}},
+{{0x304,0x14d}},
+{{0x306,0x14f}},
+{{0x307,0x22f}},
+{{0x308,0xf6}},
+{{0x309,0x1ecf}},
+{{0x30b,0x151}},
+{{0x30c,0x1d2}},
+{{0x30f,0x20d}},
+{{0x311,0x20f}},
+{{0x31b,0x1a1}},
+{{0x323,0x1ecd}},
+{{0x328,0x1eb}},
+{{0,0}},
+{{0x301,0x1e55}},
+{{0x307,0x1e57}},
+{{0,0}},
+{{0x301,0x155}},
+{{0x307,0x1e59}},
+{{0x30c,0x159}},
+{{0x30f,0x211}},
+{{0x311,0x213}},
+{{0x323,0x1e5b}},
+{{0x327,0x157}},
+{{0x331,0x1e5f}},
+{{0,0}},
+{{0x301,0x15b}},
+{{0x302,0x15d}},
+{{0x307,0x1e61}},
+{{0x30c,0x161}},
+{{0x323,0x1e63}},
+{{0x326,0x219}},
+{{0x327,0x15f}},
+{{0,0}},
+{{0x307,0x1e6b}},
+{{0x308,0x1e97}},
+{{0x30c,0x165}},
+{{0x323,0x1e6d}},
+{{0x326,0x21b}},
+{{0x327,0x163}},
+{{0x32d,0x1e71}},
+{{0x331,0x1e6f}},
+{{0,0}},
+{{0x300,0xf9}},
+{{0x301,0xfa}},
+{{0x302,0xfb}},
+{{0x303,0x169}},
+{{0x304,0x16b}},
+{{0x306,0x16d}},
+{{0x308,0xfc}},
+{{0x309,0x1ee7}},
+{{0x30a,0x16f}},
+{{0x30b,0x171}},
+{{0x30c,0x1d4}},
+{{0x30f,0x215}},
+{{0x311,0x217}},
+{{0x31b,0x1b0}},
+{{0x323,0x1ee5}},
+{{0x324,0x1e73}},
+{{0x328,0x173}},
+{{0x32d,0x1e77}},
+{{0x330,0x1e75}},
+{{0,0}},
+{{0x303,0x1e7d}},
+{{0x323,0x1e7f}},
+{{0,0}},
+{{0x300,0x1e81}},
+{{0x301,0x1e83}},
+{{0x302,0x175}},
+{{0x307,0x1e87}},
+{{0x308,0x1e85}},
+{{0x30a,0x1e98}},
+{{0x323,0x1e89}},
+{{0,0}},
+{{0x307,0x1e8b}},
+{{0x308,0x1e8d}},
+{{0,0}},
+{{0x300,0x1ef3}},
+{{0x301,0xfd}},
+{{0x302,0x177}},
+{{0x303,0x1ef9}},
+{{0x304,0x233}},
+{{0x307,0x1e8f}},
+{{0x308,0xff}},
+{{0x309,0x1ef7}},
+{{0x30a,0x1e99}},
+{{0x323,0x1ef5}},
+{{0,0}},
+{{0x301,0x17a}},
+{{0x302,0x1e91}},
+{{0x307,0x17c}},
+{{0x30c,0x17e}},
+{{0x323,0x1e93}},
+{{0x331,0x1e95}},
+{{0,0}},
+{{0x300,0x1fed}},
+{{0x301,0x385}},
+{{0x342,0x1fc1}},
+{{0,0}},
+{{0x300,0x1ea6}},
+{{0x301,0x1ea4}},
+{{0x303,0x1eaa}},
+{{0x309,0x1ea8}},
+{{0,0}},
+{{0x304,0x1de}},
+{{0,0}},
+{{0x301,0x1fa}},
+{{0,0}},
+{{0x301,0x1fc}},
+{{0x304,0x1e2}},
+{{0,0}},
+{{0x301,0x1e08}},
+{{0,0}},
+{{0x300,0x1ec0}},
+{{0x301,0x1ebe}},
+{{0x303,0x1ec4}},
+{{0x309,0x1ec2}},
+{{0,0}},
+{{0x301,0x1e2e}},
+{{0,0}},
+{{0x300,0x1ed2}},
+{{0x301,0x1ed0}},
+{{0x303,0x1ed6}},
+{{0x309,0x1ed4}},
+{{0,0}},
+{{0x301,0x1e4c}},
+{{0x304,0x22c}},
+{{0x308,0x1e4e}},
+{{0,0}},
+{{0x304,0x22a}},
+{{0,0}},
+{{0x301,0x1fe}},
+{{0,0}},
+{{0x300,0x1db}},
+{{0x301,0x1d7}},
+{{0x304,0x1d5}},
+{{0x30c,0x1d9}},
+{{0,0}},
+{{0x300,0x1ea7}},
+{{0x301,0x1ea5}},
+{{0x303,0x1eab}},
+{{0x309,0x1ea9}},
+{{0,0}},
+{{0x304,0x1df}},
+{{0,0}},
+{{0x301,0x1fb}},
+{{0,0}},
+{{0x301,0x1fd}},
+{{0x304,0x1e3}},
+{{0,0}},
+{{0x301,0x1e09}},
+{{0,0}},
+{{0x300,0x1ec1}},
+{{0x301,0x1ebf}},
+{{0x303,0x1ec5}},
+{{0x309,0x1ec3}},
+{{0,0}},
+{{0x301,0x1e2f}},
+{{0,0}},
+{{0x300,0x1ed3}},
+{{0x301,0x1ed1}},
+{{0x303,0x1ed7}},
+{{0x309,0x1ed5}},
+{{0,0}},
+{{0x301,0x1e4d}},
+{{0x304,0x22d}},
+{{0x308,0x1e4f}},
+{{0,0}},
+{{0x304,0x22b}},
+{{0,0}},
+{{0x301,0x1ff}},
+{{0,0}},
+{{0x300,0x1dc}},
+{{0x301,0x1d8}},
+{{0x304,0x1d6}},
+{{0x30c,0x1da}},
+{{0,0}},
+{{0x300,0x1eb0}},
+{{0x301,0x1eae}},
+{{0x303,0x1eb4}},
+{{0x309,0x1eb2}},
+{{0,0}},
+{{0x300,0x1eb1}},
+{{0x301,0x1eaf}},
+{{0x303,0x1eb5}},
+{{0x309,0x1eb3}},
+{{0,0}},
+{{0x300,0x1e14}},
+{{0x301,0x1e16}},
+{{0,0}},
+{{0x300,0x1e15}},
+{{0x301,0x1e17}},
+{{0,0}},
+{{0x300,0x1e50}},
+{{0x301,0x1e52}},
+{{0,0}},
+{{0x300,0x1e51}},
+{{0x301,0x1e53}},
+{{0,0}},
+{{0x307,0x1e64}},
+{{0,0}},
+{{0x307,0x1e65}},
+{{0,0}},
+{{0x307,0x1e66}},
+{{0,0}},
+{{0x307,0x1e67}},
+{{0,0}},
+{{0x301,0x1e78}},
+{{0,0}},
+{{0x301,0x1e79}},
+{{0,0}},
+{{0x308,0x1e7a}},
+{{0,0}},
+{{0x308,0x1e7b}},
+{{0,0}},
+{{0x307,0x1e9b}},
+{{0,0}},
+{{0x300,0x1edc}},
+{{0x301,0x1eda}},
+{{0x303,0x1ee0}},
+{{0x309,0x1ede}},
+{{0x323,0x1ee2}},
+{{0,0}},
+{{0x300,0x1edd}},
+{{0x301,0x1edb}},
+{{0x303,0x1ee1}},
+{{0x309,0x1edf}},
+{{0x323,0x1ee3}},
+{{0,0}},
+{{0x300,0x1eea}},
+{{0x301,0x1ee8}},
+{{0x303,0x1eee}},
+{{0x309,0x1eec}},
+{{0x323,0x1ef0}},
+{{0,0}},
+{{0x300,0x1eeb}},
+{{0x301,0x1ee9}},
+{{0x303,0x1eef}},
+{{0x309,0x1eed}},
+{{0x323,0x1ef1}},
+{{0,0}},
+{{0x30c,0x1ee}},
+{{0,0}},
+{{0x304,0x1ec}},
+{{0,0}},
+{{0x304,0x1ed}},
+{{0,0}},
+{{0x304,0x1e0}},
+{{0,0}},
+{{0x304,0x1e1}},
+{{0,0}},
+{{0x306,0x1e1c}},
+{{0,0}},
+{{0x306,0x1e1d}},
+{{0,0}},
+{{0x304,0x230}},
+{{0,0}},
+{{0x304,0x231}},
+{{0,0}},
+{{0x30c,0x1ef}},
+{{0,0}},
+{{0x300,0x1fba}},
+{{0x301,0x386}},
+{{0x304,0x1fb9}},
+{{0x306,0x1fb8}},
+{{0x313,0x1f08}},
+{{0x314,0x1f09}},
+{{0x345,0x1fbc}},
+{{0,0}},
+{{0x300,0x1fc8}},
+{{0x301,0x388}},
+{{0x313,0x1f18}},
+{{0x314,0x1f19}},
+{{0,0}},
+{{0x300,0x1fca}},
+{{0x301,0x389}},
+{{0x313,0x1f28}},
+{{0x314,0x1f29}},
+{{0x345,0x1fcc}},
+{{0,0}},
+{{0x300,0x1fda}},
+{{0x301,0x38a}},
+{{0x304,0x1fd9}},
+{{0x306,0x1fd8}},
+{{0x308,0x3aa}},
+{{0x313,0x1f38}},
+{{0x314,0x1f39}},
+{{0,0}},
+{{0x300,0x1ff8}},
+{{0x301,0x38c}},
+{{0x313,0x1f48}},
+{{0x314,0x1f49}},
+{{0,0}},
+{{0x314,0x1fec}},
+{{0,0}},
+{{0x300,0x1fea}},
+{{0x301,0x38e}},
+{{0x304,0x1fe9}},
+{{0x306,0x1fe8}},
+{{0x308,0x3ab}},
+{{0x314,0x1f59}},
+{{0,0}},
+{{0x300,0x1ffa}},
+{{0x301,0x38f}},
+{{0x313,0x1f68}},
+{{0x314,0x1f69}},
+{{0x345,0x1ffc}},
+{{0,0}},
+{{0x345,0x1fb4}},
+{{0,0}},
+{{0x345,0x1fc4}},
+{{0,0}},
+{{0x300,0x1f70}},
+{{0x301,0x3ac}},
+{{0x304,0x1fb1}},
+{{0x306,0x1fb0}},
+{{0x313,0x1f00}},
+{{0x314,0x1f01}},
+{{0x342,0x1fb6}},
+{{0x345,0x1fb3}},
+{{0,0}},
+{{0x300,0x1f72}},
+{{0x301,0x3ad}},
+{{0x313,0x1f10}},
+{{0x314,0x1f11}},
+{{0,0}},
+{{0x300,0x1f74}},
+{{0x301,0x3ae}},
+{{0x313,0x1f20}},
+{{0x314,0x1f21}},
+{{0x342,0x1fc6}},
+{{0x345,0x1fc3}},
+{{0,0}},
+{{0x300,0x1f76}},
+{{0x301,0x3af}},
+{{0x304,0x1fd1}},
+{{0x306,0x1fd0}},
+{{0x308,0x3ca}},
+{{0x313,0x1f30}},
+{{0x314,0x1f31}},
+{{0x342,0x1fd6}},
+{{0,0}},
+{{0x300,0x1f78}},
+{{0x301,0x3cc}},
+{{0x313,0x1f40}},
+{{0x314,0x1f41}},
+{{0,0}},
+{{0x313,0x1fe4}},
+{{0x314,0x1fe5}},
+{{0,0}},
+{{0x300,0x1f7a}},
+{{0x301,0x3cd}},
+{{0x304,0x1fe1}},
+{{0x306,0x1fe0}},
+{{0x308,0x3cb}},
+{{0x313,0x1f50}},
+{{0x314,0x1f51}},
+{{0x342,0x1fe6}},
+{{0,0}},
+{{0x300,0x1f7c}},
+{{0x301,0x3ce}},
+{{0x313,0x1f60}},
+{{0x314,0x1f61}},
+{{0x342,0x1ff6}},
+{{0x345,0x1ff3}},
+{{0,0}},
+{{0x300,0x1fd2}},
+{{0x301,0x390}},
+{{0x342,0x1fd7}},
+{{0,0}},
+{{0x300,0x1fe2}},
+{{0x301,0x3b0}},
+{{0x342,0x1fe7}},
+{{0,0}},
+{{0x345,0x1ff4}},
+{{0,0}},
+{{0x301,0x3d3}},
+{{0x308,0x3d4}},
+{{0,0}},
+{{0x308,0x407}},
+{{0,0}},
+{{0x306,0x4d0}},
+{{0x308,0x4d2}},
+{{0,0}},
+{{0x301,0x403}},
+{{0,0}},
+{{0x300,0x400}},
+{{0x306,0x4d6}},
+{{0x308,0x401}},
+{{0,0}},
+{{0x306,0x4c1}},
+{{0x308,0x4dc}},
+{{0,0}},
+{{0x308,0x4de}},
+{{0,0}},
+{{0x300,0x40d}},
+{{0x304,0x4e2}},
+{{0x306,0x419}},
+{{0x308,0x4e4}},
+{{0,0}},
+{{0x301,0x40c}},
+{{0,0}},
+{{0x308,0x4e6}},
+{{0,0}},
+{{0x304,0x4ee}},
+{{0x306,0x40e}},
+{{0x308,0x4f0}},
+{{0x30b,0x4f2}},
+{{0,0}},
+{{0x308,0x4f4}},
+{{0,0}},
+{{0x308,0x4f8}},
+{{0,0}},
+{{0x308,0x4ec}},
+{{0,0}},
+{{0x306,0x4d1}},
+{{0x308,0x4d3}},
+{{0,0}},
+{{0x301,0x453}},
+{{0,0}},
+{{0x300,0x450}},
+{{0x306,0x4d7}},
+{{0x308,0x451}},
+{{0,0}},
+{{0x306,0x4c2}},
+{{0x308,0x4dd}},
+{{0,0}},
+{{0x308,0x4df}},
+{{0,0}},
+{{0x300,0x45d}},
+{{0x304,0x4e3}},
+{{0x306,0x439}},
+{{0x308,0x4e5}},
+{{0,0}},
+{{0x301,0x45c}},
+{{0,0}},
+{{0x308,0x4e7}},
+{{0,0}},
+{{0x304,0x4ef}},
+{{0x306,0x45e}},
+{{0x308,0x4f1}},
+{{0x30b,0x4f3}},
+{{0,0}},
+{{0x308,0x4f5}},
+{{0,0}},
+{{0x308,0x4f9}},
+{{0,0}},
+{{0x308,0x4ed}},
+{{0,0}},
+{{0x308,0x457}},
+{{0,0}},
+{{0x30f,0x476}},
+{{0,0}},
+{{0x30f,0x477}},
+{{0,0}},
+{{0x308,0x4da}},
+{{0,0}},
+{{0x308,0x4db}},
+{{0,0}},
+{{0x308,0x4ea}},
+{{0,0}},
+{{0x308,0x4eb}},
+{{0,0}},
+{{0x653,0x622}},
+{{0x654,0x623}},
+{{0x655,0x625}},
+{{0,0}},
+{{0x654,0x624}},
+{{0,0}},
+{{0x654,0x626}},
+{{0,0}},
+{{0x654,0x6c2}},
+{{0,0}},
+{{0x654,0x6d3}},
+{{0,0}},
+{{0x654,0x6c0}},
+{{0,0}},
+{{0x93c,0x929}},
+{{0,0}},
+{{0x93c,0x931}},
+{{0,0}},
+{{0x93c,0x934}},
+{{0,0}},
+{{0x9be,0x9cb}},
+{{0x9d7,0x9cc}},
+{{0,0}},
+{{0xb3e,0xb4b}},
+{{0xb56,0xb48}},
+{{0xb57,0xb4c}},
+{{0,0}},
+{{0xbd7,0xb94}},
+{{0,0}},
+{{0xbbe,0xbca}},
+{{0xbd7,0xbcc}},
+{{0,0}},
+{{0xbbe,0xbcb}},
+{{0,0}},
+{{0xc56,0xc48}},
+{{0,0}},
+{{0xcd5,0xcc0}},
+{{0,0}},
+{{0xcc2,0xcca}},
+{{0xcd5,0xcc7}},
+{{0xcd6,0xcc8}},
+{{0,0}},
+{{0xcd5,0xccb}},
+{{0,0}},
+{{0xd3e,0xd4a}},
+{{0xd57,0xd4c}},
+{{0,0}},
+{{0xd3e,0xd4b}},
+{{0,0}},
+{{0xdca,0xdda}},
+{{0xdcf,0xddc}},
+{{0xddf,0xdde}},
+{{0,0}},
+{{0xdca,0xddd}},
+{{0,0}},
+{{0x102e,0x1026}},
+{{0,0}},
+{{0x1b35,0x1b06}},
+{{0,0}},
+{{0x1b35,0x1b08}},
+{{0,0}},
+{{0x1b35,0x1b0a}},
+{{0,0}},
+{{0x1b35,0x1b0c}},
+{{0,0}},
+{{0x1b35,0x1b0e}},
+{{0,0}},
+{{0x1b35,0x1b12}},
+{{0,0}},
+{{0x1b35,0x1b3b}},
+{{0,0}},
+{{0x1b35,0x1b3d}},
+{{0,0}},
+{{0x1b35,0x1b40}},
+{{0,0}},
+{{0x1b35,0x1b41}},
+{{0,0}},
+{{0x1b35,0x1b43}},
+{{0,0}},
+{{0x304,0x1e38}},
+{{0,0}},
+{{0x304,0x1e39}},
+{{0,0}},
+{{0x304,0x1e5c}},
+{{0,0}},
+{{0x304,0x1e5d}},
+{{0,0}},
+{{0x307,0x1e68}},
+{{0,0}},
+{{0x307,0x1e69}},
+{{0,0}},
+{{0x302,0x1eac}},
+{{0x306,0x1eb6}},
+{{0,0}},
+{{0x302,0x1ead}},
+{{0x306,0x1eb7}},
+{{0,0}},
+{{0x302,0x1ec6}},
+{{0,0}},
+{{0x302,0x1ec7}},
+{{0,0}},
+{{0x302,0x1ed8}},
+{{0,0}},
+{{0x302,0x1ed9}},
+{{0,0}},
+{{0x300,0x1f02}},
+{{0x301,0x1f04}},
+{{0x342,0x1f06}},
+{{0x345,0x1f80}},
+{{0,0}},
+{{0x300,0x1f03}},
+{{0x301,0x1f05}},
+{{0x342,0x1f07}},
+{{0x345,0x1f81}},
+{{0,0}},
+{{0x345,0x1f82}},
+{{0,0}},
+{{0x345,0x1f83}},
+{{0,0}},
+{{0x345,0x1f84}},
+{{0,0}},
+{{0x345,0x1f85}},
+{{0,0}},
+{{0x345,0x1f86}},
+{{0,0}},
+{{0x345,0x1f87}},
+{{0,0}},
+{{0x300,0x1f0a}},
+{{0x301,0x1f0c}},
+{{0x342,0x1f0e}},
+{{0x345,0x1f88}},
+{{0,0}},
+{{0x300,0x1f0b}},
+{{0x301,0x1f0d}},
+{{0x342,0x1f0f}},
+{{0x345,0x1f89}},
+{{0,0}},
+{{0x345,0x1f8a}},
+{{0,0}},
+{{0x345,0x1f8b}},
+{{0,0}},
+{{0x345,0x1f8c}},
+{{0,0}},
+{{0x345,0x1f8d}},
+{{0,0}},
+{{0x345,0x1f8e}},
+{{0,0}},
+{{0x345,0x1f8f}},
+{{0,0}},
+{{0x300,0x1f12}},
+{{0x301,0x1f14}},
+{{0,0}},
+{{0x300,0x1f13}},
+{{0x301,0x1f15}},
+{{0,0}},
+{{0x300,0x1f1a}},
+{{0x301,0x1f1c}},
+{{0,0}},
+{{0x300,0x1f1b}},
+{{0x301,0x1f1d}},
+{{0,0}},
+{{0x300,0x1f22}},
+{{0x301,0x1f24}},
+{{0x342,0x1f26}},
+{{0x345,0x1f90}},
+{{0,0}},
+{{0x300,0x1f23}},
+{{0x301,0x1f25}},
+{{0x342,0x1f27}},
+{{0x345,0x1f91}},
+{{0,0}},
+{{0x345,0x1f92}},
+{{0,0}},
+{{0x345,0x1f93}},
+{{0,0}},
+{{0x345,0x1f94}},
+{{0,0}},
+{{0x345,0x1f95}},
+{{0,0}},
+{{0x345,0x1f96}},
+{{0,0}},
+{{0x345,0x1f97}},
+{{0,0}},
+{{0x300,0x1f2a}},
+{{0x301,0x1f2c}},
+{{0x342,0x1f2e}},
+{{0x345,0x1f98}},
+{{0,0}},
+{{0x300,0x1f2b}},
+{{0x301,0x1f2d}},
+{{0x342,0x1f2f}},
+{{0x345,0x1f99}},
+{{0,0}},
+{{0x345,0x1f9a}},
+{{0,0}},
+{{0x345,0x1f9b}},
+{{0,0}},
+{{0x345,0x1f9c}},
+{{0,0}},
+{{0x345,0x1f9d}},
+{{0,0}},
+{{0x345,0x1f9e}},
+{{0,0}},
+{{0x345,0x1f9f}},
+{{0,0}},
+{{0x300,0x1f32}},
+{{0x301,0x1f34}},
+{{0x342,0x1f36}},
+{{0,0}},
+{{0x300,0x1f33}},
+{{0x301,0x1f35}},
+{{0x342,0x1f37}},
+{{0,0}},
+{{0x300,0x1f3a}},
+{{0x301,0x1f3c}},
+{{0x342,0x1f3e}},
+{{0,0}},
+{{0x300,0x1f3b}},
+{{0x301,0x1f3d}},
+{{0x342,0x1f3f}},
+{{0,0}},
+{{0x300,0x1f42}},
+{{0x301,0x1f44}},
+{{0,0}},
+{{0x300,0x1f43}},
+{{0x301,0x1f45}},
+{{0,0}},
+{{0x300,0x1f4a}},
+{{0x301,0x1f4c}},
+{{0,0}},
+{{0x300,0x1f4b}},
+{{0x301,0x1f4d}},
+{{0,0}},
+{{0x300,0x1f52}},
+{{0x301,0x1f54}},
+{{0x342,0x1f56}},
+{{0,0}},
+{{0x300,0x1f53}},
+{{0x301,0x1f55}},
+{{0x342,0x1f57}},
+{{0,0}},
+{{0x300,0x1f5b}},
+{{0x301,0x1f5d}},
+{{0x342,0x1f5f}},
+{{0,0}},
+{{0x300,0x1f62}},
+{{0x301,0x1f64}},
+{{0x342,0x1f66}},
+{{0x345,0x1fa0}},
+{{0,0}},
+{{0x300,0x1f63}},
+{{0x301,0x1f65}},
+{{0x342,0x1f67}},
+{{0x345,0x1fa1}},
+{{0,0}},
+{{0x345,0x1fa2}},
+{{0,0}},
+{{0x345,0x1fa3}},
+{{0,0}},
+{{0x345,0x1fa4}},
+{{0,0}},
+{{0x345,0x1fa5}},
+{{0,0}},
+{{0x345,0x1fa6}},
+{{0,0}},
+{{0x345,0x1fa7}},
+{{0,0}},
+{{0x300,0x1f6a}},
+{{0x301,0x1f6c}},
+{{0x342,0x1f6e}},
+{{0x345,0x1fa8}},
+{{0,0}},
+{{0x300,0x1f6b}},
+{{0x301,0x1f6d}},
+{{0x342,0x1f6f}},
+{{0x345,0x1fa9}},
+{{0,0}},
+{{0x345,0x1faa}},
+{{0,0}},
+{{0x345,0x1fab}},
+{{0,0}},
+{{0x345,0x1fac}},
+{{0,0}},
+{{0x345,0x1fad}},
+{{0,0}},
+{{0x345,0x1fae}},
+{{0,0}},
+{{0x345,0x1faf}},
+{{0,0}},
+{{0x345,0x1fb2}},
+{{0,0}},
+{{0x345,0x1fc2}},
+{{0,0}},
+{{0x345,0x1ff2}},
+{{0,0}},
+{{0x345,0x1fb7}},
+{{0,0}},
+{{0x300,0x1fcd}},
+{{0x301,0x1fce}},
+{{0x342,0x1fcf}},
+{{0,0}},
+{{0x345,0x1fc7}},
+{{0,0}},
+{{0x345,0x1ff7}},
+{{0,0}},
+{{0x300,0x1fdd}},
+{{0x301,0x1fde}},
+{{0x342,0x1fdf}},
+{{0,0}},
+{{0x338,0x219a}},
+{{0,0}},
+{{0x338,0x219b}},
+{{0,0}},
+{{0x338,0x21ae}},
+{{0,0}},
+{{0x338,0x21cd}},
+{{0,0}},
+{{0x338,0x21cf}},
+{{0,0}},
+{{0x338,0x21ce}},
+{{0,0}},
+{{0x338,0x2204}},
+{{0,0}},
+{{0x338,0x2209}},
+{{0,0}},
+{{0x338,0x220c}},
+{{0,0}},
+{{0x338,0x2224}},
+{{0,0}},
+{{0x338,0x2226}},
+{{0,0}},
+{{0x338,0x2241}},
+{{0,0}},
+{{0x338,0x2244}},
+{{0,0}},
+{{0x338,0x2247}},
+{{0,0}},
+{{0x338,0x2249}},
+{{0,0}},
+{{0x338,0x226d}},
+{{0,0}},
+{{0x338,0x2262}},
+{{0,0}},
+{{0x338,0x2270}},
+{{0,0}},
+{{0x338,0x2271}},
+{{0,0}},
+{{0x338,0x2274}},
+{{0,0}},
+{{0x338,0x2275}},
+{{0,0}},
+{{0x338,0x2278}},
+{{0,0}},
+{{0x338,0x2279}},
+{{0,0}},
+{{0x338,0x2280}},
+{{0,0}},
+{{0x338,0x2281}},
+{{0,0}},
+{{0x338,0x22e0}},
+{{0,0}},
+{{0x338,0x22e1}},
+{{0,0}},
+{{0x338,0x2284}},
+{{0,0}},
+{{0x338,0x2285}},
+{{0,0}},
+{{0x338,0x2288}},
+{{0,0}},
+{{0x338,0x2289}},
+{{0,0}},
+{{0x338,0x22e2}},
+{{0,0}},
+{{0x338,0x22e3}},
+{{0,0}},
+{{0x338,0x22ac}},
+{{0,0}},
+{{0x338,0x22ad}},
+{{0,0}},
+{{0x338,0x22ae}},
+{{0,0}},
+{{0x338,0x22af}},
+{{0,0}},
+{{0x338,0x22ea}},
+{{0,0}},
+{{0x338,0x22eb}},
+{{0,0}},
+{{0x338,0x22ec}},
+{{0,0}},
+{{0x338,0x22ed}},
+{{0,0}},
+{{0x3099,0x3094}},
+{{0,0}},
+{{0x3099,0x304c}},
+{{0,0}},
+{{0x3099,0x304e}},
+{{0,0}},
+{{0x3099,0x3050}},
+{{0,0}},
+{{0x3099,0x3052}},
+{{0,0}},
+{{0x3099,0x3054}},
+{{0,0}},
+{{0x3099,0x3056}},
+{{0,0}},
+{{0x3099,0x3058}},
+{{0,0}},
+{{0x3099,0x305a}},
+{{0,0}},
+{{0x3099,0x305c}},
+{{0,0}},
+{{0x3099,0x305e}},
+{{0,0}},
+{{0x3099,0x3060}},
+{{0,0}},
+{{0x3099,0x3062}},
+{{0,0}},
+{{0x3099,0x3065}},
+{{0,0}},
+{{0x3099,0x3067}},
+{{0,0}},
+{{0x3099,0x3069}},
+{{0,0}},
+{{0x3099,0x3070}},
+{{0x309a,0x3071}},
+{{0,0}},
+{{0x3099,0x3073}},
+{{0x309a,0x3074}},
+{{0,0}},
+{{0x3099,0x3076}},
+{{0x309a,0x3077}},
+{{0,0}},
+{{0x3099,0x3079}},
+{{0x309a,0x307a}},
+{{0,0}},
+{{0x3099,0x307c}},
+{{0x309a,0x307d}},
+{{0,0}},
+{{0x3099,0x309e}},
+{{0,0}},
+{{0x3099,0x30f4}},
+{{0,0}},
+{{0x3099,0x30ac}},
+{{0,0}},
+{{0x3099,0x30ae}},
+{{0,0}},
+{{0x3099,0x30b0}},
+{{0,0}},
+{{0x3099,0x30b2}},
+{{0,0}},
+{{0x3099,0x30b4}},
+{{0,0}},
+{{0x3099,0x30b6}},
+{{0,0}},
+{{0x3099,0x30b8}},
+{{0,0}},
+{{0x3099,0x30ba}},
+{{0,0}},
+{{0x3099,0x30bc}},
+{{0,0}},
+{{0x3099,0x30be}},
+{{0,0}},
+{{0x3099,0x30c0}},
+{{0,0}},
+{{0x3099,0x30c2}},
+{{0,0}},
+{{0x3099,0x30c5}},
+{{0,0}},
+{{0x3099,0x30c7}},
+{{0,0}},
+{{0x3099,0x30c9}},
+{{0,0}},
+{{0x3099,0x30d0}},
+{{0x309a,0x30d1}},
+{{0,0}},
+{{0x3099,0x30d3}},
+{{0x309a,0x30d4}},
+{{0,0}},
+{{0x3099,0x30d6}},
+{{0x309a,0x30d7}},
+{{0,0}},
+{{0x3099,0x30d9}},
+{{0x309a,0x30da}},
+{{0,0}},
+{{0x3099,0x30dc}},
+{{0x309a,0x30dd}},
+{{0,0}},
+{{0x3099,0x30f7}},
+{{0,0}},
+{{0x3099,0x30f8}},
+{{0,0}},
+{{0x3099,0x30f9}},
+{{0,0}},
+{{0x3099,0x30fa}},
+{{0,0}},
+{{0x3099,0x30fe}},
+{{0,0}},
+{{0x110ba,0x1109a}},
+{{0,0}},
+{{0x110ba,0x1109c}},
+{{0,0}},
+{{0x110ba,0x110ab}},
+{{0,0}},
+{{0x11127,0x1112e}},
+{{0,0}},
+{{0x11127,0x1112f}},
+{{0,0}},
+{{0x1133e,0x1134b}},
+{{0x11357,0x1134c}},
+{{0,0}},
+{{0x114b0,0x114bc}},
+{{0x114ba,0x114bb}},
+{{0x114bd,0x114be}},
+{{0,0}},
+{{0x115af,0x115ba}},
+{{0,0}},
+{{0x115af,0x115bb}},
+{{0,0}},
+}};
+
+const Irange<std::array<char32_t, 2> const*> composition_list_table {&composition_list_array[0], &composition_list_array[0] + composition_list_array.size()};
+
+const std::array<uint16_t, 556> composition_second_index = {{
+0,0,0,0,0,0,1,0,0,0,0,0,2,0,0,0,
+0,0,3,4,0,0,5,4,6,7,4,8,0,0,0,0,
+9,0,10,11,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,12,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,14,15,0,0,0,4,0,0,16,0,17,
+}};
+
+const std::array<uint8_t, 2304> composition_second_leaves = {{
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,1,1,1,1,0,1,1,1,1,1,1,1,0,0,1,
+0,1,0,1,1,0,0,0,0,0,0,1,0,0,0,0,
+0,0,0,1,1,1,1,1,1,0,0,0,0,1,1,0,
+1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+}};
+
+const TrieTable<bool, uint8_t> composition_second_trie {{&composition_second_index[0], &composition_second_index[0] + composition_second_index.size()}, &composition_second_leaves[0], 0};
+
+const std::array<uint16_t, 1525> nfc_quick_check_index = {{
+0,0,0,0,0,0,1,2,0,0,0,0,3,0,0,0,
+0,0,4,5,6,0,7,8,9,10,8,11,0,0,12,13,
+14,0,15,16,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,17,0,0,0,0,0,0,0,18,19,
+20,0,21,0,0,0,22,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,23,0,0,0,0,0,0,0,0,0,0,
+0,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,25,25,26,27,28,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,29,30,0,0,0,8,0,0,31,0,32,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,33,34,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+25,25,25,25,35,
+}};
+
+const std::array<uint8_t, 4608> nfc_quick_check_leaves = {{
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,1,1,1,1,0,1,1,1,1,1,1,1,0,0,1,
+0,1,0,1,1,0,0,0,0,0,0,1,0,0,0,0,
+0,0,0,1,1,1,1,1,1,0,0,0,0,1,1,0,
+1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+2,2,1,2,2,1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,2,0,0,0,0,0,0,0,0,0,2,0,
+0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,2,2,2,2,2,2,2,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,1,0,0,0,0,2,2,0,2,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,2,0,0,2,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,2,2,2,0,0,2,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,1,1,0,0,0,0,2,2,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,2,0,0,0,0,0,0,0,0,0,2,0,0,
+0,0,2,0,0,0,0,2,0,0,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,
+0,0,0,2,0,2,2,0,2,0,0,0,0,0,0,0,
+0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,2,0,0,0,0,0,0,0,0,0,2,0,0,
+0,0,2,0,0,0,0,2,0,0,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,2,0,2,0,2,0,2,0,2,0,2,0,2,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,2,0,0,2,0,
+0,0,0,0,0,0,0,0,0,2,0,2,0,0,0,0,
+0,0,0,2,0,0,0,0,0,0,0,2,0,0,0,0,
+0,0,0,2,0,0,0,0,0,0,0,2,0,0,2,2,
+0,0,0,0,0,0,0,0,0,2,0,2,0,2,0,0,
+2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,2,0,0,0,2,2,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,2,2,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,0,
+2,0,2,0,0,2,2,2,2,2,2,2,2,2,2,0,
+2,0,2,0,0,2,2,0,0,0,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,2,
+0,0,0,0,0,0,0,0,0,0,2,2,2,2,2,2,
+2,2,2,2,2,2,2,0,2,2,2,2,2,0,2,0,
+2,2,0,2,2,0,2,2,2,2,2,2,2,2,2,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,
+2,2,2,2,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,2,2,2,2,2,
+2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+}};
+
+const TrieTable<Quick_Check, uint8_t> nfc_quick_check_trie {{&nfc_quick_check_index[0], &nfc_quick_check_index[0] + nfc_quick_check_index.size()}, &nfc_quick_check_leaves[0], 0};
+
+const std::array<uint16_t, 1525> nfd_quick_check_index = {{
+0,1,2,3,4,0,5,6,7,8,0,0,9,10,0,0,
+0,0,11,12,13,0,14,15,16,17,18,19,0,0,20,21,
+22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,23,0,0,0,0,0,24,25,26,27,
+28,0,29,30,31,32,33,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,34,0,0,0,0,0,0,0,0,0,0,
+35,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,24,24,24,24,24,24,24,24,
+24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,37,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,24,24,38,39,40,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,41,42,0,0,0,43,0,0,44,0,45,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,46,47,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+24,24,24,24,48,
+}};
+
+const std::array<uint8_t, 6272> nfd_quick_check_leaves = {{
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,0,2,2,2,2,2,2,2,2,2,
+0,2,2,2,2,2,2,0,0,2,2,2,2,2,0,0,
+2,2,2,2,2,2,0,2,2,2,2,2,2,2,2,2,
+0,2,2,2,2,2,2,0,0,2,2,2,2,2,0,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+0,0,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,0,0,2,2,2,2,2,2,2,2,
+2,0,0,0,2,2,2,2,0,2,2,2,2,2,2,0,
+0,0,0,2,2,2,2,2,2,0,0,0,2,2,2,2,
+2,2,0,0,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,0,0,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,2,
+2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,0,2,2,
+2,2,2,2,0,0,2,2,2,2,2,2,2,2,2,2,
+2,0,0,0,2,2,0,0,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,0,0,2,2,
+0,0,0,0,0,0,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,0,2,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,2,0,0,0,0,0,0,0,0,0,2,0,
+0,0,0,0,0,2,2,2,2,2,2,0,2,0,2,2,
+2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,2,2,2,2,2,2,
+2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,2,2,2,2,2,0,
+0,0,0,2,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,0,2,0,0,0,2,0,0,0,0,2,2,2,0,
+0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,0,2,0,0,0,2,0,0,0,0,2,2,2,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,2,2,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,0,0,2,2,0,0,2,2,2,2,2,2,
+0,0,2,2,2,2,2,2,0,0,2,2,2,2,2,2,
+2,2,2,2,2,2,0,0,2,2,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,2,2,2,2,2,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,
+0,2,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,2,2,2,2,2,2,2,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,2,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,2,2,0,2,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,2,0,0,2,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,2,2,2,0,0,2,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,0,0,2,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,2,2,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,2,2,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,0,0,0,0,0,0,2,2,0,2,2,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,2,2,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,2,0,2,2,2,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,2,0,0,0,0,0,0,0,0,0,2,0,0,
+0,0,2,0,0,0,0,2,0,0,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,
+0,0,0,2,0,2,2,0,2,0,0,0,0,0,0,0,
+0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,2,0,0,0,0,0,0,0,0,0,2,0,0,
+0,0,2,0,0,0,0,2,0,0,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,2,0,2,0,2,0,2,0,2,0,
+0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,2,0,2,0,0,
+2,2,0,2,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,0,2,0,0,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,0,0,2,2,2,2,2,2,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,0,0,2,2,2,2,2,2,0,0,
+2,2,2,2,2,2,2,2,0,2,0,2,0,2,0,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,0,2,2,2,2,2,2,2,0,2,0,
+0,2,2,2,2,0,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,0,0,2,2,2,2,2,2,0,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+0,0,2,2,2,0,2,2,2,2,2,2,2,2,0,0,
+2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,2,0,0,0,2,2,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,2,2,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,2,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,2,0,0,0,0,2,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,2,0,2,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,2,0,0,2,0,0,2,0,2,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,0,2,0,0,0,0,0,0,0,0,0,0,2,2,2,
+2,2,0,0,2,2,0,0,2,2,0,0,0,0,0,0,
+2,2,0,0,2,2,0,0,2,2,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,2,2,2,2,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,0,0,0,0,0,0,2,2,2,2,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,2,2,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,2,0,2,0,
+2,0,2,0,2,0,2,0,2,0,2,0,2,0,2,0,
+2,0,2,0,0,2,0,2,0,2,0,0,0,0,0,0,
+2,2,0,2,2,0,2,2,0,2,2,0,2,2,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,2,0,0,0,0,0,0,0,0,0,2,0,
+0,0,0,0,0,0,0,0,0,0,0,0,2,0,2,0,
+2,0,2,0,2,0,2,0,2,0,2,0,2,0,2,0,
+2,0,2,0,0,2,0,2,0,2,0,0,0,0,0,0,
+2,2,0,2,2,0,2,2,0,2,2,0,2,2,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,2,0,0,2,2,2,2,0,0,0,2,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,0,
+2,0,2,0,0,2,2,2,2,2,2,2,2,2,2,0,
+2,0,2,0,0,2,2,0,0,0,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,2,
+0,0,0,0,0,0,0,0,0,0,2,2,2,2,2,2,
+2,2,2,2,2,2,2,0,2,2,2,2,2,0,2,0,
+2,2,0,2,2,0,2,2,2,2,2,2,2,2,2,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,2,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,2,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,2,2,0,2,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,2,2,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,
+2,2,2,2,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,2,2,2,2,2,
+2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+}};
+
+const TrieTable<Quick_Check, uint8_t> nfd_quick_check_trie {{&nfd_quick_check_index[0], &nfd_quick_check_index[0] + nfd_quick_check_index.size()}, &nfd_quick_check_leaves[0], 0};
+
+const std::array<uint16_t, 1525> nfkc_quick_check_index = {{
+0,1,2,3,0,4,5,6,0,0,0,7,8,0,0,0,
+0,0,9,10,11,0,12,13,14,15,13,16,17,18,19,20,
+21,22,23,24,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,25,0,0,0,26,27,0,28,29,30,
+31,32,33,34,35,0,36,0,37,38,0,0,0,0,0,0,
+0,0,0,0,39,40,0,0,41,0,42,0,0,43,44,45,
+46,47,48,49,50,51,44,44,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,52,53,54,
+0,0,0,0,0,0,55,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,44,44,56,57,58,59,44,44,60,61,62,63,64,65,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,66,67,0,0,0,13,0,0,68,0,69,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,70,71,0,0,0,0,72,73,74,44,44,75,44,76,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,77,78,0,0,
+0,0,79,80,81,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+44,44,44,44,82,
+}};
+
+const std::array<uint8_t, 10624> nfkc_quick_check_leaves = {{
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,0,0,0,0,0,0,0,2,0,2,0,0,0,0,2,
+0,0,2,2,2,2,0,0,2,2,2,0,2,2,2,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,2,2,0,0,0,0,0,0,0,0,0,0,0,2,
+2,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,2,2,2,2,2,2,2,2,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,2,2,2,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,2,2,2,2,2,0,0,
+2,2,2,2,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,1,1,1,1,0,1,1,1,1,1,1,1,0,0,1,
+0,1,0,1,1,0,0,0,0,0,0,1,0,0,0,0,
+0,0,0,1,1,1,1,1,1,0,0,0,0,1,1,0,
+1,1,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+2,2,1,2,2,1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,2,0,0,0,0,0,2,0,0,0,2,0,
+0,0,0,0,2,2,0,2,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,0,2,2,0,0,0,2,0,0,0,0,0,0,
+0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,1,1,1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,2,2,2,2,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,2,2,2,2,2,2,2,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,1,0,0,0,0,2,2,0,2,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,2,0,0,2,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,2,2,2,0,0,2,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,1,1,0,0,0,0,2,2,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,2,2,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,2,0,0,0,0,0,0,0,0,0,2,0,0,
+0,0,2,0,0,0,0,2,0,0,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,
+0,0,0,2,0,2,2,2,2,2,0,0,0,0,0,0,
+0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,2,0,0,0,0,0,0,0,0,0,2,0,0,
+0,0,2,0,0,0,0,2,0,0,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,2,2,2,0,
+2,2,2,2,2,2,2,2,2,2,2,0,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,2,2,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,2,0,2,0,2,0,2,0,2,0,2,0,2,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,2,0,2,2,2,
+2,2,0,0,0,0,0,0,0,2,0,2,0,2,2,2,
+0,0,0,2,0,0,0,0,0,0,0,2,0,2,2,2,
+0,0,0,2,0,0,0,0,0,0,0,2,0,2,2,2,
+0,0,0,0,0,0,0,0,0,2,0,2,0,2,2,0,
+2,2,2,2,2,2,2,2,2,2,2,0,0,0,0,0,
+0,2,0,0,0,0,0,2,0,0,0,0,0,0,0,0,
+0,0,0,0,2,2,2,0,0,0,0,0,0,0,0,2,
+0,0,0,2,2,0,2,2,0,0,0,0,2,0,2,0,
+0,0,0,0,0,0,0,2,2,2,0,0,0,0,0,0,
+0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,2,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,0,0,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,0,0,0,
+0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,0,2,2,2,0,2,2,2,2,2,2,2,
+2,2,2,2,0,2,2,0,0,2,2,2,2,2,0,0,
+2,2,2,0,2,0,2,0,2,0,2,2,2,2,0,2,
+2,2,0,2,2,2,2,2,2,2,0,2,2,2,2,2,
+2,0,0,0,0,2,2,2,2,2,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,2,2,0,2,
+2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,2,2,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,2,2,2,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,2,2,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,2,0,2,2,2,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,1,1,2,2,0,0,2,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,
+0,0,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,2,2,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,2,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,2,2,2,2,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,0,
+2,0,2,0,0,2,2,2,2,2,2,2,2,2,2,0,
+2,0,2,0,0,2,2,0,0,0,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,0,0,0,0,0,0,0,0,0,
+0,0,0,2,2,2,2,2,0,0,0,0,0,2,0,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,0,2,2,2,2,2,0,2,0,
+2,2,0,2,2,0,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+0,0,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,2,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,0,0,2,2,2,2,2,2,2,2,2,
+2,2,2,0,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,0,2,2,2,2,0,0,0,0,
+2,2,2,0,2,0,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,0,0,0,
+0,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,
+0,0,2,2,2,2,2,2,0,0,2,2,2,2,2,2,
+0,0,2,2,2,2,2,2,0,0,2,2,2,0,0,0,
+2,2,2,2,2,2,2,0,2,2,2,2,2,2,2,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,
+2,2,2,2,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,2,2,2,2,2,
+2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,0,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,0,2,2,
+0,0,2,0,0,2,2,0,0,2,2,2,2,0,2,2,
+2,2,2,2,2,2,2,2,2,2,0,2,0,2,2,2,
+2,2,2,2,0,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,0,2,2,2,2,0,0,2,2,2,
+2,2,2,2,2,0,2,2,2,2,2,2,2,0,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,0,2,2,2,2,0,
+2,2,2,2,2,0,2,0,0,0,2,2,2,2,2,2,
+2,0,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,0,0,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,0,0,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,0,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+0,2,2,0,2,0,0,2,0,2,2,2,2,2,2,2,
+2,2,2,0,2,2,2,2,0,2,0,2,0,0,0,0,
+0,0,2,0,0,0,0,2,0,2,0,2,0,2,2,2,
+0,2,2,0,2,0,0,2,0,2,0,2,0,2,0,2,
+0,2,2,0,2,0,0,2,2,2,2,0,2,2,2,2,
+2,2,2,0,2,2,2,2,0,2,2,2,2,0,2,0,
+2,2,2,2,2,2,2,2,2,2,0,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,0,0,0,0,
+0,2,2,2,0,2,2,2,2,2,0,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,2,2,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,2,2,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,0,0,0,0,0,0,0,
+2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+}};
+
+const TrieTable<Quick_Check, uint8_t> nfkc_quick_check_trie {{&nfkc_quick_check_index[0], &nfkc_quick_check_index[0] + nfkc_quick_check_index.size()}, &nfkc_quick_check_leaves[0], 0};
+
+const std::array<uint16_t, 1525> nfkd_quick_check_index = {{
+0,1,2,3,4,5,6,7,8,9,0,10,11,12,0,0,
+0,0,13,14,15,0,16,17,18,19,20,21,22,23,24,25,
+26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,28,0,0,0,29,30,31,32,33,34,
+35,36,37,38,39,40,41,0,42,43,0,0,0,0,0,0,
+0,0,0,0,44,45,0,0,46,0,47,0,0,48,31,49,
+50,51,52,53,54,55,31,31,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,56,57,58,
+0,0,0,0,0,0,59,0,31,31,31,31,31,31,31,31,
+31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,
+31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,60,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,31,31,61,62,63,64,31,31,65,66,67,68,69,70,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,71,72,0,0,0,73,0,0,74,0,75,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,76,77,0,0,0,0,78,79,80,31,31,81,31,82,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,83,84,0,0,
+0,0,85,86,87,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+31,31,31,31,88,
+}};
+
+const std::array<uint8_t, 11392> nfkd_quick_check_leaves = {{
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,0,0,0,0,0,0,0,2,0,2,0,0,0,0,2,
+0,0,2,2,2,2,0,0,2,2,2,0,2,2,2,0,
+2,2,2,2,2,2,0,2,2,2,2,2,2,2,2,2,
+0,2,2,2,2,2,2,0,0,2,2,2,2,2,0,0,
+2,2,2,2,2,2,0,2,2,2,2,2,2,2,2,2,
+0,2,2,2,2,2,2,0,0,2,2,2,2,2,0,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+0,0,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,0,0,2,2,2,2,2,2,2,2,
+2,0,2,2,2,2,2,2,0,2,2,2,2,2,2,2,
+2,0,0,2,2,2,2,2,2,2,0,0,2,2,2,2,
+2,2,0,0,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,0,0,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,2,
+2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,0,2,2,
+2,2,2,2,0,0,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,0,0,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,0,0,2,2,
+0,0,0,0,0,0,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,2,2,2,2,2,0,0,
+2,2,2,2,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,0,2,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,2,0,0,0,0,0,2,0,0,0,2,0,
+0,0,0,0,2,2,2,2,2,2,2,0,2,0,2,2,
+2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,2,2,2,2,2,2,
+2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,2,2,2,2,2,0,
+2,2,2,2,2,2,2,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,0,2,2,0,0,0,2,0,0,0,0,0,0,
+2,2,0,2,0,0,0,2,0,0,0,0,2,2,2,0,
+0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,0,2,0,0,0,2,0,0,0,0,2,2,2,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,2,2,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,0,0,2,2,0,0,2,2,2,2,2,2,
+0,0,2,2,2,2,2,2,0,0,2,2,2,2,2,2,
+2,2,2,2,2,2,0,0,2,2,0,0,0,0,0,0,
+0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,2,2,2,2,2,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,2,2,2,2,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,
+0,2,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,2,2,2,2,2,2,2,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,2,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,2,2,0,2,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,2,0,0,2,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,2,2,2,0,0,2,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,0,0,2,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,2,2,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,2,2,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,0,0,0,0,0,0,2,2,0,2,2,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,2,2,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,2,0,2,2,2,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,2,2,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,2,0,0,0,0,0,0,0,0,0,2,0,0,
+0,0,2,0,0,0,0,2,0,0,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,
+0,0,0,2,0,2,2,2,2,2,0,0,0,0,0,0,
+0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,2,0,0,0,0,0,0,0,0,0,2,0,0,
+0,0,2,0,0,0,0,2,0,0,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,
+0,0,0,0,0,0,2,0,2,0,2,0,2,0,2,0,
+0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,2,0,2,0,0,
+2,2,0,2,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,2,2,2,0,
+2,2,2,2,2,2,2,2,2,2,2,0,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,0,0,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,0,0,2,2,2,2,2,2,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,0,0,2,2,2,2,2,2,0,0,
+2,2,2,2,2,2,2,2,0,2,0,2,0,2,0,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,0,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,0,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,0,0,2,2,2,2,2,2,0,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+0,0,2,2,2,0,2,2,2,2,2,2,2,2,2,0,
+2,2,2,2,2,2,2,2,2,2,2,0,0,0,0,0,
+0,2,0,0,0,0,0,2,0,0,0,0,0,0,0,0,
+0,0,0,0,2,2,2,0,0,0,0,0,0,0,0,2,
+0,0,0,2,2,0,2,2,0,0,0,0,2,0,2,0,
+0,0,0,0,0,0,0,2,2,2,0,0,0,0,0,0,
+0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,2,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,0,0,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,0,0,0,
+0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,0,2,2,2,0,2,2,2,2,2,2,2,
+2,2,2,2,0,2,2,0,0,2,2,2,2,2,0,0,
+2,2,2,0,2,0,2,0,2,0,2,2,2,2,0,2,
+2,2,0,2,2,2,2,2,2,2,0,2,2,2,2,2,
+2,0,0,0,0,2,2,2,2,2,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,2,2,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,2,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,2,0,0,0,0,2,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,2,0,2,0,0,0,0,0,2,2,0,2,
+2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,2,0,0,2,0,0,2,0,2,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,0,2,0,0,0,0,0,0,0,0,0,0,2,2,2,
+2,2,0,0,2,2,0,0,2,2,0,0,0,0,0,0,
+2,2,0,0,2,2,0,0,2,2,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,2,2,2,2,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,0,0,0,0,0,0,2,2,2,2,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,2,2,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,2,2,2,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,2,2,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,2,0,2,2,2,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,2,0,2,0,
+2,0,2,0,2,0,2,0,2,0,2,0,2,0,2,0,
+2,0,2,0,0,2,0,2,0,2,0,0,0,0,0,0,
+2,2,0,2,2,0,2,2,0,2,2,0,2,2,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,2,0,0,0,0,0,0,2,2,0,2,2,
+0,0,0,0,0,0,0,0,0,0,0,0,2,0,2,0,
+2,0,2,0,2,0,2,0,2,0,2,0,2,0,2,0,
+2,0,2,0,0,2,0,2,0,2,0,0,0,0,0,0,
+2,2,0,2,2,0,2,2,0,2,2,0,2,2,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,2,0,0,2,2,2,2,0,0,0,2,2,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,
+0,0,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,2,2,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,2,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,2,2,2,2,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,0,
+2,0,2,0,0,2,2,2,2,2,2,2,2,2,2,0,
+2,0,2,0,0,2,2,0,0,0,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,0,0,0,0,0,0,0,0,0,
+0,0,0,2,2,2,2,2,0,0,0,0,0,2,0,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,0,2,2,2,2,2,0,2,0,
+2,2,0,2,2,0,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+0,0,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,2,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,0,0,2,2,2,2,2,2,2,2,2,
+2,2,2,0,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,0,2,2,2,2,0,0,0,0,
+2,2,2,0,2,0,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,0,0,0,
+0,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,
+0,0,2,2,2,2,2,2,0,0,2,2,2,2,2,2,
+0,0,2,2,2,2,2,2,0,0,2,2,2,0,0,0,
+2,2,2,2,2,2,2,0,2,2,2,2,2,2,2,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,2,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,2,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,2,2,0,2,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,2,2,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,
+2,2,2,2,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,2,2,2,2,2,
+2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,0,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,0,2,2,
+0,0,2,0,0,2,2,0,0,2,2,2,2,0,2,2,
+2,2,2,2,2,2,2,2,2,2,0,2,0,2,2,2,
+2,2,2,2,0,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,0,2,2,2,2,0,0,2,2,2,
+2,2,2,2,2,0,2,2,2,2,2,2,2,0,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,0,2,2,2,2,0,
+2,2,2,2,2,0,2,0,0,0,2,2,2,2,2,2,
+2,0,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,0,0,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,0,0,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,0,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+0,2,2,0,2,0,0,2,0,2,2,2,2,2,2,2,
+2,2,2,0,2,2,2,2,0,2,0,2,0,0,0,0,
+0,0,2,0,0,0,0,2,0,2,0,2,0,2,2,2,
+0,2,2,0,2,0,0,2,0,2,0,2,0,2,0,2,
+0,2,2,0,2,0,0,2,2,2,2,0,2,2,2,2,
+2,2,2,0,2,2,2,2,0,2,2,2,2,0,2,0,
+2,2,2,2,2,2,2,2,2,2,0,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,0,0,0,0,
+0,2,2,2,0,2,2,2,2,2,0,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,2,2,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,2,2,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,0,0,0,0,0,0,0,
+2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
 }};
 
-const TableView<std::array<char32_t, 2>, char32_t> composition_table {&composition_array[0], &composition_array[0] + composition_array.size()};
+const TrieTable<Quick_Check, uint8_t> nfkd_quick_check_trie {{&nfkd_quick_check_index[0], &nfkd_quick_check_index[0] + nfkd_quick_check_index.size()}, &nfkd_quick_check_leaves[0], 0};
 
 }
@@ -2,1444 +2,2086 @@
 
 namespace RS::Unicorn::UnicornDetail {
 
-const std::array<KeyValue<char32_t, uint32_t>, 1434> scripts_array = {{
-{0x0,2054781305},
-{0x41,1818326126},
-{0x5b,2054781305},
-{0x61,1818326126},
-{0x7b,2054781305},
-{0xaa,1818326126},
-{0xab,2054781305},
-{0xba,1818326126},
-{0xbb,2054781305},
-{0xc0,1818326126},
-{0xd7,2054781305},
-{0xd8,1818326126},
-{0xf7,2054781305},
-{0xf8,1818326126},
-{0x2b9,2054781305},
-{0x2e0,1818326126},
-{0x2e5,2054781305},
-{0x2ea,1651470447},
-{0x2ec,2054781305},
-{0x300,2053729896},
-{0x370,1735550315},
-{0x374,2054781305},
-{0x375,1735550315},
-{0x378,2054847098},
-{0x37a,1735550315},
-{0x37e,2054781305},
-{0x37f,1735550315},
-{0x380,2054847098},
-{0x384,1735550315},
-{0x385,2054781305},
-{0x386,1735550315},
-{0x387,2054781305},
-{0x388,1735550315},
-{0x38b,2054847098},
-{0x38c,1735550315},
-{0x38d,2054847098},
-{0x38e,1735550315},
-{0x3a2,2054847098},
-{0x3a3,1735550315},
-{0x3e2,1668247668},
-{0x3f0,1735550315},
-{0x400,1668903539},
-{0x485,2053729896},
-{0x487,1668903539},
-{0x530,2054847098},
-{0x531,1634889070},
-{0x557,2054847098},
-{0x559,1634889070},
-{0x560,2054847098},
-{0x561,1634889070},
-{0x588,2054847098},
-{0x589,2054781305},
-{0x58a,1634889070},
-{0x58b,2054847098},
-{0x58d,1634889070},
-{0x590,2054847098},
-{0x591,1751474802},
-{0x5c8,2054847098},
-{0x5d0,1751474802},
-{0x5eb,2054847098},
-{0x5f0,1751474802},
-{0x5f5,2054847098},
-{0x600,1634885998},
-{0x605,2054781305},
-{0x606,1634885998},
-{0x60c,2054781305},
-{0x60d,1634885998},
-{0x61b,2054781305},
-{0x61d,2054847098},
-{0x61e,1634885998},
-{0x61f,2054781305},
-{0x620,1634885998},
-{0x640,2054781305},
-{0x641,1634885998},
-{0x64b,2053729896},
-{0x656,1634885998},
-{0x670,2053729896},
-{0x671,1634885998},
-{0x6dd,2054781305},
-{0x6de,1634885998},
-{0x700,1937338990},
-{0x70e,2054847098},
-{0x70f,1937338990},
-{0x74b,2054847098},
-{0x74d,1937338990},
-{0x750,1634885998},
-{0x780,1952997729},
-{0x7b2,2054847098},
-{0x7c0,1852534639},
-{0x7fb,2054847098},
-{0x800,1935764850},
-{0x82e,2054847098},
-{0x830,1935764850},
-{0x83f,2054847098},
-{0x840,1835101796},
-{0x85c,2054847098},
-{0x85e,1835101796},
-{0x85f,2054847098},
-{0x8a0,1634885998},
-{0x8b5,2054847098},
-{0x8e3,1634885998},
-{0x900,1684371041},
-{0x951,2053729896},
-{0x953,1684371041},
-{0x964,2054781305},
-{0x966,1684371041},
-{0x980,1650814567},
-{0x984,2054847098},
-{0x985,1650814567},
-{0x98d,2054847098},
-{0x98f,1650814567},
-{0x991,2054847098},
-{0x993,1650814567},
-{0x9a9,2054847098},
-{0x9aa,1650814567},
-{0x9b1,2054847098},
-{0x9b2,1650814567},
-{0x9b3,2054847098},
-{0x9b6,1650814567},
-{0x9ba,2054847098},
-{0x9bc,1650814567},
-{0x9c5,2054847098},
-{0x9c7,1650814567},
-{0x9c9,2054847098},
-{0x9cb,1650814567},
-{0x9cf,2054847098},
-{0x9d7,1650814567},
-{0x9d8,2054847098},
-{0x9dc,1650814567},
-{0x9de,2054847098},
-{0x9df,1650814567},
-{0x9e4,2054847098},
-{0x9e6,1650814567},
-{0x9fc,2054847098},
-{0xa01,1735750261},
-{0xa04,2054847098},
-{0xa05,1735750261},
-{0xa0b,2054847098},
-{0xa0f,1735750261},
-{0xa11,2054847098},
-{0xa13,1735750261},
-{0xa29,2054847098},
-{0xa2a,1735750261},
-{0xa31,2054847098},
-{0xa32,1735750261},
-{0xa34,2054847098},
-{0xa35,1735750261},
-{0xa37,2054847098},
-{0xa38,1735750261},
-{0xa3a,2054847098},
-{0xa3c,1735750261},
-{0xa3d,2054847098},
-{0xa3e,1735750261},
-{0xa43,2054847098},
-{0xa47,1735750261},
-{0xa49,2054847098},
-{0xa4b,1735750261},
-{0xa4e,2054847098},
-{0xa51,1735750261},
-{0xa52,2054847098},
-{0xa59,1735750261},
-{0xa5d,2054847098},
-{0xa5e,1735750261},
-{0xa5f,2054847098},
-{0xa66,1735750261},
-{0xa76,2054847098},
-{0xa81,1735748210},
-{0xa84,2054847098},
-{0xa85,1735748210},
-{0xa8e,2054847098},
-{0xa8f,1735748210},
-{0xa92,2054847098},
-{0xa93,1735748210},
-{0xaa9,2054847098},
-{0xaaa,1735748210},
-{0xab1,2054847098},
-{0xab2,1735748210},
-{0xab4,2054847098},
-{0xab5,1735748210},
-{0xaba,2054847098},
-{0xabc,1735748210},
-{0xac6,2054847098},
-{0xac7,1735748210},
-{0xaca,2054847098},
-{0xacb,1735748210},
-{0xace,2054847098},
-{0xad0,1735748210},
-{0xad1,2054847098},
-{0xae0,1735748210},
-{0xae4,2054847098},
-{0xae6,1735748210},
-{0xaf2,2054847098},
-{0xaf9,1735748210},
-{0xafa,2054847098},
-{0xb01,1869773153},
-{0xb04,2054847098},
-{0xb05,1869773153},
-{0xb0d,2054847098},
-{0xb0f,1869773153},
-{0xb11,2054847098},
-{0xb13,1869773153},
-{0xb29,2054847098},
-{0xb2a,1869773153},
-{0xb31,2054847098},
-{0xb32,1869773153},
-{0xb34,2054847098},
-{0xb35,1869773153},
-{0xb3a,2054847098},
-{0xb3c,1869773153},
-{0xb45,2054847098},
-{0xb47,1869773153},
-{0xb49,2054847098},
-{0xb4b,1869773153},
-{0xb4e,2054847098},
-{0xb56,1869773153},
-{0xb58,2054847098},
-{0xb5c,1869773153},
-{0xb5e,2054847098},
-{0xb5f,1869773153},
-{0xb64,2054847098},
-{0xb66,1869773153},
-{0xb78,2054847098},
-{0xb82,1952542060},
-{0xb84,2054847098},
-{0xb85,1952542060},
-{0xb8b,2054847098},
-{0xb8e,1952542060},
-{0xb91,2054847098},
-{0xb92,1952542060},
-{0xb96,2054847098},
-{0xb99,1952542060},
-{0xb9b,2054847098},
-{0xb9c,1952542060},
-{0xb9d,2054847098},
-{0xb9e,1952542060},
-{0xba0,2054847098},
-{0xba3,1952542060},
-{0xba5,2054847098},
-{0xba8,1952542060},
-{0xbab,2054847098},
-{0xbae,1952542060},
-{0xbba,2054847098},
-{0xbbe,1952542060},
-{0xbc3,2054847098},
-{0xbc6,1952542060},
-{0xbc9,2054847098},
-{0xbca,1952542060},
-{0xbce,2054847098},
-{0xbd0,1952542060},
-{0xbd1,2054847098},
-{0xbd7,1952542060},
-{0xbd8,2054847098},
-{0xbe6,1952542060},
-{0xbfb,2054847098},
-{0xc00,1952803957},
-{0xc04,2054847098},
-{0xc05,1952803957},
-{0xc0d,2054847098},
-{0xc0e,1952803957},
-{0xc11,2054847098},
-{0xc12,1952803957},
-{0xc29,2054847098},
-{0xc2a,1952803957},
-{0xc3a,2054847098},
-{0xc3d,1952803957},
-{0xc45,2054847098},
-{0xc46,1952803957},
-{0xc49,2054847098},
-{0xc4a,1952803957},
-{0xc4e,2054847098},
-{0xc55,1952803957},
-{0xc57,2054847098},
-{0xc58,1952803957},
-{0xc5b,2054847098},
-{0xc60,1952803957},
-{0xc64,2054847098},
-{0xc66,1952803957},
-{0xc70,2054847098},
-{0xc78,1952803957},
-{0xc80,2054847098},
-{0xc81,1802396769},
-{0xc84,2054847098},
-{0xc85,1802396769},
-{0xc8d,2054847098},
-{0xc8e,1802396769},
-{0xc91,2054847098},
-{0xc92,1802396769},
-{0xca9,2054847098},
-{0xcaa,1802396769},
-{0xcb4,2054847098},
-{0xcb5,1802396769},
-{0xcba,2054847098},
-{0xcbc,1802396769},
-{0xcc5,2054847098},
-{0xcc6,1802396769},
-{0xcc9,2054847098},
-{0xcca,1802396769},
-{0xcce,2054847098},
-{0xcd5,1802396769},
-{0xcd7,2054847098},
-{0xcde,1802396769},
-{0xcdf,2054847098},
-{0xce0,1802396769},
-{0xce4,2054847098},
-{0xce6,1802396769},
-{0xcf0,2054847098},
-{0xcf1,1802396769},
-{0xcf3,2054847098},
-{0xd01,1835825517},
-{0xd04,2054847098},
-{0xd05,1835825517},
-{0xd0d,2054847098},
-{0xd0e,1835825517},
-{0xd11,2054847098},
-{0xd12,1835825517},
-{0xd3b,2054847098},
-{0xd3d,1835825517},
-{0xd45,2054847098},
-{0xd46,1835825517},
-{0xd49,2054847098},
-{0xd4a,1835825517},
-{0xd4f,2054847098},
-{0xd57,1835825517},
-{0xd58,2054847098},
-{0xd5f,1835825517},
-{0xd64,2054847098},
-{0xd66,1835825517},
-{0xd76,2054847098},
-{0xd79,1835825517},
-{0xd80,2054847098},
-{0xd82,1936289384},
-{0xd84,2054847098},
-{0xd85,1936289384},
-{0xd97,2054847098},
-{0xd9a,1936289384},
-{0xdb2,2054847098},
-{0xdb3,1936289384},
-{0xdbc,2054847098},
-{0xdbd,1936289384},
-{0xdbe,2054847098},
-{0xdc0,1936289384},
-{0xdc7,2054847098},
-{0xdca,1936289384},
-{0xdcb,2054847098},
-{0xdcf,1936289384},
-{0xdd5,2054847098},
-{0xdd6,1936289384},
-{0xdd7,2054847098},
-{0xdd8,1936289384},
-{0xde0,2054847098},
-{0xde6,1936289384},
-{0xdf0,2054847098},
-{0xdf2,1936289384},
-{0xdf5,2054847098},
-{0xe01,1952997737},
-{0xe3b,2054847098},
-{0xe3f,2054781305},
-{0xe40,1952997737},
-{0xe5c,2054847098},
-{0xe81,1818324847},
-{0xe83,2054847098},
-{0xe84,1818324847},
-{0xe85,2054847098},
-{0xe87,1818324847},
-{0xe89,2054847098},
-{0xe8a,1818324847},
-{0xe8b,2054847098},
-{0xe8d,1818324847},
-{0xe8e,2054847098},
-{0xe94,1818324847},
-{0xe98,2054847098},
-{0xe99,1818324847},
-{0xea0,2054847098},
-{0xea1,1818324847},
-{0xea4,2054847098},
-{0xea5,1818324847},
-{0xea6,2054847098},
-{0xea7,1818324847},
-{0xea8,2054847098},
-{0xeaa,1818324847},
-{0xeac,2054847098},
-{0xead,1818324847},
-{0xeba,2054847098},
-{0xebb,1818324847},
-{0xebe,2054847098},
-{0xec0,1818324847},
-{0xec5,2054847098},
-{0xec6,1818324847},
-{0xec7,2054847098},
-{0xec8,1818324847},
-{0xece,2054847098},
-{0xed0,1818324847},
-{0xeda,2054847098},
-{0xedc,1818324847},
-{0xee0,2054847098},
-{0xf00,1953063540},
-{0xf48,2054847098},
-{0xf49,1953063540},
-{0xf6d,2054847098},
-{0xf71,1953063540},
-{0xf98,2054847098},
-{0xf99,1953063540},
-{0xfbd,2054847098},
-{0xfbe,1953063540},
-{0xfcd,2054847098},
-{0xfce,1953063540},
-{0xfd5,2054781305},
-{0xfd9,1953063540},
-{0xfdb,2054847098},
-{0x1000,1836674418},
-{0x10a0,1734700914},
-{0x10c6,2054847098},
-{0x10c7,1734700914},
-{0x10c8,2054847098},
-{0x10cd,1734700914},
-{0x10ce,2054847098},
-{0x10d0,1734700914},
-{0x10fb,2054781305},
-{0x10fc,1734700914},
-{0x1100,1751215719},
-{0x1200,1702127721},
-{0x1249,2054847098},
-{0x124a,1702127721},
-{0x124e,2054847098},
-{0x1250,1702127721},
-{0x1257,2054847098},
-{0x1258,1702127721},
-{0x1259,2054847098},
-{0x125a,1702127721},
-{0x125e,2054847098},
-{0x1260,1702127721},
-{0x1289,2054847098},
-{0x128a,1702127721},
-{0x128e,2054847098},
-{0x1290,1702127721},
-{0x12b1,2054847098},
-{0x12b2,1702127721},
-{0x12b6,2054847098},
-{0x12b8,1702127721},
-{0x12bf,2054847098},
-{0x12c0,1702127721},
-{0x12c1,2054847098},
-{0x12c2,1702127721},
-{0x12c6,2054847098},
-{0x12c8,1702127721},
-{0x12d7,2054847098},
-{0x12d8,1702127721},
-{0x1311,2054847098},
-{0x1312,1702127721},
-{0x1316,2054847098},
-{0x1318,1702127721},
-{0x135b,2054847098},
-{0x135d,1702127721},
-{0x137d,2054847098},
-{0x1380,1702127721},
-{0x139a,2054847098},
-{0x13a0,1667786098},
-{0x13f6,2054847098},
-{0x13f8,1667786098},
-{0x13fe,2054847098},
-{0x1400,1667329651},
-{0x1680,1869046125},
-{0x169d,2054847098},
-{0x16a0,1920298610},
-{0x16eb,2054781305},
-{0x16ee,1920298610},
-{0x16f9,2054847098},
-{0x1700,1952935015},
-{0x170d,2054847098},
-{0x170e,1952935015},
-{0x1715,2054847098},
-{0x1720,1751215727},
-{0x1735,2054781305},
-{0x1737,2054847098},
-{0x1740,1651861604},
-{0x1754,2054847098},
-{0x1760,1952540514},
-{0x176d,2054847098},
-{0x176e,1952540514},
-{0x1771,2054847098},
-{0x1772,1952540514},
-{0x1774,2054847098},
-{0x1780,1802005874},
-{0x17de,2054847098},
-{0x17e0,1802005874},
-{0x17ea,2054847098},
-{0x17f0,1802005874},
-{0x17fa,2054847098},
-{0x1800,1836019303},
-{0x1802,2054781305},
-{0x1804,1836019303},
-{0x1805,2054781305},
-{0x1806,1836019303},
-{0x180f,2054847098},
-{0x1810,1836019303},
-{0x181a,2054847098},
-{0x1820,1836019303},
-{0x1878,2054847098},
-{0x1880,1836019303},
-{0x18ab,2054847098},
-{0x18b0,1667329651},
-{0x18f6,2054847098},
-{0x1900,1818848610},
-{0x191f,2054847098},
-{0x1920,1818848610},
-{0x192c,2054847098},
-{0x1930,1818848610},
-{0x193c,2054847098},
-{0x1940,1818848610},
-{0x1941,2054847098},
-{0x1944,1818848610},
-{0x1950,1952541797},
-{0x196e,2054847098},
-{0x1970,1952541797},
-{0x1975,2054847098},
-{0x1980,1952541813},
-{0x19ac,2054847098},
-{0x19b0,1952541813},
-{0x19ca,2054847098},
-{0x19d0,1952541813},
-{0x19db,2054847098},
-{0x19de,1952541813},
-{0x19e0,1802005874},
-{0x1a00,1651861353},
-{0x1a1c,2054847098},
-{0x1a1e,1651861353},
-{0x1a20,1818324577},
-{0x1a5f,2054847098},
-{0x1a60,1818324577},
-{0x1a7d,2054847098},
-{0x1a7f,1818324577},
-{0x1a8a,2054847098},
-{0x1a90,1818324577},
-{0x1a9a,2054847098},
-{0x1aa0,1818324577},
-{0x1aae,2054847098},
-{0x1ab0,2053729896},
-{0x1abf,2054847098},
-{0x1b00,1650551913},
-{0x1b4c,2054847098},
-{0x1b50,1650551913},
-{0x1b7d,2054847098},
-{0x1b80,1937075812},
-{0x1bc0,1650553963},
-{0x1bf4,2054847098},
-{0x1bfc,1650553963},
-{0x1c00,1818587235},
-{0x1c38,2054847098},
-{0x1c3b,1818587235},
-{0x1c4a,2054847098},
-{0x1c4d,1818587235},
-{0x1c50,1869374315},
-{0x1c80,2054847098},
-{0x1cc0,1937075812},
-{0x1cc8,2054847098},
-{0x1cd0,2053729896},
-{0x1cd3,2054781305},
-{0x1cd4,2053729896},
-{0x1ce1,2054781305},
-{0x1ce2,2053729896},
-{0x1ce9,2054781305},
-{0x1ced,2053729896},
-{0x1cee,2054781305},
-{0x1cf4,2053729896},
-{0x1cf5,2054781305},
-{0x1cf7,2054847098},
-{0x1cf8,2053729896},
-{0x1cfa,2054847098},
-{0x1d00,1818326126},
-{0x1d26,1735550315},
-{0x1d2b,1668903539},
-{0x1d2c,1818326126},
-{0x1d5d,1735550315},
-{0x1d62,1818326126},
-{0x1d66,1735550315},
-{0x1d6b,1818326126},
-{0x1d78,1668903539},
-{0x1d79,1818326126},
-{0x1dbf,1735550315},
-{0x1dc0,2053729896},
-{0x1df6,2054847098},
-{0x1dfc,2053729896},
-{0x1e00,1818326126},
-{0x1f00,1735550315},
-{0x1f16,2054847098},
-{0x1f18,1735550315},
-{0x1f1e,2054847098},
-{0x1f20,1735550315},
-{0x1f46,2054847098},
-{0x1f48,1735550315},
-{0x1f4e,2054847098},
-{0x1f50,1735550315},
-{0x1f58,2054847098},
-{0x1f59,1735550315},
-{0x1f5a,2054847098},
-{0x1f5b,1735550315},
-{0x1f5c,2054847098},
-{0x1f5d,1735550315},
-{0x1f5e,2054847098},
-{0x1f5f,1735550315},
-{0x1f7e,2054847098},
-{0x1f80,1735550315},
-{0x1fb5,2054847098},
-{0x1fb6,1735550315},
-{0x1fc5,2054847098},
-{0x1fc6,1735550315},
-{0x1fd4,2054847098},
-{0x1fd6,1735550315},
-{0x1fdc,2054847098},
-{0x1fdd,1735550315},
-{0x1ff0,2054847098},
-{0x1ff2,1735550315},
-{0x1ff5,2054847098},
-{0x1ff6,1735550315},
-{0x1fff,2054847098},
-{0x2000,2054781305},
-{0x200c,2053729896},
-{0x200e,2054781305},
-{0x2065,2054847098},
-{0x2066,2054781305},
-{0x2071,1818326126},
-{0x2072,2054847098},
-{0x2074,2054781305},
-{0x207f,1818326126},
-{0x2080,2054781305},
-{0x208f,2054847098},
-{0x2090,1818326126},
-{0x209d,2054847098},
-{0x20a0,2054781305},
-{0x20bf,2054847098},
-{0x20d0,2053729896},
-{0x20f1,2054847098},
-{0x2100,2054781305},
-{0x2126,1735550315},
-{0x2127,2054781305},
-{0x212a,1818326126},
-{0x212c,2054781305},
-{0x2132,1818326126},
-{0x2133,2054781305},
-{0x214e,1818326126},
-{0x214f,2054781305},
-{0x2160,1818326126},
-{0x2189,2054781305},
-{0x218c,2054847098},
-{0x2190,2054781305},
-{0x23fb,2054847098},
-{0x2400,2054781305},
-{0x2427,2054847098},
-{0x2440,2054781305},
-{0x244b,2054847098},
-{0x2460,2054781305},
-{0x2800,1651663209},
-{0x2900,2054781305},
-{0x2b74,2054847098},
-{0x2b76,2054781305},
-{0x2b96,2054847098},
-{0x2b98,2054781305},
-{0x2bba,2054847098},
-{0x2bbd,2054781305},
-{0x2bc9,2054847098},
-{0x2bca,2054781305},
-{0x2bd2,2054847098},
-{0x2bec,2054781305},
-{0x2bf0,2054847098},
-{0x2c00,1735156071},
-{0x2c2f,2054847098},
-{0x2c30,1735156071},
-{0x2c5f,2054847098},
-{0x2c60,1818326126},
-{0x2c80,1668247668},
-{0x2cf4,2054847098},
-{0x2cf9,1668247668},
-{0x2d00,1734700914},
-{0x2d26,2054847098},
-{0x2d27,1734700914},
-{0x2d28,2054847098},
-{0x2d2d,1734700914},
-{0x2d2e,2054847098},
-{0x2d30,1952869991},
-{0x2d68,2054847098},
-{0x2d6f,1952869991},
-{0x2d71,2054847098},
-{0x2d7f,1952869991},
-{0x2d80,1702127721},
-{0x2d97,2054847098},
-{0x2da0,1702127721},
-{0x2da7,2054847098},
-{0x2da8,1702127721},
-{0x2daf,2054847098},
-{0x2db0,1702127721},
-{0x2db7,2054847098},
-{0x2db8,1702127721},
-{0x2dbf,2054847098},
-{0x2dc0,1702127721},
-{0x2dc7,2054847098},
-{0x2dc8,1702127721},
-{0x2dcf,2054847098},
-{0x2dd0,1702127721},
-{0x2dd7,2054847098},
-{0x2dd8,1702127721},
-{0x2ddf,2054847098},
-{0x2de0,1668903539},
-{0x2e00,2054781305},
-{0x2e43,2054847098},
-{0x2e80,1751215732},
-{0x2e9a,2054847098},
-{0x2e9b,1751215732},
-{0x2ef4,2054847098},
-{0x2f00,1751215732},
-{0x2fd6,2054847098},
-{0x2ff0,2054781305},
-{0x2ffc,2054847098},
-{0x3000,2054781305},
-{0x3005,1751215732},
-{0x3006,2054781305},
-{0x3007,1751215732},
-{0x3008,2054781305},
-{0x3021,1751215732},
-{0x302a,2053729896},
-{0x302e,1751215719},
-{0x3030,2054781305},
-{0x3038,1751215732},
-{0x303c,2054781305},
-{0x3040,2054847098},
-{0x3041,1751741025},
-{0x3097,2054847098},
-{0x3099,2053729896},
-{0x309b,2054781305},
-{0x309d,1751741025},
-{0x30a0,2054781305},
-{0x30a1,1801547361},
-{0x30fb,2054781305},
-{0x30fd,1801547361},
-{0x3100,2054847098},
-{0x3105,1651470447},
-{0x312e,2054847098},
-{0x3131,1751215719},
-{0x318f,2054847098},
-{0x3190,2054781305},
-{0x31a0,1651470447},
-{0x31bb,2054847098},
-{0x31c0,2054781305},
-{0x31e4,2054847098},
-{0x31f0,1801547361},
-{0x3200,1751215719},
-{0x321f,2054847098},
-{0x3220,2054781305},
-{0x3260,1751215719},
-{0x327f,2054781305},
-{0x32d0,1801547361},
-{0x32ff,2054847098},
-{0x3300,1801547361},
-{0x3358,2054781305},
-{0x3400,1751215732},
-{0x4db6,2054847098},
-{0x4dc0,2054781305},
-{0x4e00,1751215732},
-{0x9fd6,2054847098},
-{0xa000,2036951401},
-{0xa48d,2054847098},
-{0xa490,2036951401},
-{0xa4c7,2054847098},
-{0xa4d0,1818850165},
-{0xa500,1986095465},
-{0xa62c,2054847098},
-{0xa640,1668903539},
-{0xa6a0,1650552181},
-{0xa6f8,2054847098},
-{0xa700,2054781305},
-{0xa722,1818326126},
-{0xa788,2054781305},
-{0xa78b,1818326126},
-{0xa7ae,2054847098},
-{0xa7b0,1818326126},
-{0xa7b8,2054847098},
-{0xa7f7,1818326126},
-{0xa800,1937337455},
-{0xa82c,2054847098},
-{0xa830,2054781305},
-{0xa83a,2054847098},
-{0xa840,1885888871},
-{0xa878,2054847098},
-{0xa880,1935766898},
-{0xa8c5,2054847098},
-{0xa8ce,1935766898},
-{0xa8da,2054847098},
-{0xa8e0,1684371041},
-{0xa8fe,2054847098},
-{0xa900,1801546857},
-{0xa92e,2054781305},
-{0xa92f,1801546857},
-{0xa930,1919577703},
-{0xa954,2054847098},
-{0xa95f,1919577703},
-{0xa960,1751215719},
-{0xa97d,2054847098},
-{0xa980,1784772193},
-{0xa9ce,2054847098},
-{0xa9cf,2054781305},
-{0xa9d0,1784772193},
-{0xa9da,2054847098},
-{0xa9de,1784772193},
-{0xa9e0,1836674418},
-{0xa9ff,2054847098},
-{0xaa00,1667785069},
-{0xaa37,2054847098},
-{0xaa40,1667785069},
-{0xaa4e,2054847098},
-{0xaa50,1667785069},
-{0xaa5a,2054847098},
-{0xaa5c,1667785069},
-{0xaa60,1836674418},
-{0xaa80,1952544372},
-{0xaac3,2054847098},
-{0xaadb,1952544372},
-{0xaae0,1836344681},
-{0xaaf7,2054847098},
-{0xab01,1702127721},
-{0xab07,2054847098},
-{0xab09,1702127721},
-{0xab0f,2054847098},
-{0xab11,1702127721},
-{0xab17,2054847098},
-{0xab20,1702127721},
-{0xab27,2054847098},
-{0xab28,1702127721},
-{0xab2f,2054847098},
-{0xab30,1818326126},
-{0xab5b,2054781305},
-{0xab5c,1818326126},
-{0xab65,1735550315},
-{0xab66,2054847098},
-{0xab70,1667786098},
-{0xabc0,1836344681},
-{0xabee,2054847098},
-{0xabf0,1836344681},
-{0xabfa,2054847098},
-{0xac00,1751215719},
-{0xd7a4,2054847098},
-{0xd7b0,1751215719},
-{0xd7c7,2054847098},
-{0xd7cb,1751215719},
-{0xd7fc,2054847098},
-{0xf900,1751215732},
-{0xfa6e,2054847098},
-{0xfa70,1751215732},
-{0xfada,2054847098},
-{0xfb00,1818326126},
-{0xfb07,2054847098},
-{0xfb13,1634889070},
-{0xfb18,2054847098},
-{0xfb1d,1751474802},
-{0xfb37,2054847098},
-{0xfb38,1751474802},
-{0xfb3d,2054847098},
-{0xfb3e,1751474802},
-{0xfb3f,2054847098},
-{0xfb40,1751474802},
-{0xfb42,2054847098},
-{0xfb43,1751474802},
-{0xfb45,2054847098},
-{0xfb46,1751474802},
-{0xfb50,1634885998},
-{0xfbc2,2054847098},
-{0xfbd3,1634885998},
-{0xfd3e,2054781305},
-{0xfd40,2054847098},
-{0xfd50,1634885998},
-{0xfd90,2054847098},
-{0xfd92,1634885998},
-{0xfdc8,2054847098},
-{0xfdf0,1634885998},
-{0xfdfe,2054847098},
-{0xfe00,2053729896},
-{0xfe10,2054781305},
-{0xfe1a,2054847098},
-{0xfe20,2053729896},
-{0xfe2e,1668903539},
-{0xfe30,2054781305},
-{0xfe53,2054847098},
-{0xfe54,2054781305},
-{0xfe67,2054847098},
-{0xfe68,2054781305},
-{0xfe6c,2054847098},
-{0xfe70,1634885998},
-{0xfe75,2054847098},
-{0xfe76,1634885998},
-{0xfefd,2054847098},
-{0xfeff,2054781305},
-{0xff00,2054847098},
-{0xff01,2054781305},
-{0xff21,1818326126},
-{0xff3b,2054781305},
-{0xff41,1818326126},
-{0xff5b,2054781305},
-{0xff66,1801547361},
-{0xff70,2054781305},
-{0xff71,1801547361},
-{0xff9e,2054781305},
-{0xffa0,1751215719},
-{0xffbf,2054847098},
-{0xffc2,1751215719},
-{0xffc8,2054847098},
-{0xffca,1751215719},
-{0xffd0,2054847098},
-{0xffd2,1751215719},
-{0xffd8,2054847098},
-{0xffda,1751215719},
-{0xffdd,2054847098},
-{0xffe0,2054781305},
-{0xffe7,2054847098},
-{0xffe8,2054781305},
-{0xffef,2054847098},
-{0xfff9,2054781305},
-{0xfffe,2054847098},
-{0x10000,1818848866},
-{0x1000c,2054847098},
-{0x1000d,1818848866},
-{0x10027,2054847098},
-{0x10028,1818848866},
-{0x1003b,2054847098},
-{0x1003c,1818848866},
-{0x1003e,2054847098},
-{0x1003f,1818848866},
-{0x1004e,2054847098},
-{0x10050,1818848866},
-{0x1005e,2054847098},
-{0x10080,1818848866},
-{0x100fb,2054847098},
-{0x10100,2054781305},
-{0x10103,2054847098},
-{0x10107,2054781305},
-{0x10134,2054847098},
-{0x10137,2054781305},
-{0x10140,1735550315},
-{0x1018d,2054847098},
-{0x10190,2054781305},
-{0x1019c,2054847098},
-{0x101a0,1735550315},
-{0x101a1,2054847098},
-{0x101d0,2054781305},
-{0x101fd,2053729896},
-{0x101fe,2054847098},
-{0x10280,1819894633},
-{0x1029d,2054847098},
-{0x102a0,1667330665},
-{0x102d1,2054847098},
-{0x102e0,2053729896},
-{0x102e1,2054781305},
-{0x102fc,2054847098},
-{0x10300,1769234796},
-{0x10324,2054847098},
-{0x10330,1735357544},
-{0x1034b,2054847098},
-{0x10350,1885696621},
-{0x1037b,2054847098},
-{0x10380,1969709426},
-{0x1039e,2054847098},
-{0x1039f,1969709426},
-{0x103a0,2020631919},
-{0x103c4,2054847098},
-{0x103c8,2020631919},
-{0x103d6,2054847098},
-{0x10400,1685287540},
-{0x10450,1936220535},
-{0x10480,1869835617},
-{0x1049e,2054847098},
-{0x104a0,1869835617},
-{0x104aa,2054847098},
-{0x10500,1701601889},
-{0x10528,2054847098},
-{0x10530,1634166882},
-{0x10564,2054847098},
-{0x1056f,1634166882},
-{0x10570,2054847098},
-{0x10600,1818848865},
-{0x10737,2054847098},
-{0x10740,1818848865},
-{0x10756,2054847098},
-{0x10760,1818848865},
-{0x10768,2054847098},
-{0x10800,1668313716},
-{0x10806,2054847098},
-{0x10808,1668313716},
-{0x10809,2054847098},
-{0x1080a,1668313716},
-{0x10836,2054847098},
-{0x10837,1668313716},
-{0x10839,2054847098},
-{0x1083c,1668313716},
-{0x1083d,2054847098},
-{0x1083f,1668313716},
-{0x10840,1634889065},
-{0x10856,2054847098},
-{0x10857,1634889065},
-{0x10860,1885432941},
-{0x10880,1851941236},
-{0x1089f,2054847098},
-{0x108a7,1851941236},
-{0x108b0,2054847098},
-{0x108e0,1751217266},
-{0x108f3,2054847098},
-{0x108f4,1751217266},
-{0x108f6,2054847098},
-{0x108fb,1751217266},
-{0x10900,1885892216},
-{0x1091c,2054847098},
-{0x1091f,1885892216},
-{0x10920,1819894889},
-{0x1093a,2054847098},
-{0x1093f,1819894889},
-{0x10940,2054847098},
-{0x10980,1835364975},
-{0x109a0,1835364963},
-{0x109b8,2054847098},
-{0x109bc,1835364963},
-{0x109d0,2054847098},
-{0x109d2,1835364963},
-{0x10a00,1802002802},
-{0x10a04,2054847098},
-{0x10a05,1802002802},
-{0x10a07,2054847098},
-{0x10a0c,1802002802},
-{0x10a14,2054847098},
-{0x10a15,1802002802},
-{0x10a18,2054847098},
-{0x10a19,1802002802},
-{0x10a34,2054847098},
-{0x10a38,1802002802},
-{0x10a3b,2054847098},
-{0x10a3f,1802002802},
-{0x10a48,2054847098},
-{0x10a50,1802002802},
-{0x10a59,2054847098},
-{0x10a60,1935766114},
-{0x10a80,1851880034},
-{0x10aa0,2054847098},
-{0x10ac0,1835101801},
-{0x10ae7,2054847098},
-{0x10aeb,1835101801},
-{0x10af7,2054847098},
-{0x10b00,1635152756},
-{0x10b36,2054847098},
-{0x10b39,1635152756},
-{0x10b40,1886549097},
-{0x10b56,2054847098},
-{0x10b58,1886549097},
-{0x10b60,1885891689},
-{0x10b73,2054847098},
-{0x10b78,1885891689},
-{0x10b80,1885891696},
-{0x10b92,2054847098},
-{0x10b99,1885891696},
-{0x10b9d,2054847098},
-{0x10ba9,1885891696},
-{0x10bb0,2054847098},
-{0x10c00,1869769576},
-{0x10c49,2054847098},
-{0x10c80,1752526439},
-{0x10cb3,2054847098},
-{0x10cc0,1752526439},
-{0x10cf3,2054847098},
-{0x10cfa,1752526439},
-{0x10d00,2054847098},
-{0x10e60,1634885998},
-{0x10e7f,2054847098},
-{0x11000,1651663208},
-{0x1104e,2054847098},
-{0x11052,1651663208},
-{0x11070,2054847098},
-{0x1107f,1651663208},
-{0x11080,1802791017},
-{0x110c2,2054847098},
-{0x110d0,1936683617},
-{0x110e9,2054847098},
-{0x110f0,1936683617},
-{0x110fa,2054847098},
-{0x11100,1667328877},
-{0x11135,2054847098},
-{0x11136,1667328877},
-{0x11144,2054847098},
-{0x11150,1835100266},
-{0x11177,2054847098},
-{0x11180,1936224868},
-{0x111ce,2054847098},
-{0x111d0,1936224868},
-{0x111e0,2054847098},
-{0x111e1,1936289384},
-{0x111f5,2054847098},
-{0x11200,1802006378},
-{0x11212,2054847098},
-{0x11213,1802006378},
-{0x1123e,2054847098},
-{0x11280,1836412020},
-{0x11287,2054847098},
-{0x11288,1836412020},
-{0x11289,2054847098},
-{0x1128a,1836412020},
-{0x1128e,2054847098},
-{0x1128f,1836412020},
-{0x1129e,2054847098},
-{0x1129f,1836412020},
-{0x112aa,2054847098},
-{0x112b0,1936289380},
-{0x112eb,2054847098},
-{0x112f0,1936289380},
-{0x112fa,2054847098},
-{0x11300,1735549294},
-{0x11304,2054847098},
-{0x11305,1735549294},
-{0x1130d,2054847098},
-{0x1130f,1735549294},
-{0x11311,2054847098},
-{0x11313,1735549294},
-{0x11329,2054847098},
-{0x1132a,1735549294},
-{0x11331,2054847098},
-{0x11332,1735549294},
-{0x11334,2054847098},
-{0x11335,1735549294},
-{0x1133a,2054847098},
-{0x1133c,1735549294},
-{0x11345,2054847098},
-{0x11347,1735549294},
-{0x11349,2054847098},
-{0x1134b,1735549294},
-{0x1134e,2054847098},
-{0x11350,1735549294},
-{0x11351,2054847098},
-{0x11357,1735549294},
-{0x11358,2054847098},
-{0x1135d,1735549294},
-{0x11364,2054847098},
-{0x11366,1735549294},
-{0x1136d,2054847098},
-{0x11370,1735549294},
-{0x11375,2054847098},
-{0x11480,1953067624},
-{0x114c8,2054847098},
-{0x114d0,1953067624},
-{0x114da,2054847098},
-{0x11580,1936286820},
-{0x115b6,2054847098},
-{0x115b8,1936286820},
-{0x115de,2054847098},
-{0x11600,1836016745},
-{0x11645,2054847098},
-{0x11650,1836016745},
-{0x1165a,2054847098},
-{0x11680,1952541554},
-{0x116b8,2054847098},
-{0x116c0,1952541554},
-{0x116ca,2054847098},
-{0x11700,1634234221},
-{0x1171a,2054847098},
-{0x1171d,1634234221},
-{0x1172c,2054847098},
-{0x11730,1634234221},
-{0x11740,2054847098},
-{0x118a0,2002874977},
-{0x118f3,2054847098},
-{0x118ff,2002874977},
-{0x11900,2054847098},
-{0x11ac0,1885435235},
-{0x11af9,2054847098},
-{0x12000,2020832632},
-{0x1239a,2054847098},
-{0x12400,2020832632},
-{0x1246f,2054847098},
-{0x12470,2020832632},
-{0x12475,2054847098},
-{0x12480,2020832632},
-{0x12544,2054847098},
-{0x13000,1701280112},
-{0x1342f,2054847098},
-{0x14400,1751938423},
-{0x14647,2054847098},
-{0x16800,1650552181},
-{0x16a39,2054847098},
-{0x16a40,1836216175},
-{0x16a5f,2054847098},
-{0x16a60,1836216175},
-{0x16a6a,2054847098},
-{0x16a6e,1836216175},
-{0x16a70,2054847098},
-{0x16ad0,1650553715},
-{0x16aee,2054847098},
-{0x16af0,1650553715},
-{0x16af6,2054847098},
-{0x16b00,1752002151},
-{0x16b46,2054847098},
-{0x16b50,1752002151},
-{0x16b5a,2054847098},
-{0x16b5b,1752002151},
-{0x16b62,2054847098},
-{0x16b63,1752002151},
-{0x16b78,2054847098},
-{0x16b7d,1752002151},
-{0x16b90,2054847098},
-{0x16f00,1886155364},
-{0x16f45,2054847098},
-{0x16f50,1886155364},
-{0x16f7f,2054847098},
-{0x16f8f,1886155364},
-{0x16fa0,2054847098},
-{0x1b000,1801547361},
-{0x1b001,1751741025},
-{0x1b002,2054847098},
-{0x1bc00,1685418092},
-{0x1bc6b,2054847098},
-{0x1bc70,1685418092},
-{0x1bc7d,2054847098},
-{0x1bc80,1685418092},
-{0x1bc89,2054847098},
-{0x1bc90,1685418092},
-{0x1bc9a,2054847098},
-{0x1bc9c,1685418092},
-{0x1bca0,2054781305},
-{0x1bca4,2054847098},
-{0x1d000,2054781305},
-{0x1d0f6,2054847098},
-{0x1d100,2054781305},
-{0x1d127,2054847098},
-{0x1d129,2054781305},
-{0x1d167,2053729896},
-{0x1d16a,2054781305},
-{0x1d17b,2053729896},
-{0x1d183,2054781305},
-{0x1d185,2053729896},
-{0x1d18c,2054781305},
-{0x1d1aa,2053729896},
-{0x1d1ae,2054781305},
-{0x1d1e9,2054847098},
-{0x1d200,1735550315},
-{0x1d246,2054847098},
-{0x1d300,2054781305},
-{0x1d357,2054847098},
-{0x1d360,2054781305},
-{0x1d372,2054847098},
-{0x1d400,2054781305},
-{0x1d455,2054847098},
-{0x1d456,2054781305},
-{0x1d49d,2054847098},
-{0x1d49e,2054781305},
-{0x1d4a0,2054847098},
-{0x1d4a2,2054781305},
-{0x1d4a3,2054847098},
-{0x1d4a5,2054781305},
-{0x1d4a7,2054847098},
-{0x1d4a9,2054781305},
-{0x1d4ad,2054847098},
-{0x1d4ae,2054781305},
-{0x1d4ba,2054847098},
-{0x1d4bb,2054781305},
-{0x1d4bc,2054847098},
-{0x1d4bd,2054781305},
-{0x1d4c4,2054847098},
-{0x1d4c5,2054781305},
-{0x1d506,2054847098},
-{0x1d507,2054781305},
-{0x1d50b,2054847098},
-{0x1d50d,2054781305},
-{0x1d515,2054847098},
-{0x1d516,2054781305},
-{0x1d51d,2054847098},
-{0x1d51e,2054781305},
-{0x1d53a,2054847098},
-{0x1d53b,2054781305},
-{0x1d53f,2054847098},
-{0x1d540,2054781305},
-{0x1d545,2054847098},
-{0x1d546,2054781305},
-{0x1d547,2054847098},
-{0x1d54a,2054781305},
-{0x1d551,2054847098},
-{0x1d552,2054781305},
-{0x1d6a6,2054847098},
-{0x1d6a8,2054781305},
-{0x1d7cc,2054847098},
-{0x1d7ce,2054781305},
-{0x1d800,1936158327},
-{0x1da8c,2054847098},
-{0x1da9b,1936158327},
-{0x1daa0,2054847098},
-{0x1daa1,1936158327},
-{0x1dab0,2054847098},
-{0x1e800,1835363940},
-{0x1e8c5,2054847098},
-{0x1e8c7,1835363940},
-{0x1e8d7,2054847098},
-{0x1ee00,1634885998},
-{0x1ee04,2054847098},
-{0x1ee05,1634885998},
-{0x1ee20,2054847098},
-{0x1ee21,1634885998},
-{0x1ee23,2054847098},
-{0x1ee24,1634885998},
-{0x1ee25,2054847098},
-{0x1ee27,1634885998},
-{0x1ee28,2054847098},
-{0x1ee29,1634885998},
-{0x1ee33,2054847098},
-{0x1ee34,1634885998},
-{0x1ee38,2054847098},
-{0x1ee39,1634885998},
-{0x1ee3a,2054847098},
-{0x1ee3b,1634885998},
-{0x1ee3c,2054847098},
-{0x1ee42,1634885998},
-{0x1ee43,2054847098},
-{0x1ee47,1634885998},
-{0x1ee48,2054847098},
-{0x1ee49,1634885998},
-{0x1ee4a,2054847098},
-{0x1ee4b,1634885998},
-{0x1ee4c,2054847098},
-{0x1ee4d,1634885998},
-{0x1ee50,2054847098},
-{0x1ee51,1634885998},
-{0x1ee53,2054847098},
-{0x1ee54,1634885998},
-{0x1ee55,2054847098},
-{0x1ee57,1634885998},
-{0x1ee58,2054847098},
-{0x1ee59,1634885998},
-{0x1ee5a,2054847098},
-{0x1ee5b,1634885998},
-{0x1ee5c,2054847098},
-{0x1ee5d,1634885998},
-{0x1ee5e,2054847098},
-{0x1ee5f,1634885998},
-{0x1ee60,2054847098},
-{0x1ee61,1634885998},
-{0x1ee63,2054847098},
-{0x1ee64,1634885998},
-{0x1ee65,2054847098},
-{0x1ee67,1634885998},
-{0x1ee6b,2054847098},
-{0x1ee6c,1634885998},
-{0x1ee73,2054847098},
-{0x1ee74,1634885998},
-{0x1ee78,2054847098},
-{0x1ee79,1634885998},
-{0x1ee7d,2054847098},
-{0x1ee7e,1634885998},
-{0x1ee7f,2054847098},
-{0x1ee80,1634885998},
-{0x1ee8a,2054847098},
-{0x1ee8b,1634885998},
-{0x1ee9c,2054847098},
-{0x1eea1,1634885998},
-{0x1eea4,2054847098},
-{0x1eea5,1634885998},
-{0x1eeaa,2054847098},
-{0x1eeab,1634885998},
-{0x1eebc,2054847098},
-{0x1eef0,1634885998},
-{0x1eef2,2054847098},
-{0x1f000,2054781305},
-{0x1f02c,2054847098},
-{0x1f030,2054781305},
-{0x1f094,2054847098},
-{0x1f0a0,2054781305},
-{0x1f0af,2054847098},
-{0x1f0b1,2054781305},
-{0x1f0c0,2054847098},
-{0x1f0c1,2054781305},
-{0x1f0d0,2054847098},
-{0x1f0d1,2054781305},
-{0x1f0f6,2054847098},
-{0x1f100,2054781305},
-{0x1f10d,2054847098},
-{0x1f110,2054781305},
-{0x1f12f,2054847098},
-{0x1f130,2054781305},
-{0x1f16c,2054847098},
-{0x1f170,2054781305},
-{0x1f19b,2054847098},
-{0x1f1e6,2054781305},
-{0x1f200,1751741025},
-{0x1f201,2054781305},
-{0x1f203,2054847098},
-{0x1f210,2054781305},
-{0x1f23b,2054847098},
-{0x1f240,2054781305},
-{0x1f249,2054847098},
-{0x1f250,2054781305},
-{0x1f252,2054847098},
-{0x1f300,2054781305},
-{0x1f57a,2054847098},
-{0x1f57b,2054781305},
-{0x1f5a4,2054847098},
-{0x1f5a5,2054781305},
-{0x1f6d1,2054847098},
-{0x1f6e0,2054781305},
-{0x1f6ed,2054847098},
-{0x1f6f0,2054781305},
-{0x1f6f4,2054847098},
-{0x1f700,2054781305},
-{0x1f774,2054847098},
-{0x1f780,2054781305},
-{0x1f7d5,2054847098},
-{0x1f800,2054781305},
-{0x1f80c,2054847098},
-{0x1f810,2054781305},
-{0x1f848,2054847098},
-{0x1f850,2054781305},
-{0x1f85a,2054847098},
-{0x1f860,2054781305},
-{0x1f888,2054847098},
-{0x1f890,2054781305},
-{0x1f8ae,2054847098},
-{0x1f910,2054781305},
-{0x1f919,2054847098},
-{0x1f980,2054781305},
-{0x1f985,2054847098},
-{0x1f9c0,2054781305},
-{0x1f9c1,2054847098},
-{0x20000,1751215732},
-{0x2a6d7,2054847098},
-{0x2a700,1751215732},
-{0x2b735,2054847098},
-{0x2b740,1751215732},
-{0x2b81e,2054847098},
-{0x2b820,1751215732},
-{0x2cea2,2054847098},
-{0x2f800,1751215732},
-{0x2fa1e,2054847098},
-{0xe0001,2054781305},
-{0xe0002,2054847098},
-{0xe0020,2054781305},
-{0xe0080,2054847098},
-{0xe0100,2053729896},
-{0xe01f0,2054847098},
+const std::array<uint16_t, 7172> scripts_index = {{
+0,1,2,2,2,3,4,5,6,7,8,9,10,11,12,13,
+14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,
+30,31,32,32,33,34,35,36,37,37,37,37,37,38,39,40,
+41,42,43,44,45,46,47,48,49,50,51,52,2,2,53,54,
+55,56,57,58,59,59,59,60,61,59,59,59,59,59,59,59,
+62,62,59,59,59,59,63,64,65,66,67,68,69,70,71,72,
+73,74,75,76,77,78,79,59,71,71,71,71,71,71,71,71,
+71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+71,71,71,71,71,71,71,71,71,71,71,80,71,71,71,71,
+71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,81,
+82,82,82,82,82,82,82,82,82,83,84,84,85,86,87,88,
+89,90,91,92,93,94,95,96,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,97,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,71,71,99,100,101,102,103,103,104,105,106,107,108,109,
+110,111,112,113,98,114,115,116,117,118,119,98,120,120,121,98,
+122,123,124,125,126,127,128,129,130,131,98,98,132,98,98,98,
+133,134,135,136,137,138,139,98,98,140,98,141,142,143,144,98,
+98,145,98,98,98,146,98,98,98,98,98,98,98,98,98,98,
+147,147,147,147,147,147,147,148,149,147,150,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+151,151,151,151,151,151,151,151,152,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,153,153,153,153,154,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+155,155,155,155,156,157,158,159,98,98,98,98,98,98,160,161,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+162,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,163,164,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+59,165,166,167,168,98,169,98,170,171,172,59,59,173,59,174,
+175,175,175,175,175,176,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+177,178,98,98,98,98,98,98,98,98,98,98,179,180,98,98,
+181,182,183,184,185,98,59,59,59,59,186,187,59,188,189,190,
+191,192,193,194,98,98,98,98,98,98,98,98,98,98,98,98,
+71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+71,71,71,71,71,71,71,71,71,71,71,71,71,195,71,71,
+71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+71,71,71,71,71,71,71,71,71,71,71,71,71,71,196,71,
+197,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+71,71,71,71,71,71,71,71,71,71,71,71,71,198,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+71,71,71,71,199,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,
+200,98,201,202,
 }};
 
-const TableView<char32_t, uint32_t> scripts_table {&scripts_array[0], &scripts_array[0] + scripts_array.size()};
+const std::array<uint32_t, 25984> scripts_leaves = {{
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,1818326126,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,1818326126,2054781305,2054781305,2054781305,2054781305,2054781305,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,2054781305,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,2054781305,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+1818326126,1818326126,1818326126,1818326126,1818326126,2054781305,2054781305,2054781305,2054781305,2054781305,1651470447,1651470447,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,
+2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,
+2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,
+2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,
+2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,
+2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,
+2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,
+1735550315,1735550315,1735550315,1735550315,2054781305,1735550315,1735550315,1735550315,2054847098,2054847098,1735550315,1735550315,1735550315,1735550315,2054781305,1735550315,
+2054847098,2054847098,2054847098,2054847098,1735550315,2054781305,1735550315,2054781305,1735550315,1735550315,1735550315,2054847098,1735550315,2054847098,1735550315,1735550315,
+1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,
+1735550315,1735550315,2054847098,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,
+1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,
+1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,
+1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,
+1735550315,1735550315,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,
+1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,
+1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,
+1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,
+1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,
+1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,
+1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,
+1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,
+1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,
+1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,
+1668903539,1668903539,1668903539,1668903539,1668903539,2053729896,2053729896,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,
+1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,
+1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,
+1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,
+1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,
+1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,
+1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,
+1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,
+1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,
+1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,
+1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,
+2054847098,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,
+1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,
+1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,2054847098,2054847098,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,
+2054847098,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,
+1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,
+1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,1634889070,2054847098,2054781305,1634889070,2054847098,2054847098,1634889070,1634889070,1634889070,
+2054847098,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,
+1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,
+1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,
+1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,
+1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,2054847098,2054847098,2054847098,2054847098,2054847098,
+1751474802,1751474802,1751474802,1751474802,1751474802,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1634885998,1634885998,1634885998,1634885998,1634885998,2054781305,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,2054781305,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,2054781305,2054781305,2054847098,1634885998,2054781305,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+2054781305,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,2053729896,2053729896,2053729896,2053729896,2053729896,
+2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+2053729896,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,2054781305,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,2054847098,1937338990,
+1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,
+1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,
+1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,
+1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,1937338990,2054847098,2054847098,1937338990,1937338990,1937338990,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,
+1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,
+1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,1952997729,
+1952997729,1952997729,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,
+1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,
+1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,
+1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,1852534639,2054847098,2054847098,2054847098,2054847098,2054847098,
+1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,
+1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,
+1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,2054847098,2054847098,
+1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,1935764850,2054847098,
+1835101796,1835101796,1835101796,1835101796,1835101796,1835101796,1835101796,1835101796,1835101796,1835101796,1835101796,1835101796,1835101796,1835101796,1835101796,1835101796,
+1835101796,1835101796,1835101796,1835101796,1835101796,1835101796,1835101796,1835101796,1835101796,1835101796,1835101796,1835101796,2054847098,2054847098,1835101796,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,
+1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,
+1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,
+1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,
+1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,
+1684371041,2053729896,2053729896,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,
+1684371041,1684371041,1684371041,1684371041,2054781305,2054781305,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,
+1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,
+1650814567,1650814567,1650814567,1650814567,2054847098,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,2054847098,2054847098,1650814567,
+1650814567,2054847098,2054847098,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,
+1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,2054847098,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,
+1650814567,2054847098,1650814567,2054847098,2054847098,2054847098,1650814567,1650814567,1650814567,1650814567,2054847098,2054847098,1650814567,1650814567,1650814567,1650814567,
+1650814567,1650814567,1650814567,1650814567,1650814567,2054847098,2054847098,1650814567,1650814567,2054847098,2054847098,1650814567,1650814567,1650814567,1650814567,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1650814567,2054847098,2054847098,2054847098,2054847098,1650814567,1650814567,2054847098,1650814567,
+1650814567,1650814567,1650814567,1650814567,2054847098,2054847098,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,
+1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,1650814567,2054847098,2054847098,2054847098,2054847098,
+2054847098,1735750261,1735750261,1735750261,2054847098,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,2054847098,2054847098,2054847098,2054847098,1735750261,
+1735750261,2054847098,2054847098,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,
+1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,2054847098,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,
+1735750261,2054847098,1735750261,1735750261,2054847098,1735750261,1735750261,2054847098,1735750261,1735750261,2054847098,2054847098,1735750261,2054847098,1735750261,1735750261,
+1735750261,1735750261,1735750261,2054847098,2054847098,2054847098,2054847098,1735750261,1735750261,2054847098,2054847098,1735750261,1735750261,1735750261,2054847098,2054847098,
+2054847098,1735750261,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1735750261,1735750261,1735750261,1735750261,2054847098,1735750261,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,
+1735750261,1735750261,1735750261,1735750261,1735750261,1735750261,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,1735748210,1735748210,1735748210,2054847098,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,2054847098,1735748210,
+1735748210,1735748210,2054847098,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,
+1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,2054847098,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,
+1735748210,2054847098,1735748210,1735748210,2054847098,1735748210,1735748210,1735748210,1735748210,1735748210,2054847098,2054847098,1735748210,1735748210,1735748210,1735748210,
+1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,2054847098,1735748210,1735748210,1735748210,2054847098,1735748210,1735748210,1735748210,2054847098,2054847098,
+1735748210,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1735748210,1735748210,1735748210,1735748210,2054847098,2054847098,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,1735748210,
+1735748210,1735748210,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1735748210,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,1869773153,1869773153,1869773153,2054847098,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,2054847098,2054847098,1869773153,
+1869773153,2054847098,2054847098,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,
+1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,2054847098,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,
+1869773153,2054847098,1869773153,1869773153,2054847098,1869773153,1869773153,1869773153,1869773153,1869773153,2054847098,2054847098,1869773153,1869773153,1869773153,1869773153,
+1869773153,1869773153,1869773153,1869773153,1869773153,2054847098,2054847098,1869773153,1869773153,2054847098,2054847098,1869773153,1869773153,1869773153,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1869773153,1869773153,2054847098,2054847098,2054847098,2054847098,1869773153,1869773153,2054847098,1869773153,
+1869773153,1869773153,1869773153,1869773153,2054847098,2054847098,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,
+1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,1869773153,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,1952542060,1952542060,2054847098,1952542060,1952542060,1952542060,1952542060,1952542060,1952542060,2054847098,2054847098,2054847098,1952542060,1952542060,
+1952542060,2054847098,1952542060,1952542060,1952542060,1952542060,2054847098,2054847098,2054847098,1952542060,1952542060,2054847098,1952542060,2054847098,1952542060,1952542060,
+2054847098,2054847098,2054847098,1952542060,1952542060,2054847098,2054847098,2054847098,1952542060,1952542060,1952542060,2054847098,2054847098,2054847098,1952542060,1952542060,
+1952542060,1952542060,1952542060,1952542060,1952542060,1952542060,1952542060,1952542060,1952542060,1952542060,2054847098,2054847098,2054847098,2054847098,1952542060,1952542060,
+1952542060,1952542060,1952542060,2054847098,2054847098,2054847098,1952542060,1952542060,1952542060,2054847098,1952542060,1952542060,1952542060,1952542060,2054847098,2054847098,
+1952542060,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1952542060,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1952542060,1952542060,1952542060,1952542060,1952542060,1952542060,1952542060,1952542060,1952542060,1952542060,
+1952542060,1952542060,1952542060,1952542060,1952542060,1952542060,1952542060,1952542060,1952542060,1952542060,1952542060,2054847098,2054847098,2054847098,2054847098,2054847098,
+1952803957,1952803957,1952803957,1952803957,2054847098,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,2054847098,1952803957,1952803957,
+1952803957,2054847098,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,
+1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,2054847098,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,
+1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,2054847098,2054847098,2054847098,1952803957,1952803957,1952803957,
+1952803957,1952803957,1952803957,1952803957,1952803957,2054847098,1952803957,1952803957,1952803957,2054847098,1952803957,1952803957,1952803957,1952803957,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,1952803957,1952803957,2054847098,1952803957,1952803957,1952803957,2054847098,2054847098,2054847098,2054847098,2054847098,
+1952803957,1952803957,1952803957,1952803957,2054847098,2054847098,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,1952803957,
+2054847098,1802396769,1802396769,1802396769,2054847098,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,2054847098,1802396769,1802396769,
+1802396769,2054847098,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,
+1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,2054847098,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,
+1802396769,1802396769,1802396769,1802396769,2054847098,1802396769,1802396769,1802396769,1802396769,1802396769,2054847098,2054847098,1802396769,1802396769,1802396769,1802396769,
+1802396769,1802396769,1802396769,1802396769,1802396769,2054847098,1802396769,1802396769,1802396769,2054847098,1802396769,1802396769,1802396769,1802396769,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,1802396769,1802396769,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1802396769,2054847098,
+1802396769,1802396769,1802396769,1802396769,2054847098,2054847098,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,1802396769,
+2054847098,1802396769,1802396769,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,1835825517,1835825517,1835825517,2054847098,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,2054847098,1835825517,1835825517,
+1835825517,2054847098,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,
+1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,
+1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,2054847098,2054847098,1835825517,1835825517,1835825517,
+1835825517,1835825517,1835825517,1835825517,1835825517,2054847098,1835825517,1835825517,1835825517,2054847098,1835825517,1835825517,1835825517,1835825517,1835825517,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1835825517,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1835825517,
+1835825517,1835825517,1835825517,1835825517,2054847098,2054847098,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,
+1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,2054847098,2054847098,2054847098,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,1835825517,
+2054847098,2054847098,1936289384,1936289384,2054847098,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,
+1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,2054847098,2054847098,2054847098,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,
+1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,
+1936289384,1936289384,2054847098,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,2054847098,1936289384,2054847098,2054847098,
+1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,2054847098,2054847098,2054847098,1936289384,2054847098,2054847098,2054847098,2054847098,1936289384,
+1936289384,1936289384,1936289384,1936289384,1936289384,2054847098,1936289384,2054847098,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,
+2054847098,2054847098,1936289384,1936289384,1936289384,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,
+1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,
+1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,
+1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,2054847098,2054847098,2054847098,2054847098,2054781305,
+1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,
+1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,1952997737,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,1818324847,1818324847,2054847098,1818324847,2054847098,2054847098,1818324847,1818324847,2054847098,1818324847,2054847098,2054847098,1818324847,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,1818324847,1818324847,1818324847,1818324847,2054847098,1818324847,1818324847,1818324847,1818324847,1818324847,1818324847,1818324847,
+2054847098,1818324847,1818324847,1818324847,2054847098,1818324847,2054847098,1818324847,2054847098,2054847098,1818324847,1818324847,2054847098,1818324847,1818324847,1818324847,
+1818324847,1818324847,1818324847,1818324847,1818324847,1818324847,1818324847,1818324847,1818324847,1818324847,2054847098,1818324847,1818324847,1818324847,2054847098,2054847098,
+1818324847,1818324847,1818324847,1818324847,1818324847,2054847098,1818324847,2054847098,1818324847,1818324847,1818324847,1818324847,1818324847,1818324847,2054847098,2054847098,
+1818324847,1818324847,1818324847,1818324847,1818324847,1818324847,1818324847,1818324847,1818324847,1818324847,2054847098,2054847098,1818324847,1818324847,1818324847,1818324847,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,
+1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,
+1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,
+1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,
+1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,2054847098,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,
+1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,
+1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,2054847098,2054847098,2054847098,
+2054847098,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,
+1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,
+1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,2054847098,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,
+1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,
+1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,2054847098,1953063540,1953063540,
+1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,1953063540,2054847098,1953063540,1953063540,
+1953063540,1953063540,1953063540,1953063540,1953063540,2054781305,2054781305,2054781305,2054781305,1953063540,1953063540,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,
+1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,
+1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,
+1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,
+1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,
+1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,
+1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,
+1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,
+1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,
+1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,
+1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,
+1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,
+1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,2054847098,1734700914,2054847098,2054847098,2054847098,2054847098,2054847098,1734700914,2054847098,2054847098,
+1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,
+1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,
+1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,2054781305,1734700914,1734700914,1734700914,1734700914,
+1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,
+1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,
+1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,
+1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,
+1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,
+1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,
+1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,
+1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,
+1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,
+1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,
+1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,
+1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,
+1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,1702127721,1702127721,1702127721,1702127721,2054847098,2054847098,
+1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,1702127721,2054847098,1702127721,1702127721,1702127721,1702127721,2054847098,2054847098,
+1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,
+1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,
+1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,1702127721,1702127721,1702127721,1702127721,2054847098,2054847098,
+1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,
+1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,
+1702127721,2054847098,1702127721,1702127721,1702127721,1702127721,2054847098,2054847098,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,
+1702127721,2054847098,1702127721,1702127721,1702127721,1702127721,2054847098,2054847098,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,
+1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,
+1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,
+1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,
+1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,
+1702127721,2054847098,1702127721,1702127721,1702127721,1702127721,2054847098,2054847098,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,
+1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,
+1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,
+1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,
+1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,2054847098,1702127721,1702127721,1702127721,
+1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,
+1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,2054847098,2054847098,
+1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,
+1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,
+1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,
+1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,
+1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,
+1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,
+1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,2054847098,2054847098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,2054847098,2054847098,
+1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,
+1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,
+1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,
+1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,
+1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,
+1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,
+1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,
+1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,
+1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,
+1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,1869046125,2054847098,2054847098,2054847098,
+1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,
+1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,
+1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,
+1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,
+1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,2054781305,2054781305,2054781305,1920298610,1920298610,
+1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,1920298610,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1952935015,1952935015,1952935015,1952935015,1952935015,1952935015,1952935015,1952935015,1952935015,1952935015,1952935015,1952935015,1952935015,2054847098,1952935015,1952935015,
+1952935015,1952935015,1952935015,1952935015,1952935015,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1751215727,1751215727,1751215727,1751215727,1751215727,1751215727,1751215727,1751215727,1751215727,1751215727,1751215727,1751215727,1751215727,1751215727,1751215727,1751215727,
+1751215727,1751215727,1751215727,1751215727,1751215727,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1651861604,1651861604,1651861604,1651861604,1651861604,1651861604,1651861604,1651861604,1651861604,1651861604,1651861604,1651861604,1651861604,1651861604,1651861604,1651861604,
+1651861604,1651861604,1651861604,1651861604,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1952540514,1952540514,1952540514,1952540514,1952540514,1952540514,1952540514,1952540514,1952540514,1952540514,1952540514,1952540514,1952540514,2054847098,1952540514,1952540514,
+1952540514,2054847098,1952540514,1952540514,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,
+1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,
+1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,
+1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,
+1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,
+1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,2054847098,2054847098,
+1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1836019303,1836019303,2054781305,2054781305,1836019303,2054781305,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,2054847098,
+1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,
+1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,
+1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,
+1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,
+1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,
+1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,
+1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,
+1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,1836019303,2054847098,2054847098,2054847098,2054847098,2054847098,
+1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,
+1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,
+1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,
+1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,
+1667329651,1667329651,1667329651,1667329651,1667329651,1667329651,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,
+1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,2054847098,
+1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,2054847098,2054847098,2054847098,2054847098,
+1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,2054847098,2054847098,2054847098,2054847098,
+1818848610,2054847098,2054847098,2054847098,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,1818848610,
+1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,
+1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,1952541797,2054847098,2054847098,
+1952541797,1952541797,1952541797,1952541797,1952541797,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,
+1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,
+1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,2054847098,2054847098,2054847098,2054847098,
+1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,
+1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,1952541813,2054847098,2054847098,2054847098,1952541813,1952541813,
+1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,
+1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,1802005874,
+1651861353,1651861353,1651861353,1651861353,1651861353,1651861353,1651861353,1651861353,1651861353,1651861353,1651861353,1651861353,1651861353,1651861353,1651861353,1651861353,
+1651861353,1651861353,1651861353,1651861353,1651861353,1651861353,1651861353,1651861353,1651861353,1651861353,1651861353,1651861353,2054847098,2054847098,1651861353,1651861353,
+1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,
+1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,
+1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,
+1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,2054847098,
+1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,
+1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,2054847098,2054847098,1818324577,
+1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,1818324577,2054847098,2054847098,
+2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,
+1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,
+1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,
+1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,
+1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,2054847098,2054847098,2054847098,2054847098,
+1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,
+1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,
+1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,1650551913,2054847098,2054847098,2054847098,
+1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,
+1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,
+1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,
+1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,
+1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,
+1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,
+1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,1650553963,
+1650553963,1650553963,1650553963,1650553963,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1650553963,1650553963,1650553963,1650553963,
+1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,
+1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,
+1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,
+1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,2054847098,2054847098,2054847098,1818587235,1818587235,1818587235,1818587235,1818587235,
+1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,1818587235,2054847098,2054847098,2054847098,1818587235,1818587235,1818587235,
+1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,
+1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,
+1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,1869374315,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,1937075812,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2053729896,2053729896,2053729896,2054781305,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,
+2053729896,2054781305,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2054781305,2054781305,2054781305,2054781305,2053729896,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2053729896,2054781305,2054781305,2054847098,2053729896,2053729896,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1735550315,1735550315,1735550315,1735550315,1735550315,1668903539,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1735550315,1735550315,1735550315,
+1735550315,1735550315,1818326126,1818326126,1818326126,1818326126,1735550315,1735550315,1735550315,1735550315,1735550315,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1668903539,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1735550315,
+2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,
+2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,
+2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,
+2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2053729896,2053729896,2053729896,2053729896,
+1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,
+1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,2054847098,2054847098,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,2054847098,2054847098,
+1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,
+1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,
+1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,2054847098,2054847098,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,2054847098,2054847098,
+1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,2054847098,1735550315,2054847098,1735550315,2054847098,1735550315,2054847098,1735550315,
+1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,
+1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,2054847098,2054847098,
+1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,
+1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,
+1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,
+1735550315,1735550315,1735550315,1735550315,1735550315,2054847098,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,
+1735550315,1735550315,1735550315,1735550315,1735550315,2054847098,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,
+1735550315,1735550315,1735550315,1735550315,2054847098,2054847098,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,2054847098,1735550315,1735550315,1735550315,
+1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,
+2054847098,2054847098,1735550315,1735550315,1735550315,2054847098,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2053729896,2053729896,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,1818326126,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,1818326126,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,
+2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,
+2053729896,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,1735550315,2054781305,2054781305,2054781305,1818326126,1818326126,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,1818326126,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,1818326126,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,
+1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,
+1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,
+1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,
+1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,
+1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,
+1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,
+1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,1651663209,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,
+1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,
+1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,2054847098,
+1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,
+1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,
+1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,1735156071,2054847098,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,
+1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,
+1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,
+1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,
+1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,
+1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,
+1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,
+1668247668,1668247668,1668247668,1668247668,2054847098,2054847098,2054847098,2054847098,2054847098,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,1668247668,
+1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,
+1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,
+1734700914,1734700914,1734700914,1734700914,1734700914,1734700914,2054847098,1734700914,2054847098,2054847098,2054847098,2054847098,2054847098,1734700914,2054847098,2054847098,
+1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,
+1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,
+1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,
+1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,1952869991,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1952869991,
+1952869991,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1952869991,
+1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,
+1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,
+1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,
+1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,
+1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,
+1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,
+1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,2054847098,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,1751215732,2054781305,1751215732,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,2053729896,2053729896,2053729896,2053729896,1751215719,1751215719,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,1751215732,1751215732,1751215732,1751215732,2054781305,2054781305,2054781305,2054781305,
+2054847098,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,
+1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,
+1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,
+1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,
+1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,
+1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,1751741025,2054847098,2054847098,2053729896,2053729896,2054781305,2054781305,1751741025,1751741025,1751741025,
+2054781305,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,
+1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,
+1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,
+1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,
+1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,
+1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,2054781305,2054781305,1801547361,1801547361,1801547361,
+2054847098,2054847098,2054847098,2054847098,2054847098,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,
+1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,
+1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,2054847098,2054847098,
+2054847098,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,
+1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,
+1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,
+1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,
+1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,
+1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,
+1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,1651470447,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,
+1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,
+1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,
+1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,
+1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,
+1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,2054847098,
+1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,
+1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,
+1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,
+1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,
+1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,
+1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,
+2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,
+2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,
+2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,
+2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,
+2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,
+2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,
+2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,
+2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2054847098,2054847098,2054847098,
+2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,
+2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,
+2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,
+2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2036951401,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,
+1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,
+1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,1818850165,
+1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,
+1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,
+1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,
+1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,
+1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,
+1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,
+1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,
+1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,
+1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,
+1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,
+1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,1986095465,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,
+1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,
+1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,
+1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,
+1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,
+1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,1668903539,
+1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,
+1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,
+1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,
+1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,
+1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,
+1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,2054781305,2054781305,2054781305,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,2054847098,2054847098,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,
+1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,
+1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,1937337455,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,
+1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,
+1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,
+1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,1885888871,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,
+1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,
+1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,
+1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,
+1935766898,1935766898,1935766898,1935766898,1935766898,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1935766898,1935766898,
+1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,1935766898,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,
+1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,1684371041,2054847098,2054847098,
+1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,
+1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,
+1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,1801546857,2054781305,1801546857,
+1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,
+1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,1919577703,
+1919577703,1919577703,1919577703,1919577703,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1919577703,
+1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,
+1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,2054847098,2054847098,2054847098,
+1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,
+1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,
+1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,
+1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,
+1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,2054847098,2054781305,
+1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,1784772193,2054847098,2054847098,2054847098,2054847098,1784772193,1784772193,
+1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,
+1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,2054847098,
+1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,
+1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,
+1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,
+1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,2054847098,2054847098,
+1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,1667785069,2054847098,2054847098,1667785069,1667785069,1667785069,1667785069,
+1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,
+1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,1836674418,
+1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,
+1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,
+1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,
+1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,1952544372,
+1952544372,1952544372,1952544372,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1952544372,1952544372,1952544372,1952544372,1952544372,
+1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,
+1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,2054847098,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,
+2054847098,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,1702127721,2054847098,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,2054781305,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1735550315,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,
+1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,
+1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,
+1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,
+1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,1667786098,
+1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,
+1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,
+1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,2054847098,2054847098,
+1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,1836344681,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,
+1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,
+1751215719,1751215719,1751215719,1751215719,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,
+1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,2054847098,2054847098,2054847098,2054847098,1751215719,1751215719,1751215719,1751215719,1751215719,
+1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,
+1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,
+1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,2054847098,2054847098,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,1634889070,1634889070,1634889070,1634889070,1634889070,2054847098,2054847098,2054847098,2054847098,2054847098,1751474802,1751474802,1751474802,
+1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,
+1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,2054847098,1751474802,1751474802,1751474802,1751474802,1751474802,2054847098,1751474802,2054847098,
+1751474802,1751474802,2054847098,1751474802,1751474802,2054847098,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,1751474802,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,2054781305,2054781305,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+2054847098,2054847098,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,2054847098,2054847098,
+2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,1668903539,1668903539,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,
+1634885998,1634885998,1634885998,1634885998,1634885998,2054847098,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,2054847098,2054847098,2054781305,
+2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,
+1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,1818326126,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,
+2054781305,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,
+1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,
+1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,1801547361,2054781305,2054781305,
+1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,
+1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,2054847098,
+2054847098,2054847098,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,2054847098,2054847098,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,
+2054847098,2054847098,1751215719,1751215719,1751215719,1751215719,1751215719,1751215719,2054847098,2054847098,1751215719,1751215719,1751215719,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,
+1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,2054847098,1818848866,1818848866,1818848866,
+1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,
+1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,2054847098,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,
+1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,2054847098,1818848866,1818848866,2054847098,1818848866,
+1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,2054847098,2054847098,
+1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,
+1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,
+1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,
+1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,
+1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,
+1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,
+1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,
+1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,1818848866,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,
+1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,
+1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,
+1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,
+1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,
+1735550315,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2053729896,2054847098,2054847098,
+1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,
+1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,1819894633,2054847098,2054847098,2054847098,
+1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,
+1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,
+1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,1667330665,
+1667330665,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2053729896,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,
+1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,
+1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,1769234796,
+1769234796,1769234796,1769234796,1769234796,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1735357544,1735357544,1735357544,1735357544,1735357544,1735357544,1735357544,1735357544,1735357544,1735357544,1735357544,1735357544,1735357544,1735357544,1735357544,1735357544,
+1735357544,1735357544,1735357544,1735357544,1735357544,1735357544,1735357544,1735357544,1735357544,1735357544,1735357544,2054847098,2054847098,2054847098,2054847098,2054847098,
+1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,
+1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,
+1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,1885696621,2054847098,2054847098,2054847098,2054847098,2054847098,
+1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,
+1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,1969709426,2054847098,1969709426,
+2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,
+2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,
+2020631919,2020631919,2020631919,2020631919,2054847098,2054847098,2054847098,2054847098,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,
+2020631919,2020631919,2020631919,2020631919,2020631919,2020631919,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,
+1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,
+1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,
+1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,
+1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,1685287540,
+1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,
+1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,
+1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,1936220535,
+1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,
+1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,2054847098,2054847098,
+1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,1869835617,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,
+1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,
+1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,1701601889,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,
+1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,
+1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,1634166882,
+1634166882,1634166882,1634166882,1634166882,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1634166882,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,
+1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,
+1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,
+1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,
+1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,
+1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,
+1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,
+1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,
+1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,
+1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,
+1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,
+1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,
+1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,1818848865,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,2054847098,2054847098,1668313716,2054847098,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,
+1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,
+1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,
+1668313716,1668313716,1668313716,1668313716,1668313716,1668313716,2054847098,1668313716,1668313716,2054847098,2054847098,2054847098,1668313716,2054847098,2054847098,1668313716,
+1634889065,1634889065,1634889065,1634889065,1634889065,1634889065,1634889065,1634889065,1634889065,1634889065,1634889065,1634889065,1634889065,1634889065,1634889065,1634889065,
+1634889065,1634889065,1634889065,1634889065,1634889065,1634889065,2054847098,1634889065,1634889065,1634889065,1634889065,1634889065,1634889065,1634889065,1634889065,1634889065,
+1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,
+1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,1885432941,
+1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,
+1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,1851941236,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1751217266,1751217266,1751217266,1751217266,1751217266,1751217266,1751217266,1751217266,1751217266,1751217266,1751217266,1751217266,1751217266,1751217266,1751217266,1751217266,
+1751217266,1751217266,1751217266,2054847098,1751217266,1751217266,2054847098,2054847098,2054847098,2054847098,2054847098,1751217266,1751217266,1751217266,1751217266,1751217266,
+1885892216,1885892216,1885892216,1885892216,1885892216,1885892216,1885892216,1885892216,1885892216,1885892216,1885892216,1885892216,1885892216,1885892216,1885892216,1885892216,
+1885892216,1885892216,1885892216,1885892216,1885892216,1885892216,1885892216,1885892216,1885892216,1885892216,1885892216,1885892216,2054847098,2054847098,2054847098,1885892216,
+1819894889,1819894889,1819894889,1819894889,1819894889,1819894889,1819894889,1819894889,1819894889,1819894889,1819894889,1819894889,1819894889,1819894889,1819894889,1819894889,
+1819894889,1819894889,1819894889,1819894889,1819894889,1819894889,1819894889,1819894889,1819894889,1819894889,2054847098,2054847098,2054847098,2054847098,2054847098,1819894889,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,
+1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,1835364975,
+1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,
+1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,2054847098,2054847098,2054847098,2054847098,1835364963,1835364963,1835364963,1835364963,
+1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,
+2054847098,2054847098,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,
+1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,
+1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,1835364963,
+1802002802,1802002802,1802002802,1802002802,2054847098,1802002802,1802002802,2054847098,2054847098,2054847098,2054847098,2054847098,1802002802,1802002802,1802002802,1802002802,
+1802002802,1802002802,1802002802,1802002802,2054847098,1802002802,1802002802,1802002802,2054847098,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,
+1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,
+1802002802,1802002802,1802002802,1802002802,2054847098,2054847098,2054847098,2054847098,1802002802,1802002802,1802002802,2054847098,2054847098,2054847098,2054847098,1802002802,
+1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,1802002802,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,
+1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,1935766114,
+1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,
+1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,1851880034,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,
+1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,
+1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,2054847098,2054847098,2054847098,2054847098,1835101801,1835101801,1835101801,1835101801,1835101801,
+1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,1835101801,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,
+1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,
+1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,
+1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,2054847098,2054847098,2054847098,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,1635152756,
+1886549097,1886549097,1886549097,1886549097,1886549097,1886549097,1886549097,1886549097,1886549097,1886549097,1886549097,1886549097,1886549097,1886549097,1886549097,1886549097,
+1886549097,1886549097,1886549097,1886549097,1886549097,1886549097,2054847098,2054847098,1886549097,1886549097,1886549097,1886549097,1886549097,1886549097,1886549097,1886549097,
+1885891689,1885891689,1885891689,1885891689,1885891689,1885891689,1885891689,1885891689,1885891689,1885891689,1885891689,1885891689,1885891689,1885891689,1885891689,1885891689,
+1885891689,1885891689,1885891689,2054847098,2054847098,2054847098,2054847098,2054847098,1885891689,1885891689,1885891689,1885891689,1885891689,1885891689,1885891689,1885891689,
+1885891696,1885891696,1885891696,1885891696,1885891696,1885891696,1885891696,1885891696,1885891696,1885891696,1885891696,1885891696,1885891696,1885891696,1885891696,1885891696,
+1885891696,1885891696,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1885891696,1885891696,1885891696,1885891696,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1885891696,1885891696,1885891696,1885891696,1885891696,1885891696,1885891696,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,
+1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,
+1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,
+1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,
+1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,1869769576,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,
+1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,
+1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,
+1752526439,1752526439,1752526439,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,
+1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,
+1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,
+1752526439,1752526439,1752526439,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1752526439,1752526439,1752526439,1752526439,1752526439,1752526439,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,2054847098,
+1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,
+1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,
+1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,
+1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,
+1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,2054847098,2054847098,
+2054847098,2054847098,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,
+1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,1651663208,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1651663208,
+1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,
+1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,
+1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,
+1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,1802791017,
+1802791017,1802791017,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,
+1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,1936683617,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,
+1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,
+1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,
+1667328877,1667328877,1667328877,1667328877,1667328877,2054847098,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,1667328877,
+1667328877,1667328877,1667328877,1667328877,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,
+1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,
+1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,1835100266,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,
+1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,
+1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,
+1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,
+1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,2054847098,2054847098,
+1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,1936224868,
+2054847098,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,1936289384,
+1936289384,1936289384,1936289384,1936289384,1936289384,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,
+1802006378,1802006378,2054847098,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,
+1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,
+1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,1802006378,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1836412020,1836412020,1836412020,1836412020,1836412020,1836412020,1836412020,2054847098,1836412020,2054847098,1836412020,1836412020,1836412020,1836412020,2054847098,1836412020,
+1836412020,1836412020,1836412020,1836412020,1836412020,1836412020,1836412020,1836412020,1836412020,1836412020,1836412020,1836412020,1836412020,1836412020,2054847098,1836412020,
+1836412020,1836412020,1836412020,1836412020,1836412020,1836412020,1836412020,1836412020,1836412020,1836412020,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,
+1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,
+1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,
+1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,2054847098,2054847098,2054847098,2054847098,2054847098,
+1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,1936289380,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1735549294,1735549294,1735549294,1735549294,2054847098,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,2054847098,2054847098,1735549294,
+1735549294,2054847098,2054847098,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,
+1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,2054847098,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,
+1735549294,2054847098,1735549294,1735549294,2054847098,1735549294,1735549294,1735549294,1735549294,1735549294,2054847098,2054847098,1735549294,1735549294,1735549294,1735549294,
+1735549294,1735549294,1735549294,1735549294,1735549294,2054847098,2054847098,1735549294,1735549294,2054847098,2054847098,1735549294,1735549294,1735549294,2054847098,2054847098,
+1735549294,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1735549294,2054847098,2054847098,2054847098,2054847098,2054847098,1735549294,1735549294,1735549294,
+1735549294,1735549294,1735549294,1735549294,2054847098,2054847098,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,1735549294,2054847098,2054847098,2054847098,
+1735549294,1735549294,1735549294,1735549294,1735549294,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,
+1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,
+1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,
+1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,
+1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,1953067624,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,
+1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,
+1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,
+1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,2054847098,2054847098,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,
+1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,
+1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,1936286820,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,
+1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,
+1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,
+1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,
+1836016745,1836016745,1836016745,1836016745,1836016745,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,1836016745,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,
+1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,
+1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,
+1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,1952541554,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,
+1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,2054847098,2054847098,2054847098,1634234221,1634234221,1634234221,
+1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,2054847098,2054847098,2054847098,2054847098,
+1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,1634234221,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,
+2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,
+2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,
+2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,
+2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,2002874977,
+2002874977,2002874977,2002874977,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2002874977,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,
+1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,
+1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,
+1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,1885435235,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,
+2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,
+2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,
+2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,
+2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,
+2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,
+2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,
+2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,
+2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,
+2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,
+2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,
+2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,
+2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,
+2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,
+2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,
+2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2054847098,
+2020832632,2020832632,2020832632,2020832632,2020832632,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,
+2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,
+2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,
+2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,2020832632,
+2020832632,2020832632,2020832632,2020832632,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,
+1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,
+1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,
+1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,
+1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,
+1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,
+1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,
+1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,
+1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,
+1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,
+1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,1701280112,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,
+1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,
+1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,
+1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,
+1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,
+1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,
+1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,
+1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,
+1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,
+1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,
+1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,
+1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,
+1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,1751938423,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,
+1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,
+1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,
+1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,
+1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,
+1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,
+1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,
+1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,
+1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,
+1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,
+1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,
+1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,1650552181,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,
+1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,2054847098,
+1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,1836216175,2054847098,2054847098,2054847098,2054847098,1836216175,1836216175,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,
+1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,2054847098,2054847098,
+1650553715,1650553715,1650553715,1650553715,1650553715,1650553715,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,
+1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,
+1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,
+1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,
+1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,2054847098,1752002151,1752002151,1752002151,1752002151,1752002151,
+1752002151,1752002151,2054847098,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,
+1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,2054847098,2054847098,2054847098,2054847098,2054847098,1752002151,1752002151,1752002151,
+1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,1752002151,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,
+1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,
+1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,
+1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,
+1886155364,1886155364,1886155364,1886155364,1886155364,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,
+1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,
+1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1886155364,
+1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,1886155364,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1801547361,1751741025,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,
+1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,
+1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,
+1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,
+1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,
+1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,
+1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,2054847098,2054847098,2054847098,2054847098,2054847098,
+1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,2054847098,2054847098,2054847098,
+1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,1685418092,2054847098,2054847098,1685418092,1685418092,1685418092,1685418092,
+2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2053729896,2053729896,2053729896,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2053729896,2053729896,2053729896,2053729896,2053729896,
+2053729896,2053729896,2053729896,2054781305,2054781305,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2053729896,2053729896,2053729896,2053729896,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,
+1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,
+1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,
+1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,
+1735550315,1735550315,1735550315,1735550315,1735550315,1735550315,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054781305,2054781305,
+2054847098,2054847098,2054781305,2054847098,2054847098,2054781305,2054781305,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054847098,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054781305,2054847098,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054781305,2054781305,2054781305,2054781305,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054781305,2054847098,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,
+1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,
+1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,
+1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,
+1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,
+1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,
+1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,
+1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,
+1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,1936158327,1936158327,1936158327,1936158327,1936158327,
+2054847098,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,1936158327,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,
+1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,
+1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,
+1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,
+1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,
+1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,
+1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,
+1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,
+1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,
+1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,
+1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,
+1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,
+1835363940,1835363940,1835363940,1835363940,1835363940,2054847098,2054847098,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,
+1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,1835363940,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1634885998,1634885998,1634885998,1634885998,2054847098,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+2054847098,1634885998,1634885998,2054847098,1634885998,2054847098,2054847098,1634885998,2054847098,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,2054847098,1634885998,1634885998,1634885998,1634885998,2054847098,1634885998,2054847098,1634885998,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,1634885998,2054847098,2054847098,2054847098,2054847098,1634885998,2054847098,1634885998,2054847098,1634885998,2054847098,1634885998,1634885998,1634885998,
+2054847098,1634885998,1634885998,2054847098,1634885998,2054847098,2054847098,1634885998,2054847098,1634885998,2054847098,1634885998,2054847098,1634885998,2054847098,1634885998,
+2054847098,1634885998,1634885998,2054847098,1634885998,2054847098,2054847098,1634885998,1634885998,1634885998,1634885998,2054847098,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,2054847098,1634885998,1634885998,1634885998,1634885998,2054847098,1634885998,1634885998,1634885998,1634885998,2054847098,1634885998,2054847098,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,2054847098,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,2054847098,2054847098,2054847098,2054847098,
+2054847098,1634885998,1634885998,1634885998,2054847098,1634885998,1634885998,1634885998,1634885998,1634885998,2054847098,1634885998,1634885998,1634885998,1634885998,1634885998,
+1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,1634885998,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1634885998,1634885998,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,
+2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+1751741025,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054847098,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,2054847098,2054847098,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,
+1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,1751215732,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054781305,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,2054781305,
+2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,
+2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,
+2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,
+2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,
+2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,
+2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,
+2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,
+2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,
+2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,
+2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,
+2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,
+2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,
+2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,
+2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,
+2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,2053729896,
+2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,2054847098,
+}};
+
+const TrieTable<uint32_t, uint32_t> scripts_trie {{&scripts_index[0], &scripts_index[0] + scripts_index.size()}, &scripts_leaves[0], 2054847098};
 
 const std::array<KeyValue<char32_t, char const*>, 156> script_extensions_array = {{
 {0x0,static_cast<char const*>(0)},
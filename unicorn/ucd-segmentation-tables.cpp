@@ -0,0 +1,103 @@
+#include "unicorn/ucd-tables.hpp"
+
+namespace RS::Unicorn::UnicornDetail {
+
+const std::array<std::array<uint8_t, 15>, 10> grapheme_break_dfa_array = {{
+{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}},
+{{130,131,132,0,130,133,131,134,135,136,137,0,130,135,134}},
+{{0,0,0,0,130,0,0,0,0,0,0,0,130,0,0}},
+{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}},
+{{0,0,0,0,0,0,131,0,0,0,0,0,0,0,0}},
+{{0,0,0,0,130,133,0,134,135,0,0,0,130,0,134}},
+{{0,0,0,0,130,0,0,0,0,0,0,0,130,135,134}},
+{{0,0,0,0,130,0,0,0,0,0,0,0,130,135,0}},
+{{130,0,0,0,130,133,0,134,135,136,137,0,130,135,134}},
+{{0,0,0,0,130,0,0,0,0,0,137,0,130,0,0}},
+}};
+
+const Irange<std::array<uint8_t, 15> const*> grapheme_break_dfa_table {&grapheme_break_dfa_array[0], &grapheme_break_dfa_array[0] + grapheme_break_dfa_array.size()};
+
+const std::array<std::array<uint8_t, 19>, 15> word_break_dfa_array = {{
+{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}},
+{{130,131,132,130,0,130,133,130,134,135,136,130,130,130,136,137,138,130,0}},
+{{0,0,0,0,0,130,0,130,0,0,0,0,0,0,0,0,0,0,0}},
+{{0,131,0,0,0,131,133,131,134,0,0,11,0,11,0,137,0,11,0}},
+{{0,0,0,0,0,0,0,0,0,0,136,0,0,0,0,0,0,0,0}},
+{{0,131,0,0,0,133,133,133,134,135,0,0,0,0,0,137,0,0,0}},
+{{0,131,0,12,0,134,133,134,134,0,0,11,0,11,0,137,0,141,0}},
+{{0,0,0,0,0,135,133,135,0,135,0,0,0,0,0,0,0,0,0}},
+{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}},
+{{0,131,0,0,0,137,133,137,134,0,0,0,14,14,0,137,0,14,0}},
+{{0,0,0,0,0,138,0,138,0,0,0,0,0,0,0,0,138,0,0}},
+{{0,131,0,0,0,11,0,11,134,0,0,0,0,0,0,0,0,0,0}},
+{{0,0,0,0,0,12,0,12,134,0,0,0,0,0,0,0,0,0,0}},
+{{0,131,0,0,0,141,0,141,134,0,0,0,0,0,0,0,0,0,0}},
+{{0,0,0,0,0,14,0,14,0,0,0,0,0,0,0,137,0,0,0}},
+}};
+
+const Irange<std::array<uint8_t, 19> const*> word_break_dfa_table {&word_break_dfa_array[0], &word_break_dfa_array[0] + word_break_dfa_array.size()};
+
+const std::array<std::array<uint8_t, 17>, 13> sentence_break_dfa_array = {{
+{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}},
+{{130,131,130,132,0,130,130,133,134,130,130,130,133,0,130,135,134}},
+{{130,131,130,132,0,130,130,133,134,130,130,130,133,0,130,135,134}},
+{{8,131,137,132,0,131,131,133,134,130,0,130,133,0,138,135,0}},
+{{0,0,0,0,0,0,0,133,0,0,0,0,0,0,0,0,0}},
+{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}},
+{{130,139,130,132,0,134,134,133,134,130,130,130,133,0,130,135,134}},
+{{0,131,135,132,0,135,135,133,0,0,0,130,133,0,140,135,0}},
+{{8,0,8,0,0,8,8,0,134,8,0,8,0,0,8,0,0}},
+{{8,131,137,132,0,137,137,133,134,8,0,130,133,0,138,135,0}},
+{{8,131,8,132,0,138,138,133,134,8,0,130,133,0,138,135,0}},
+{{8,131,137,132,0,139,139,133,134,130,0,130,133,0,138,135,134}},
+{{0,131,0,132,0,140,140,133,0,0,0,130,133,0,140,135,0}},
+}};
+
+const Irange<std::array<uint8_t, 17> const*> sentence_break_dfa_table {&sentence_break_dfa_array[0], &sentence_break_dfa_array[0] + sentence_break_dfa_array.size()};
+
+const std::array<std::array<uint8_t, 40>, 40> line_break_pair_array = {{
+{{3,3,3,3,2,3,7,3,3,0,7,0,7,0,2,3,3,3,2,3,3,0,3,3,3,7,7,2,3,3,3,3,2,3,3,3,4,0,0,0}},
+{{3,3,3,3,2,3,7,3,3,0,7,0,7,0,2,3,3,3,2,3,3,0,3,3,3,7,7,2,3,3,3,3,2,3,3,3,4,0,0,0}},
+{{3,3,2,3,2,3,7,3,3,0,7,0,7,0,2,3,3,2,2,3,2,0,3,3,3,7,7,2,2,2,3,3,2,3,3,3,4,0,0,0}},
+{{3,3,3,0,2,3,7,3,3,0,7,0,7,0,2,3,3,3,2,3,3,0,3,3,3,7,7,2,3,3,3,3,2,3,3,3,4,0,0,0}},
+{{3,3,3,3,2,3,7,3,3,0,7,0,7,0,3,3,3,3,2,3,3,0,3,3,3,7,7,2,3,3,3,3,2,3,3,3,4,0,0,0}},
+{{2,2,2,2,2,2,6,3,2,0,6,0,6,0,2,2,2,2,2,2,2,0,2,2,2,6,6,2,2,2,2,2,2,2,2,2,4,0,0,0}},
+{{7,7,7,7,6,7,7,7,7,4,7,4,7,4,6,7,7,7,6,7,7,4,7,7,7,7,7,6,7,7,7,7,6,7,7,7,4,4,4,4}},
+{{3,3,3,3,3,3,7,3,3,0,7,0,7,0,2,3,3,3,3,3,3,0,3,3,3,7,7,3,3,3,3,3,2,3,3,3,4,0,0,0}},
+{{3,3,3,3,2,3,7,3,3,0,7,0,7,0,2,3,3,3,2,3,3,0,3,3,3,7,7,2,3,3,3,3,2,3,3,3,4,0,0,0}},
+{{3,3,3,3,2,3,7,3,3,0,7,0,7,0,2,3,3,3,2,3,3,0,3,3,3,7,7,0,3,3,2,2,2,3,3,3,4,0,0,0}},
+{{3,3,3,3,2,3,7,3,3,0,7,0,7,0,2,3,3,3,2,3,3,0,3,3,3,7,7,2,3,3,3,3,2,3,3,3,4,0,0,0}},
+{{3,3,2,3,2,3,7,3,3,0,7,0,7,0,2,3,3,2,2,3,3,0,3,3,3,7,7,0,2,3,2,2,2,3,3,3,4,0,0,0}},
+{{7,7,7,7,6,7,7,7,7,4,7,4,7,4,6,7,7,7,6,7,7,4,7,7,7,7,7,6,7,7,7,7,6,7,7,7,4,4,4,4}},
+{{3,3,3,3,2,3,7,3,3,0,7,0,7,0,2,3,3,3,2,3,2,0,3,3,3,7,7,2,3,3,3,3,2,3,3,3,4,0,0,0}},
+{{2,2,2,2,2,2,6,2,2,0,6,0,6,0,2,2,2,2,2,2,2,0,2,2,2,6,6,2,2,2,2,2,2,2,2,2,4,0,0,0}},
+{{3,3,3,3,2,3,7,3,3,0,7,0,7,0,2,3,3,3,2,3,2,0,3,2,2,7,7,2,3,3,2,3,2,3,3,3,4,0,0,0}},
+{{3,3,3,3,2,3,7,3,3,0,7,0,7,0,2,3,3,3,2,3,2,0,3,2,3,7,7,2,3,3,2,3,2,3,3,3,4,0,0,0}},
+{{3,3,2,3,6,3,7,3,3,0,7,0,7,0,2,3,3,2,6,3,2,0,3,3,3,7,7,2,2,2,3,3,2,3,3,3,4,0,0,0}},
+{{3,3,3,3,2,3,7,3,3,0,7,0,7,0,3,3,3,3,2,3,3,0,3,3,3,7,7,2,2,3,3,3,2,3,3,3,4,0,0,0}},
+{{3,3,3,3,2,3,7,3,3,0,7,0,7,0,2,3,3,3,2,3,2,0,3,3,3,7,7,2,3,3,2,3,2,3,3,3,4,0,0,0}},
+{{3,3,3,3,2,3,7,3,3,0,7,0,7,0,2,3,3,3,2,3,2,0,3,3,3,7,7,2,3,3,3,3,2,3,3,3,4,0,0,0}},
+{{3,3,2,3,2,3,7,3,3,0,7,0,7,0,2,3,3,2,2,3,3,0,3,3,3,7,7,2,2,3,3,3,2,3,3,3,4,0,0,0}},
+{{3,3,3,3,2,3,7,3,3,0,7,0,7,0,2,2,2,3,2,3,2,0,2,3,2,7,7,2,3,3,2,3,2,3,3,3,4,0,0,0}},
+{{3,3,3,3,2,3,7,3,3,0,7,0,7,0,2,3,3,3,2,3,2,0,3,2,3,7,7,2,3,3,2,3,2,3,3,3,4,0,0,0}},
+{{3,3,3,3,2,3,7,3,3,0,7,0,7,0,2,3,3,3,2,3,2,0,3,2,2,7,7,2,3,3,2,3,2,3,3,3,4,0,0,0}},
+{{7,7,7,7,6,7,7,7,7,4,7,4,7,4,6,7,7,7,6,7,7,4,7,7,7,7,7,6,7,7,7,7,6,7,7,7,4,4,4,4}},
+{{7,7,7,7,6,7,7,7,7,4,7,4,7,4,6,7,7,7,6,7,7,4,7,7,7,7,7,6,7,7,7,7,6,7,7,7,4,4,4,4}},
+{{3,3,3,3,2,3,7,3,3,0,7,0,7,0,2,3,3,3,2,3,3,0,3,3,3,7,7,2,3,3,3,3,2,3,3,3,4,0,0,0}},
+{{3,3,2,3,2,3,7,3,3,0,7,0,7,0,2,3,3,2,2,3,2,0,3,3,3,7,7,2,2,2,2,2,2,3,3,3,4,0,0,0}},
+{{0,0,0,0,0,0,4,0,0,0,4,0,4,0,0,0,0,0,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0}},
+{{3,3,2,3,2,3,7,3,3,0,7,0,7,0,2,3,3,2,2,3,3,0,3,3,3,7,7,2,2,2,3,3,2,3,3,3,4,0,0,0}},
+{{3,3,2,3,2,3,7,3,3,0,7,0,7,0,2,2,2,2,2,2,3,0,2,2,2,7,7,2,2,2,3,3,2,3,3,3,4,0,0,0}},
+{{2,2,2,2,2,2,6,2,2,0,6,0,6,0,2,2,2,2,2,2,2,0,2,2,2,6,6,2,2,0,2,2,2,2,2,2,4,0,0,0}},
+{{3,3,3,3,2,3,7,3,3,0,7,0,7,0,2,3,3,3,2,3,3,0,3,3,3,7,7,2,3,3,3,3,2,2,3,3,4,0,0,0}},
+{{3,3,3,3,2,3,7,3,3,0,7,0,7,0,2,3,3,3,2,3,3,0,3,3,3,7,7,2,3,3,3,3,2,3,3,3,4,0,0,0}},
+{{3,3,3,3,2,3,7,3,3,0,7,0,7,0,2,3,3,3,2,3,3,0,3,3,3,7,7,2,3,3,3,3,2,3,3,3,4,0,0,0}},
+{{3,3,3,3,2,3,7,3,3,0,7,0,7,0,2,3,3,3,2,3,3,0,3,3,3,7,7,2,3,3,3,3,2,3,3,3,4,0,0,0}},
+{{3,3,3,3,2,3,7,3,3,0,7,0,7,0,2,3,3,2,2,3,3,0,3,3,3,7,7,2,2,3,3,3,2,3,3,3,4,0,0,0}},
+{{2,2,2,2,2,2,6,2,2,0,6,0,6,0,2,2,2,2,2,2,2,0,2,2,2,6,6,2,2,2,2,2,2,2,2,2,4,0,0,0}},
+{{3,3,3,3,3,3,7,3,3,3,7,3,7,3,3,3,3,3,3,3,3,3,3,3,3,7,7,3,3,3,3,3,3,3,3,3,4,3,3,0}},
+}};
+
+const Irange<std::array<uint8_t, 40> const*> line_break_pair_table {&line_break_pair_array[0], &line_break_pair_array[0] + line_break_pair_array.size()};
+
+}
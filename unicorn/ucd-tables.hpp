@@ -37,6 +37,17 @@ namespace RS::Unicorn::UnicornDetail {
         T second;
     };
 
+    template <typename V, typename L>
+    struct TrieTable {
+        using value_type = V;
+        using leaf_type = L;
+        static constexpr int shift = 7; // Must match trie_shift in make-tables
+        static constexpr char32_t mask = (char32_t(1) << shift) - 1;
+        Irange<const uint16_t*> index;
+        const L* leaves;
+        L def;
+    };
+
     // Lookup functions
 
     template <typename T, typename K, typename V>
@@ -70,6 +81,15 @@ namespace RS::Unicorn::UnicornDetail {
         }
     }
 
+    template <typename V, typename L>
+    V trie_lookup(const TrieTable<V, L>& table, char32_t key) noexcept {
+        size_t block = key >> TrieTable<V, L>::shift;
+        if (block >= table.index.size())
+            return static_cast<V>(table.def);
+        size_t pos = (size_t(table.index.first[block]) << TrieTable<V, L>::shift) + (key & TrieTable<V, L>::mask);
+        return static_cast<V>(table.leaves[pos]);
+    }
+
     template <typename K>
     bool sparse_set_lookup(Irange<const KeyValue<K, K>*> table, K key) noexcept {
         if (table.begin() == table.end())
@@ -97,26 +117,26 @@ namespace RS::Unicorn::UnicornDetail {
 
     // General character property tables
 
-    extern const TableView<char32_t, uint16_t> general_category_table;
-    extern const TableView<char32_t, char32_t> default_ignorable_table;
-    extern const TableView<char32_t, char32_t> soft_dotted_table;
-    extern const TableView<char32_t, char32_t> white_space_table;
-    extern const TableView<char32_t, char32_t> id_start_table;
-    extern const TableView<char32_t, char32_t> id_nonstart_table;
-    extern const TableView<char32_t, char32_t> xid_start_table;
-    extern const TableView<char32_t, char32_t> xid_nonstart_table;
-    extern const TableView<char32_t, char32_t> pattern_syntax_table;
-    extern const TableView<char32_t, char32_t> pattern_white_space_table;
+    extern const TrieTable<uint16_t, uint16_t> general_category_trie;
+    extern const TrieTable<bool, uint8_t> default_ignorable_trie;
+    extern const TrieTable<bool, uint8_t> soft_dotted_trie;
+    extern const TrieTable<bool, uint8_t> white_space_trie;
+    extern const TrieTable<bool, uint8_t> id_start_trie;
+    extern const TrieTable<bool, uint8_t> id_nonstart_trie;
+    extern const TrieTable<bool, uint8_t> xid_start_trie;
+    extern const TrieTable<bool, uint8_t> xid_nonstart_trie;
+    extern const TrieTable<bool, uint8_t> pattern_syntax_trie;
+    extern const TrieTable<bool, uint8_t> pattern_white_space_trie;
 
     // Arabic shaping property tables
 
-    extern const TableView<char32_t, Joining_Type> joining_type_table;
-    extern const TableView<char32_t, Joining_Group> joining_group_table;
+    extern const TrieTable<Joining_Type, uint8_t> joining_type_trie;
+    extern const TrieTable<Joining_Group, uint8_t> joining_group_trie;
 
     // Bidirectional property tables
 
-    extern const TableView<char32_t, Bidi_Class> bidi_class_table;
-    extern const Irange<char32_t const*> bidi_mirrored_table;
+    extern const TrieTable<Bidi_Class, uint8_t> bidi_class_trie;
+    extern const TrieTable<bool, uint8_t> bidi_mirrored_trie;
     extern const TableView<char32_t, char32_t> bidi_mirroring_glyph_table;
     extern const TableView<char32_t, char32_t> bidi_paired_bracket_table;
     extern const TableView<char32_t, char32_t> bidi_paired_bracket_type_table;
@@ -127,12 +147,12 @@ namespace RS::Unicorn::UnicornDetail {
 
     // Case folding tables
 
-    extern const TableView<char32_t, char32_t> other_uppercase_table;
-    extern const TableView<char32_t, char32_t> other_lowercase_table;
-    extern const TableView<char32_t, char32_t> simple_uppercase_table;
-    extern const TableView<char32_t, char32_t> simple_lowercase_table;
-    extern const TableView<char32_t, char32_t> simple_titlecase_table;
-    extern const TableView<char32_t, char32_t> simple_casefold_table;
+    extern const TrieTable<bool, uint8_t> other_uppercase_trie;
+    extern const TrieTable<bool, uint8_t> other_lowercase_trie;
+    extern const TrieTable<int32_t, int32_t> simple_uppercase_trie;
+    extern const TrieTable<int32_t, int32_t> simple_lowercase_trie;
+    extern const TrieTable<int32_t, int32_t> simple_titlecase_trie;
+    extern const TrieTable<int32_t, int32_t> simple_casefold_trie;
     extern const TableView<char32_t, std::array<char32_t, 3>> full_uppercase_table;
     extern const TableView<char32_t, std::array<char32_t, 3>> full_lowercase_table;
     extern const TableView<char32_t, std::array<char32_t, 3>> full_titlecase_table;
@@ -147,38 +167,55 @@ namespace RS::Unicorn::UnicornDetail {
 
     // Decomposition tables
 
-    extern const TableView<char32_t, int> combining_class_table;
+    extern const TrieTable<int, uint8_t> combining_class_trie;
     extern const TableView<char32_t, std::array<char32_t, 2>> canonical_table;
     extern const TableView<char32_t, std::array<char32_t, 3>> short_compatibility_table;
     extern const TableView<char32_t, std::array<char32_t, 18>> long_compatibility_table;
-    extern const TableView<std::array<char32_t, 2>, char32_t> composition_table;
+    extern const TrieTable<uint16_t, uint16_t> composition_start_trie;
+    extern const Irange<std::array<char32_t, 2> const*> composition_list_table;
+    extern const TrieTable<bool, uint8_t> composition_second_trie;
+    extern const TrieTable<Quick_Check, uint8_t> nfc_quick_check_trie;
+    extern const TrieTable<Quick_Check, uint8_t> nfd_quick_check_trie;
+    extern const TrieTable<Quick_Check, uint8_t> nfkc_quick_check_trie;
+    extern const TrieTable<Quick_Check, uint8_t> nfkd_quick_check_trie;
 
     // Indic property tables
 
-    extern const TableView<char32_t, Indic_Positional_Category> indic_positional_category_table;
-    extern const TableView<char32_t, Indic_Syllabic_Category> indic_syllabic_category_table;
+    extern const TrieTable<Indic_Positional_Category, uint8_t> indic_positional_category_trie;
+    extern const TrieTable<Indic_Syllabic_Category, uint8_t> indic_syllabic_category_trie;
 
     // Numeric property tables
 
-    extern const TableView<char32_t, Numeric_Type> numeric_type_table;
+    extern const TrieTable<Numeric_Type, uint8_t> numeric_type_trie;
     extern const TableView<char32_t, PackedPair<long long>> numeric_value_table;
 
+    // Packed property tables
+
+    extern const TrieTable<uint64_t, uint64_t> char_props_trie;
+
     // Script tables
 
-    extern const TableView<char32_t, uint32_t> scripts_table;
+    extern const TrieTable<uint32_t, uint32_t> scripts_trie;
     extern const TableView<char32_t, char const*> script_extensions_table;
 
     // Text segmentation property tables
 
-    extern const TableView<char32_t, Grapheme_Cluster_Break> grapheme_cluster_break_table;
-    extern const TableView<char32_t, Line_Break> line_break_table;
-    extern const TableView<char32_t, Sentence_Break> sentence_break_table;
-    extern const TableView<char32_t, Word_Break> word_break_table;
+    extern const TrieTable<Grapheme_Cluster_Break, uint8_t> grapheme_cluster_break_trie;
+    extern const TrieTable<Line_Break, uint8_t> line_break_trie;
+    extern const TrieTable<Sentence_Break, uint8_t> sentence_break_trie;
+    extern const TrieTable<Word_Break, uint8_t> word_break_trie;
+
+    // Text segmentation state machines
+
+    extern const Irange<std::array<uint8_t, 15> const*> grapheme_break_dfa_table;
+    extern const Irange<std::array<uint8_t, 19> const*> word_break_dfa_table;
+    extern const Irange<std::array<uint8_t, 17> const*> sentence_break_dfa_table;
+    extern const Irange<std::array<uint8_t, 40> const*> line_break_pair_table;
 
     // Other enumerated property tables
 
-    extern const TableView<char32_t, East_Asian_Width> east_asian_width_table;
-    extern const TableView<char32_t, Hangul_Syllable_Type> hangul_syllable_type_table;
+    extern const TrieTable<East_Asian_Width, uint8_t> east_asian_width_trie;
+    extern const TrieTable<Hangul_Syllable_Type, uint8_t> hangul_syllable_type_trie;
 
     // Normalization test tables
 
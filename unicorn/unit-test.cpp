@@ -27,6 +27,7 @@ extern void test_unicorn_character_case_folding_properties();
 extern void test_unicorn_character_names();
 extern void test_unicorn_character_decomposition_properties();
 extern void test_unicorn_character_enumeration_properties();
+extern void test_unicorn_character_packed_properties();
 extern void test_unicorn_character_numeric_properties();
 extern void test_unicorn_character_script_properties();
 extern void test_unicorn_character_test_all_the_things();
@@ -46,14 +47,25 @@ extern void test_unicorn_format_case_mapping();
 extern void test_unicorn_format_class();
 extern void test_unicorn_format_literals();
 extern void test_unicorn_io_file_reader();
+extern void test_unicorn_io_file_reader_blocks();
+extern void test_unicorn_io_mapped_file_reader();
+extern void test_unicorn_io_parallel_lines();
 extern void test_unicorn_io_file_writer();
+extern void test_unicorn_io_async_file_writer();
 extern void test_unicorn_mbcs_locale_detection();
 extern void test_unicorn_mbcs_utf_detection();
+extern void test_unicorn_mbcs_encoding_detection();
 extern void test_unicorn_mbcs_encoding_queries();
 extern void test_unicorn_mbcs_to_unicode();
 extern void test_unicorn_mbcs_from_unicode();
+extern void test_unicorn_mbcs_builtin_charsets();
+extern void test_unicorn_mbcs_converters();
+extern void test_unicorn_mbcs_streaming();
 extern void test_unicorn_mbcs_local_encoding_round_trip();
 extern void test_unicorn_normal_normalization();
+extern void test_unicorn_normal_quick_check();
+extern void test_unicorn_normal_combining_runs();
+extern void test_unicorn_normal_streaming();
 extern void test_unicorn_options_basic();
 extern void test_unicorn_options_boolean();
 extern void test_unicorn_options_multiple();
@@ -94,8 +106,11 @@ extern void test_unicorn_regex_transform();
 extern void test_unicorn_regex_escape();
 extern void test_unicorn_segment_graphemes();
 extern void test_unicorn_segment_words();
+extern void test_unicorn_segment_parallel_words();
+extern void test_unicorn_segment_boundaries();
 extern void test_unicorn_segment_lines();
 extern void test_unicorn_segment_sentences();
+extern void test_unicorn_segment_line_breaks();
 extern void test_unicorn_segment_paragraphs();
 extern void test_unicorn_string_algorithm_common();
 extern void test_unicorn_string_algorithm_expect();
@@ -148,10 +163,14 @@ extern void test_unicorn_utf_basic_conversions();
 extern void test_unicorn_utf_basic_utilities();
 extern void test_unicorn_utf_decoding_iterators();
 extern void test_unicorn_utf_decoding_ranges();
+extern void test_unicorn_utf_view_iterators();
+extern void test_unicorn_utf_lean_iterators();
 extern void test_unicorn_utf_implicit_recoding();
 extern void test_unicorn_utf_explicit_recoding();
 extern void test_unicorn_utf_string_validation();
 extern void test_unicorn_utf_error_handling();
+extern void test_unicorn_utf_static_policies();
+extern void test_unicorn_utf_buffered_encoding();
 
 int main() {
 
@@ -182,6 +201,7 @@ int main() {
         { "unicorn/character/names", test_unicorn_character_names },
         { "unicorn/character/decomposition-properties", test_unicorn_character_decomposition_properties },
         { "unicorn/character/enumeration-properties", test_unicorn_character_enumeration_properties },
+        { "unicorn/character/packed-properties", test_unicorn_character_packed_properties },
         { "unicorn/character/numeric-properties", test_unicorn_character_numeric_properties },
         { "unicorn/character/script-properties", test_unicorn_character_script_properties },
         { "unicorn/character/test-all-the-things", test_unicorn_character_test_all_the_things },
@@ -201,14 +221,25 @@ int main() {
         { "unicorn/format/class", test_unicorn_format_class },
         { "unicorn/format/literals", test_unicorn_format_literals },
         { "unicorn/io/file-reader", test_unicorn_io_file_reader },
+        { "unicorn/io/file-reader-blocks", test_unicorn_io_file_reader_blocks },
+        { "unicorn/io/mapped-file-reader", test_unicorn_io_mapped_file_reader },
+        { "unicorn/io/parallel-lines", test_unicorn_io_parallel_lines },
         { "unicorn/io/file-writer", test_unicorn_io_file_writer },
+        { "unicorn/io/async-file-writer", test_unicorn_io_async_file_writer },
         { "unicorn/mbcs/locale-detection", test_unicorn_mbcs_locale_detection },
         { "unicorn/mbcs/utf-detection", test_unicorn_mbcs_utf_detection },
+        { "unicorn/mbcs/encoding-detection", test_unicorn_mbcs_encoding_detection },
         { "unicorn/mbcs/encoding-queries", test_unicorn_mbcs_encoding_queries },
         { "unicorn/mbcs/to-unicode", test_unicorn_mbcs_to_unicode },
         { "unicorn/mbcs/from-unicode", test_unicorn_mbcs_from_unicode },
+        { "unicorn/mbcs/builtin-charsets", test_unicorn_mbcs_builtin_charsets },
+        { "unicorn/mbcs/converters", test_unicorn_mbcs_converters },
+        { "unicorn/mbcs/streaming", test_unicorn_mbcs_streaming },
         { "unicorn/mbcs/local-encoding-round-trip", test_unicorn_mbcs_local_encoding_round_trip },
         { "unicorn/normal/normalization", test_unicorn_normal_normalization },
+        { "unicorn/normal/quick-check", test_unicorn_normal_quick_check },
+        { "unicorn/normal/combining-runs", test_unicorn_normal_combining_runs },
+        { "unicorn/normal/streaming", test_unicorn_normal_streaming },
         { "unicorn/options/basic", test_unicorn_options_basic },
         { "unicorn/options/boolean", test_unicorn_options_boolean },
         { "unicorn/options/multiple", test_unicorn_options_multiple },
@@ -249,8 +280,11 @@ int main() {
         { "unicorn/regex/escape", test_unicorn_regex_escape },
         { "unicorn/segment/graphemes", test_unicorn_segment_graphemes },
         { "unicorn/segment/words", test_unicorn_segment_words },
+        { "unicorn/segment/parallel-words", test_unicorn_segment_parallel_words },
+        { "unicorn/segment/boundaries", test_unicorn_segment_boundaries },
         { "unicorn/segment/lines", test_unicorn_segment_lines },
         { "unicorn/segment/sentences", test_unicorn_segment_sentences },
+        { "unicorn/segment/line-breaks", test_unicorn_segment_line_breaks },
         { "unicorn/segment/paragraphs", test_unicorn_segment_paragraphs },
         { "unicorn/string-algorithm/common", test_unicorn_string_algorithm_common },
         { "unicorn/string-algorithm/expect", test_unicorn_string_algorithm_expect },
@@ -303,10 +337,14 @@ int main() {
         { "unicorn/utf/basic-utilities", test_unicorn_utf_basic_utilities },
         { "unicorn/utf/decoding-iterators", test_unicorn_utf_decoding_iterators },
         { "unicorn/utf/decoding-ranges", test_unicorn_utf_decoding_ranges },
+        { "unicorn/utf/view-iterators", test_unicorn_utf_view_iterators },
+        { "unicorn/utf/lean-iterators", test_unicorn_utf_lean_iterators },
         { "unicorn/utf/implicit-recoding", test_unicorn_utf_implicit_recoding },
         { "unicorn/utf/explicit-recoding", test_unicorn_utf_explicit_recoding },
         { "unicorn/utf/string-validation", test_unicorn_utf_string_validation },
         { "unicorn/utf/error-handling", test_unicorn_utf_error_handling },
+        { "unicorn/utf/static-policies", test_unicorn_utf_static_policies },
+        { "unicorn/utf/buffered-encoding", test_unicorn_utf_buffered_encoding },
 
     };
 
@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <iterator>
 #include <string>
+#include <vector>
 
 using namespace RS;
 using namespace RS::Unicorn;
@@ -397,6 +398,87 @@ void test_unicorn_utf_decoding_ranges() {
 
 }
 
+void test_unicorn_utf_view_iterators() {
+
+    std::string_view v8 = c8, w8 = v8.substr(1, 9), e8;
+    std::u16string_view v16 = c16;
+    std::u32string s32;
+    std::u16string s16;
+    Ustring s8;
+    Utf8ViewIterator i8;
+    Utf8ViewRange r8;
+
+    TEST_EQUAL(i8.str(), "");
+    TRY(r8 = utf_range(v8));
+    TRY(i8 = r8.first);  TEST_EQUAL(*i8, 0x4d);      TEST_EQUAL(i8.str(), "\x4d");              TEST_EQUAL(i8.view(), "\x4d");
+    TRY(++i8);           TEST_EQUAL(*i8, 0x430);     TEST_EQUAL(i8.str(), "\xd0\xb0");          TEST_EQUAL(i8.view(), "\xd0\xb0");
+    TRY(++i8);           TEST_EQUAL(*i8, 0x4e8c);    TEST_EQUAL(i8.str(), "\xe4\xba\x8c");      TEST_EQUAL(i8.view(), "\xe4\xba\x8c");
+    TRY(++i8);           TEST_EQUAL(*i8, 0x10302);   TEST_EQUAL(i8.str(), "\xf0\x90\x8c\x82");  TEST_EQUAL(i8.view(), "\xf0\x90\x8c\x82");
+    TRY(++i8);           TEST_EQUAL(*i8, 0x10fffd);  TEST_EQUAL(i8.str(), "\xf4\x8f\xbf\xbd");  TEST_EQUAL(i8.view(), "\xf4\x8f\xbf\xbd");
+    TRY(++i8);           TEST(i8 == r8.second);      TEST_EQUAL(i8.str(), "");                  TEST_EQUAL(i8.view(), "");
+    TRY(--i8);           TEST_EQUAL(*i8, 0x10fffd);  TEST_EQUAL(i8.offset(), 10);
+    TRY(i8 = i8.offset_by(-4));                      TEST_EQUAL(*i8, 0x10302);
+    TEST(i8.source().data() == c8.data());
+
+    TRY(std::copy(utf_begin(w8), utf_end(w8), overwrite(s32)));    TEST_EQUAL(s32, (std::u32string{0x430,0x4e8c,0x10302}));
+    TRY(std::copy(utf_iterator(w8, 2), utf_end(w8), overwrite(s32)));  TEST_EQUAL(s32, (std::u32string{0x4e8c,0x10302}));
+    TRY(r8 = utf_range(e8));  TEST(r8.empty());
+    TRY(r8 = utf_range(w8));  TEST_EQUAL(u_str(r8), "\xd0\xb0\xe4\xba\x8c\xf0\x90\x8c\x82");
+    TRY(r8 = utf_range(v8.substr(0, 8), Utf::replace));  TRY(std::copy(r8.begin(), r8.end(), overwrite(s32)));  TEST_EQUAL(s32, (std::u32string{0x4d,0x430,0x4e8c,0xfffd}));
+    TRY(std::copy(utf_begin(v16), utf_end(v16), overwrite(s32)));  TEST_EQUAL(s32, c32);
+
+    std::string_view xv = x8;
+    TRY(std::copy(utf_begin(xv, Utf::replace), utf_end(xv, Utf::replace), overwrite(s32)));  TEST_EQUAL(s32, y32);
+    TEST_THROW(std::copy(utf_begin(xv, Utf::throws), utf_end(xv, Utf::throws), overwrite(s32)), EncodingError);
+
+    TRY(recode(w8, s16));                TEST_EQUAL(s16, (std::u16string{0x430,0x4e8c,0xd800,0xdf02}));
+    TRY(s32 = recode<char32_t>(v8));     TEST_EQUAL(s32, c32);
+    TRY(s8 = recode<char>(v16));         TEST_EQUAL(s8, c8);
+    TRY(s8 = recode<char>(xv, Utf::replace));  TEST_EQUAL(s8, y8);
+
+    TEST(valid_string(v8));
+    TEST(valid_string(w8));
+    TEST(! valid_string(v8.substr(0, 8)));
+    TEST(! valid_string(xv));
+    TEST(valid_string(v16));
+    TEST(! valid_string(v16.substr(0, 4)));
+
+}
+
+void test_unicorn_utf_lean_iterators() {
+
+    std::u32string s32;
+    Irange<UtfLeanIterator<char>> r8;
+    Irange<UtfLeanIterator<char16_t>> r16;
+    Irange<UtfLeanIterator<char32_t>> r32;
+    UtfLeanIterator<char> i8;
+
+    TRY(r8 = utf_lean_range(c8));
+    TRY(i8 = r8.first);  TEST_EQUAL(*i8, 0x4d);      TEST_EQUAL(i8.count(), 1);  TEST_EQUAL(i8.view(), "\x4d");
+    TRY(++i8);           TEST_EQUAL(*i8, 0x430);     TEST_EQUAL(i8.count(), 2);  TEST_EQUAL(i8.view(), "\xd0\xb0");
+    TRY(++i8);           TEST_EQUAL(*i8, 0x4e8c);    TEST_EQUAL(i8.count(), 3);  TEST_EQUAL(i8.view(), "\xe4\xba\x8c");
+    TRY(++i8);           TEST_EQUAL(*i8, 0x10302);   TEST_EQUAL(i8.count(), 4);  TEST_EQUAL(i8.view(), "\xf0\x90\x8c\x82");
+    TRY(++i8);           TEST_EQUAL(*i8, 0x10fffd);  TEST_EQUAL(i8.count(), 4);  TEST_EQUAL(i8.view(), "\xf4\x8f\xbf\xbd");
+    TRY(++i8);           TEST(i8 == r8.second);      TEST_EQUAL(i8.count(), 0);  TEST_EQUAL(i8.view(), "");
+    TEST(i8.ptr() == c8.data() + c8.size());
+    TEST(sizeof(i8) == 2 * sizeof(void*));
+
+    TRY(r8 = utf_lean_range(a8));   TRY(std::copy(r8.begin(), r8.end(), overwrite(s32)));    TEST_EQUAL(s32, U"");
+    TRY(r8 = utf_lean_range(b8));   TRY(std::copy(r8.begin(), r8.end(), overwrite(s32)));    TEST_EQUAL(s32, U"Hello");
+    TRY(r8 = utf_lean_range(z8));   TRY(std::copy(r8.begin(), r8.end(), overwrite(s32)));    TEST_EQUAL(s32, z32);
+    TRY(r16 = utf_lean_range(c16));  TRY(std::copy(r16.begin(), r16.end(), overwrite(s32)));  TEST_EQUAL(s32, c32);
+    TRY(r32 = utf_lean_range(c32));  TRY(std::copy(r32.begin(), r32.end(), overwrite(s32)));  TEST_EQUAL(s32, c32);
+    TRY(r8 = utf_lean_range(std::string_view(c8).substr(1, 9)));  TEST_EQUAL(u_str(r8), "\xd0\xb0\xe4\xba\x8c\xf0\x90\x8c\x82");
+
+    auto x8r = utf_lean_range<Utf::replace>(x8);
+    TRY(std::copy(x8r.begin(), x8r.end(), overwrite(s32)));  TEST_EQUAL(s32, y32);
+    auto x16r = utf_lean_range<Utf::replace>(x16);
+    TRY(std::copy(x16r.begin(), x16r.end(), overwrite(s32)));  TEST_EQUAL(s32, y32);
+    auto x32r = utf_lean_range<Utf::replace>(x32);
+    TRY(std::copy(x32r.begin(), x32r.end(), overwrite(s32)));  TEST_EQUAL(s32, y32);
+
+}
+
 void test_unicorn_utf_implicit_recoding() {
 
     Ustring s8;
@@ -615,6 +697,46 @@ void test_unicorn_utf_explicit_recoding() {
     TEST_EQUAL(to_wstring(bw), bw);
     TEST_EQUAL(to_wstring(cw), cw);
 
+    // Long strings exercise the bulk transcoding paths
+
+    Ustring long8, bad8;
+    std::u16string long16, bad16;
+    std::u32string long32, bad32;
+
+    for (int i = 0; i < 20; ++i) {
+        long8 += "Hello world \u00e9\u00df \u4e16\u754c \U0001f600 ";
+        long16 += u"Hello world \u00e9\u00df \u4e16\u754c \U0001f600 ";
+        long32 += U"Hello world \u00e9\u00df \u4e16\u754c \U0001f600 ";
+    }
+
+    TEST_EQUAL(to_utf16(long8), long16);
+    TEST_EQUAL(to_utf32(long8), long32);
+    TEST_EQUAL(to_utf8(long16), long8);
+    TEST_EQUAL(to_utf32(long16), long32);
+    TEST_EQUAL(to_utf8(long32), long8);
+    TEST_EQUAL(to_utf16(long32), long16);
+
+    bad8 = long8 + "\xff" + long8;
+    bad16 = long16 + char16_t(0xdc00) + long16;
+    bad32 = long32 + char32_t(0x110000) + long32;
+
+    TEST_THROW(to_utf16(bad8, Utf::throws), EncodingError);
+    TEST_THROW(to_utf8(bad16, Utf::throws), EncodingError);
+    TEST_THROW(to_utf8(bad32, Utf::throws), EncodingError);
+    TEST_EQUAL(to_utf16(bad8, Utf::replace), long16 + u"\ufffd" + long16);
+    TEST_EQUAL(to_utf32(bad8, Utf::replace), long32 + U"\ufffd" + long32);
+    TEST_EQUAL(to_utf8(bad16, Utf::replace), long8 + "\ufffd" + long8);
+    TEST_EQUAL(to_utf32(bad16, Utf::replace), long32 + U"\ufffd" + long32);
+    TEST_EQUAL(to_utf8(bad32, Utf::replace), long8 + "\ufffd" + long8);
+    TEST_EQUAL(to_utf16(bad32, Utf::replace), long16 + u"\ufffd" + long16);
+
+    try {
+        to_utf32(bad8, Utf::throws);
+    }
+    catch (const EncodingError& ex) {
+        TEST_EQUAL(ex.offset(), long8.size());
+    }
+
 }
 
 void test_unicorn_utf_string_validation() {
@@ -691,6 +813,49 @@ void test_unicorn_utf_string_validation() {
     TEST_EQUAL(valid_count(c32), npos);
     TEST_EQUAL(valid_count(x32), 5);
 
+    // Long strings exercise the vectorized UTF-8 validator; every error
+    // position must match the scalar decoder exactly
+
+    auto reference_count = [] (const Ustring& s) {
+        size_t pos = 0;
+        char32_t u = 0;
+        while (pos < s.size()) {
+            auto rc = char_from_utf8(s.data() + pos, s.size() - pos, u);
+            if (rc == 0)
+                return pos;
+            pos += rc;
+        }
+        return npos;
+    };
+
+    Ustring base;
+    for (int i = 0; i < 8; ++i)
+        base += "Hello world \u00e9\u00df \u4e16\u754c \U0001f600 ";
+    const std::vector<Ustring> bad = {
+        "\x80", "\xbf", "\xc0\x80", "\xc1\xbf", "\xc2", "\xe0\x80\x80", "\xe0\xa0", "\xed\xa0\x80",
+        "\xef\xbf", "\xf0\x80\x80\x80", "\xf0\x90\x80", "\xf4\x90\x80\x80", "\xf5\x80\x80\x80", "\xff",
+    };
+
+    TEST(valid_string(base));
+    TEST_EQUAL(valid_count(base), npos);
+    for (size_t len = 0; len <= base.size(); ++len) {
+        s8 = base.substr(0, len);
+        TEST_EQUAL(valid_count(s8), reference_count(s8));
+    }
+    for (auto& b: bad) {
+        for (size_t pos = 0; pos <= base.size(); pos += 3) {
+            s8 = base;
+            s8.insert(pos, b);
+            auto count = reference_count(s8);
+            TEST_EQUAL(valid_count(s8), count);
+            TEST_EQUAL(valid_string(s8), count == npos);
+            if (count != npos)
+                TEST_THROW(check_string(s8), EncodingError);
+            TRY(s8 = sanitize(s8));
+            TEST(valid_string(s8));
+        }
+    }
+
 }
 
 void test_unicorn_utf_error_handling() {
@@ -752,3 +917,104 @@ void test_unicorn_utf_error_handling() {
     TEST_EQUAL(s32, expected);
 
 }
+
+void test_unicorn_utf_static_policies() {
+
+    Ustring s8;
+    std::u16string s16;
+    std::u32string s32;
+    UtfIterator<char, Utf::replace> p8;
+    UtfIterator<char16_t, Utf::throws> p16;
+    Irange<UtfIterator<char, Utf::replace>> r8;
+    Irange<UtfIterator<char32_t, Utf::replace>> r32;
+
+    TRY(r8 = utf_range<Utf::replace>(x8));    TRY(std::copy(r8.begin(), r8.end(), overwrite(s32)));   TEST_EQUAL(s32, y32);
+    TRY(r32 = utf_range<Utf::replace>(x32));  TRY(std::copy(r32.begin(), r32.end(), overwrite(s32)));  TEST_EQUAL(s32, y32);
+    TRY(r8 = utf_range<Utf::replace>(c8));    TRY(std::copy(r8.begin(), r8.end(), overwrite(s32)));   TEST_EQUAL(s32, c32);
+    TEST_EQUAL(r8.begin().flags(), Utf::replace);
+    TEST_EQUAL(u_str(r8), c8);
+
+    // The policy overrides any runtime flags
+    TRY((p8 = UtfIterator<char, Utf::replace>(x8, 0, Utf::throws)));
+    TRY(std::advance(p8, 5));
+    TEST_EQUAL(*p8, 0xfffd);
+    TEST(! p8.valid());
+    TRY(--p8);
+    TEST_EQUAL(*p8, U'o');
+
+    TRY(p16 = utf_begin<Utf::throws>(x16));
+    TRY(std::advance(p16, 4));
+    TEST_THROW_EQUAL(++p16, EncodingError, "Encoding error (UTF-16); offset 5; hex d800");
+    TEST_THROW_EQUAL(p16 = utf_iterator<Utf::throws>(x16, 5), EncodingError, "Encoding error (UTF-16); offset 5; hex d800");
+    TRY(p16 = utf_end<Utf::throws>(c16));
+    TEST_EQUAL(p16.offset(), c16.size());
+
+    s8.clear();   TRY(std::copy(x32.begin(), x32.end(), utf_writer<Utf::replace>(s8)));   TEST_EQUAL(s8, y8);
+    s16.clear();  TRY(std::copy(x32.begin(), x32.end(), utf_writer<Utf::replace>(s16)));  TEST_EQUAL(s16, y16);
+    s16.clear();  TRY(std::copy(c32.begin(), c32.end(), utf_writer<Utf::throws>(s16)));   TEST_EQUAL(s16, c16);
+    s8.clear();
+    TEST_THROW_EQUAL(std::copy(x32.begin(), x32.end(), utf_writer<Utf::throws>(s8)),
+        EncodingError, "Encoding error (UTF-8); offset 5; hex 0000d800");
+
+    TRY(recode<Utf::replace>(x8, s16));         TEST_EQUAL(s16, y16);
+    TRY((s32 = recode<Utf::replace, char32_t>(x16)));  TEST_EQUAL(s32, y32);
+    TEST_THROW(recode<Utf::throws>(x8, s16), EncodingError);
+    TEST_THROW(s8 = (recode<Utf::throws, char>(x32)), EncodingError);
+
+}
+
+void test_unicorn_utf_buffered_encoding() {
+
+    Ustring s8, t8, long8;
+    std::u16string s16;
+    std::u32string long32;
+
+    {
+        UtfAppender<char> out(s8);
+        for (auto c: c32)
+            TRY(out.put(c));
+        TEST(out.valid());
+    }
+    TEST_EQUAL(s8, c8);
+
+    {
+        UtfAppender<char16_t, Utf::replace> out(s16);
+        TRY(out.put(x32.data(), x32.size()));
+        TRY(out.flush());
+        TEST_EQUAL(s16, y16);
+        TRY(out.put(0xd800));
+        TEST(! out.valid());
+    }
+    TEST_EQUAL(s16, y16 + u"�");
+
+    s8 = "abc";
+    {
+        UtfAppender<char> out(s8, Utf::throws);
+        TRY(out.put(U'x'));
+        TEST_THROW_EQUAL(out.put(0xd800), EncodingError, "Encoding error (UTF-8); offset 4; hex 0000d800");
+    }
+    TEST_EQUAL(s8, "abcx");
+
+    for (int i = 0; i < 200; ++i) {
+        long32 += c32;
+        long8 += c8;
+    }
+    s8.clear();
+    {
+        UtfAppender<char, Utf::ignore> out(s8);
+        for (size_t i = 0; i < long32.size(); i += 3) {
+            TRY(out.put(long32[i]));
+            TRY(out.put_unit('#'));
+            TRY(out.put_units("++", 2));
+        }
+        TRY(out.put_units(long8.data(), long8.size()));
+    }
+    for (size_t i = 0; i < long32.size(); i += 3) {
+        *utf_writer(t8) = long32[i];
+        t8 += "#++";
+    }
+    t8 += long8;
+    TEST_EQUAL(s8.size(), t8.size());
+    TEST_EQUAL(s8, t8);
+
+}
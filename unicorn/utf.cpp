@@ -1,5 +1,13 @@
 #include "unicorn/utf.hpp"
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #define UNICORN_UTF8_SIMD 1
+    #include <immintrin.h>
+    #ifdef __SSE2__
+        #define UNICORN_UTF_SSE2 1
+    #endif
+#endif
+
 using namespace std::literals;
 
 namespace RS::Unicorn {
@@ -59,6 +67,445 @@ namespace RS::Unicorn {
             }
         }
 
+        // UTF-8 validation
+
+        //  The vector validators use the lookup table method of Keiser &
+        //  Lemire ("Validating UTF-8 in less than one instruction per byte",
+        //  2021). Each byte is classified by three 16-entry tables, indexed
+        //  by the high and low nibbles of the previous byte and the high
+        //  nibble of the current byte; the AND of the three lookups is
+        //  nonzero if the pair is invalid. Sequences spanning three or four
+        //  bytes are checked separately against the bytes two and three
+        //  positions back. The vector code only reports whether a block
+        //  contains an error; when it does, we back up to the start of the
+        //  character that straddles the block boundary, and let the scalar
+        //  validator find the exact offset.
+
+        namespace {
+
+            size_t utf8_validate_scalar(const char* src, size_t n) noexcept {
+                size_t pos = 0;
+                char32_t u = 0;
+                while (pos < n) {
+                    while (n - pos >= 8) {
+                        uint64_t word;
+                        std::memcpy(&word, src + pos, 8);
+                        if (word & 0x8080808080808080ull)
+                            break;
+                        pos += 8;
+                    }
+                    if (pos == n)
+                        break;
+                    if (uint8_t(src[pos]) <= 0x7f) {
+                        ++pos;
+                        continue;
+                    }
+                    auto rc = UtfEncoding<char>::decode(src + pos, n - pos, u);
+                    if (u == not_unicode)
+                        return pos;
+                    pos += rc;
+                }
+                return npos;
+            }
+
+            // Back up from a block boundary to the start of the character
+            // containing it (at most 4 bytes back, since anything earlier has
+            // already been fully checked).
+
+            size_t utf8_resync(const char* src, size_t pos) noexcept {
+                for (size_t i = 0; i < 4 && pos > 0; ++i) {
+                    --pos;
+                    if ((uint8_t(src[pos]) & 0xc0) != 0x80)
+                        break;
+                }
+                return pos;
+            }
+
+            size_t utf8_finish(const char* src, size_t n, size_t pos) noexcept {
+                pos = utf8_resync(src, pos);
+                auto rc = utf8_validate_scalar(src + pos, n - pos);
+                return rc == npos ? npos : pos + rc;
+            }
+
+            #ifdef UNICORN_UTF8_SIMD
+
+                constexpr uint8_t too_short = 1 << 0;
+                constexpr uint8_t too_long = 1 << 1;
+                constexpr uint8_t overlong_3 = 1 << 2;
+                constexpr uint8_t too_large = 1 << 3;
+                constexpr uint8_t surrogate = 1 << 4;
+                constexpr uint8_t overlong_2 = 1 << 5;
+                constexpr uint8_t too_large_1000 = 1 << 6;
+                constexpr uint8_t overlong_4 = 1 << 6;
+                constexpr uint8_t two_conts = 1 << 7;
+                constexpr uint8_t carry = too_short | too_long | two_conts;
+
+                alignas(16) constexpr uint8_t byte_1_high_table[16] = {
+                    // 0xxx: ASCII
+                    too_long, too_long, too_long, too_long, too_long, too_long, too_long, too_long,
+                    // 10xx: continuation
+                    two_conts, two_conts, two_conts, two_conts,
+                    // 1100: 2 byte lead
+                    too_short | overlong_2,
+                    // 1101: 2 byte lead
+                    too_short,
+                    // 1110: 3 byte lead
+                    too_short | overlong_3 | surrogate,
+                    // 1111: 4 byte lead
+                    too_short | too_large | too_large_1000 | overlong_4,
+                };
+
+                alignas(16) constexpr uint8_t byte_1_low_table[16] = {
+                    carry | overlong_3 | overlong_2 | overlong_4,  // xxxx0000
+                    carry | overlong_2,                            // xxxx0001
+                    carry,                                         // xxxx0010
+                    carry,                                         // xxxx0011
+                    carry | too_large,                             // xxxx0100
+                    carry | too_large | too_large_1000,            // xxxx0101
+                    carry | too_large | too_large_1000,            // xxxx0110
+                    carry | too_large | too_large_1000,            // xxxx0111
+                    carry | too_large | too_large_1000,            // xxxx1000
+                    carry | too_large | too_large_1000,            // xxxx1001
+                    carry | too_large | too_large_1000,            // xxxx1010
+                    carry | too_large | too_large_1000,            // xxxx1011
+                    carry | too_large | too_large_1000,            // xxxx1100
+                    carry | too_large | too_large_1000 | surrogate,  // xxxx1101
+                    carry | too_large | too_large_1000,            // xxxx1110
+                    carry | too_large | too_large_1000,            // xxxx1111
+                };
+
+                alignas(16) constexpr uint8_t byte_2_high_table[16] = {
+                    // 0xxx: ASCII
+                    too_short, too_short, too_short, too_short, too_short, too_short, too_short, too_short,
+                    // 1000
+                    too_long | overlong_2 | two_conts | overlong_3 | too_large_1000 | overlong_4,
+                    // 1001
+                    too_long | overlong_2 | two_conts | overlong_3 | too_large,
+                    // 101x
+                    too_long | overlong_2 | two_conts | surrogate | too_large,
+                    too_long | overlong_2 | two_conts | surrogate | too_large,
+                    // 11xx: lead byte
+                    too_short, too_short, too_short, too_short,
+                };
+
+                // Bytes that would leave a character incomplete if they
+                // appeared in the last 1-3 positions of a block
+
+                alignas(16) constexpr uint8_t incomplete_table[16] = {
+                    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+                    0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xdf, 0xbf,
+                };
+
+                __attribute__((target("sse4.2")))
+                size_t utf8_validate_sse(const char* src, size_t n) noexcept {
+                    const auto b1h = _mm_load_si128(reinterpret_cast<const __m128i*>(byte_1_high_table));
+                    const auto b1l = _mm_load_si128(reinterpret_cast<const __m128i*>(byte_1_low_table));
+                    const auto b2h = _mm_load_si128(reinterpret_cast<const __m128i*>(byte_2_high_table));
+                    const auto incomplete = _mm_load_si128(reinterpret_cast<const __m128i*>(incomplete_table));
+                    const auto nibble = _mm_set1_epi8(0x0f);
+                    const auto high_bit = _mm_set1_epi8(char(0x80));
+                    auto prev_input = _mm_setzero_si128();
+                    auto prev_incomplete = _mm_setzero_si128();
+                    size_t pos = 0;
+                    for (; n - pos >= 16; pos += 16) {
+                        auto input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + pos));
+                        __m128i error;
+                        if (_mm_movemask_epi8(input) == 0) {
+                            error = prev_incomplete;
+                        } else {
+                            auto prev1 = _mm_alignr_epi8(input, prev_input, 15);
+                            auto prev2 = _mm_alignr_epi8(input, prev_input, 14);
+                            auto prev3 = _mm_alignr_epi8(input, prev_input, 13);
+                            auto sc = _mm_and_si128(_mm_and_si128(
+                                _mm_shuffle_epi8(b1h, _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble)),
+                                _mm_shuffle_epi8(b1l, _mm_and_si128(prev1, nibble))),
+                                _mm_shuffle_epi8(b2h, _mm_and_si128(_mm_srli_epi16(input, 4), nibble)));
+                            auto must_23 = _mm_or_si128(_mm_subs_epu8(prev2, _mm_set1_epi8(0xe0 - 0x80)),
+                                _mm_subs_epu8(prev3, _mm_set1_epi8(0xf0 - 0x80)));
+                            error = _mm_xor_si128(_mm_and_si128(must_23, high_bit), sc);
+                            prev_incomplete = _mm_subs_epu8(input, incomplete);
+                        }
+                        if (! _mm_testz_si128(error, error))
+                            return utf8_finish(src, n, pos);
+                        prev_input = input;
+                    }
+                    return utf8_finish(src, n, pos);
+                }
+
+                __attribute__((target("avx2")))
+                size_t utf8_validate_avx2(const char* src, size_t n) noexcept {
+                    const auto b1h = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(byte_1_high_table)));
+                    const auto b1l = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(byte_1_low_table)));
+                    const auto b2h = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(byte_2_high_table)));
+                    const auto incomplete = _mm256_inserti128_si256(_mm256_set1_epi8(char(0xff)),
+                        _mm_load_si128(reinterpret_cast<const __m128i*>(incomplete_table)), 1);
+                    const auto nibble = _mm256_set1_epi8(0x0f);
+                    const auto high_bit = _mm256_set1_epi8(char(0x80));
+                    auto prev_input = _mm256_setzero_si256();
+                    auto prev_incomplete = _mm256_setzero_si256();
+                    size_t pos = 0;
+                    for (; n - pos >= 32; pos += 32) {
+                        auto input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + pos));
+                        __m256i error;
+                        if (_mm256_movemask_epi8(input) == 0) {
+                            error = prev_incomplete;
+                        } else {
+                            // Lanes: [prev_input.hi, input.lo] lets alignr shift across the 128-bit boundary
+                            auto shifted = _mm256_permute2x128_si256(prev_input, input, 0x21);
+                            auto prev1 = _mm256_alignr_epi8(input, shifted, 15);
+                            auto prev2 = _mm256_alignr_epi8(input, shifted, 14);
+                            auto prev3 = _mm256_alignr_epi8(input, shifted, 13);
+                            auto sc = _mm256_and_si256(_mm256_and_si256(
+                                _mm256_shuffle_epi8(b1h, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble)),
+                                _mm256_shuffle_epi8(b1l, _mm256_and_si256(prev1, nibble))),
+                                _mm256_shuffle_epi8(b2h, _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble)));
+                            auto must_23 = _mm256_or_si256(_mm256_subs_epu8(prev2, _mm256_set1_epi8(0xe0 - 0x80)),
+                                _mm256_subs_epu8(prev3, _mm256_set1_epi8(0xf0 - 0x80)));
+                            error = _mm256_xor_si256(_mm256_and_si256(must_23, high_bit), sc);
+                            prev_incomplete = _mm256_subs_epu8(input, incomplete);
+                        }
+                        if (! _mm256_testz_si256(error, error))
+                            return utf8_finish(src, n, pos);
+                        prev_input = input;
+                    }
+                    return utf8_finish(src, n, pos);
+                }
+
+            #endif
+
+            using Utf8Validator = size_t (*)(const char*, size_t) noexcept;
+
+            Utf8Validator select_utf8_validator() noexcept {
+                #ifdef UNICORN_UTF8_SIMD
+                    __builtin_cpu_init();
+                    if (__builtin_cpu_supports("avx2"))
+                        return utf8_validate_avx2;
+                    if (__builtin_cpu_supports("sse4.2"))
+                        return utf8_validate_sse;
+                #endif
+                return utf8_validate_scalar;
+            }
+
+        }
+
+        size_t utf8_validate(const char* src, size_t n) noexcept {
+            static const Utf8Validator validator = select_utf8_validator();
+            return validator(src, n);
+        }
+
+        // ASCII run detection
+
+        size_t ascii_prefix(const char* src, size_t n) noexcept {
+            size_t pos = 0;
+            #ifdef UNICORN_UTF_SSE2
+                for (; n - pos >= 16; pos += 16) {
+                    auto mask = _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + pos)));
+                    if (mask)
+                        return pos + __builtin_ctz(unsigned(mask));
+                }
+            #endif
+            for (; n - pos >= 8; pos += 8) {
+                uint64_t word;
+                std::memcpy(&word, src + pos, 8);
+                if (word & 0x8080808080808080ull)
+                    break;
+            }
+            while (pos < n && uint8_t(src[pos]) <= 0x7f)
+                ++pos;
+            return pos;
+        }
+
+        // Bulk transcoding
+
+        size_t recode_valid(const char* src, size_t n, char16_t*& dst) noexcept {
+            auto code = reinterpret_cast<const uint8_t*>(src);
+            size_t pos = 0;
+            char32_t u = 0;
+            while (pos < n) {
+                #ifdef UNICORN_UTF_SSE2
+                    while (n - pos >= 16) {
+                        auto in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(code + pos));
+                        if (_mm_movemask_epi8(in))
+                            break;
+                        auto zero = _mm_setzero_si128();
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_unpacklo_epi8(in, zero));
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 8), _mm_unpackhi_epi8(in, zero));
+                        pos += 16;
+                        dst += 16;
+                    }
+                    if (pos == n)
+                        break;
+                #endif
+                if (code[pos] <= 0x7f) {
+                    *dst++ = code[pos++];
+                    continue;
+                }
+                auto rc = UtfEncoding<char>::decode(src + pos, n - pos, u);
+                if (u == not_unicode)
+                    break;
+                pos += rc;
+                dst += UtfEncoding<char16_t>::encode(u, dst);
+            }
+            return pos;
+        }
+
+        size_t recode_valid(const char* src, size_t n, char32_t*& dst) noexcept {
+            auto code = reinterpret_cast<const uint8_t*>(src);
+            size_t pos = 0;
+            char32_t u = 0;
+            while (pos < n) {
+                #ifdef UNICORN_UTF_SSE2
+                    while (n - pos >= 16) {
+                        auto in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(code + pos));
+                        if (_mm_movemask_epi8(in))
+                            break;
+                        auto zero = _mm_setzero_si128();
+                        auto lo = _mm_unpacklo_epi8(in, zero);
+                        auto hi = _mm_unpackhi_epi8(in, zero);
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_unpacklo_epi16(lo, zero));
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 4), _mm_unpackhi_epi16(lo, zero));
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 8), _mm_unpacklo_epi16(hi, zero));
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 12), _mm_unpackhi_epi16(hi, zero));
+                        pos += 16;
+                        dst += 16;
+                    }
+                    if (pos == n)
+                        break;
+                #endif
+                if (code[pos] <= 0x7f) {
+                    *dst++ = code[pos++];
+                    continue;
+                }
+                auto rc = UtfEncoding<char>::decode(src + pos, n - pos, u);
+                if (u == not_unicode)
+                    break;
+                pos += rc;
+                *dst++ = u;
+            }
+            return pos;
+        }
+
+        size_t recode_valid(const char16_t* src, size_t n, char*& dst) noexcept {
+            size_t pos = 0;
+            char32_t u = 0;
+            while (pos < n) {
+                #ifdef UNICORN_UTF_SSE2
+                    while (n - pos >= 16) {
+                        auto in1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + pos));
+                        auto in2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + pos + 8));
+                        auto high = _mm_and_si128(_mm_or_si128(in1, in2), _mm_set1_epi16(short(0xff80)));
+                        if (_mm_movemask_epi8(_mm_cmpeq_epi16(high, _mm_setzero_si128())) != 0xffff)
+                            break;
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(in1, in2));
+                        pos += 16;
+                        dst += 16;
+                    }
+                    if (pos == n)
+                        break;
+                #endif
+                if (src[pos] <= 0x7f) {
+                    *dst++ = char(src[pos++]);
+                    continue;
+                }
+                auto rc = UtfEncoding<char16_t>::decode(src + pos, n - pos, u);
+                if (u == not_unicode)
+                    break;
+                pos += rc;
+                dst += UtfEncoding<char>::encode(u, dst);
+            }
+            return pos;
+        }
+
+        size_t recode_valid(const char16_t* src, size_t n, char16_t*& dst) noexcept {
+            size_t pos = 0;
+            char32_t u = 0;
+            while (pos < n) {
+                auto rc = UtfEncoding<char16_t>::decode(src + pos, n - pos, u);
+                if (u == not_unicode)
+                    break;
+                std::memcpy(dst, src + pos, rc * sizeof(char16_t));
+                pos += rc;
+                dst += rc;
+            }
+            return pos;
+        }
+
+        size_t recode_valid(const char16_t* src, size_t n, char32_t*& dst) noexcept {
+            size_t pos = 0;
+            char32_t u = 0;
+            while (pos < n) {
+                #ifdef UNICORN_UTF_SSE2
+                    while (n - pos >= 8) {
+                        auto in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + pos));
+                        auto sur = _mm_cmpeq_epi16(_mm_and_si128(in, _mm_set1_epi16(short(0xf800))), _mm_set1_epi16(short(0xd800)));
+                        if (_mm_movemask_epi8(sur))
+                            break;
+                        auto zero = _mm_setzero_si128();
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_unpacklo_epi16(in, zero));
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 4), _mm_unpackhi_epi16(in, zero));
+                        pos += 8;
+                        dst += 8;
+                    }
+                    if (pos == n)
+                        break;
+                #endif
+                auto rc = UtfEncoding<char16_t>::decode(src + pos, n - pos, u);
+                if (u == not_unicode)
+                    break;
+                pos += rc;
+                *dst++ = u;
+            }
+            return pos;
+        }
+
+        size_t recode_valid(const char32_t* src, size_t n, char*& dst) noexcept {
+            size_t pos = 0;
+            while (pos < n) {
+                #ifdef UNICORN_UTF_SSE2
+                    while (n - pos >= 16) {
+                        auto in1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + pos));
+                        auto in2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + pos + 4));
+                        auto in3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + pos + 8));
+                        auto in4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + pos + 12));
+                        auto high = _mm_and_si128(_mm_or_si128(_mm_or_si128(in1, in2), _mm_or_si128(in3, in4)), _mm_set1_epi32(~0x7f));
+                        if (_mm_movemask_epi8(_mm_cmpeq_epi32(high, _mm_setzero_si128())) != 0xffff)
+                            break;
+                        auto lo = _mm_packs_epi32(in1, in2);
+                        auto hi = _mm_packs_epi32(in3, in4);
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(lo, hi));
+                        pos += 16;
+                        dst += 16;
+                    }
+                    if (pos == n)
+                        break;
+                #endif
+                if (src[pos] <= 0x7f) {
+                    *dst++ = char(src[pos++]);
+                    continue;
+                }
+                if (! char_is_unicode(src[pos]))
+                    break;
+                dst += UtfEncoding<char>::encode(src[pos++], dst);
+            }
+            return pos;
+        }
+
+        size_t recode_valid(const char32_t* src, size_t n, char16_t*& dst) noexcept {
+            size_t pos = 0;
+            for (; pos < n && char_is_unicode(src[pos]); ++pos)
+                dst += UtfEncoding<char16_t>::encode(src[pos], dst);
+            return pos;
+        }
+
+        size_t recode_valid(const char32_t* src, size_t n, char32_t*& dst) noexcept {
+            size_t pos = 0;
+            while (pos < n && char_is_unicode(src[pos]))
+                ++pos;
+            std::memcpy(dst, src, pos * sizeof(char32_t));
+            dst += pos;
+            return pos;
+        }
+
         size_t UtfEncoding<char>::decode_prev(const char* src, size_t pos, char32_t& dst) noexcept {
             auto code = reinterpret_cast<const uint8_t*>(src);
             size_t start = pos - 1;
@@ -7,6 +7,7 @@
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <utility>
 
 namespace RS::Unicorn {
@@ -123,6 +124,17 @@ namespace RS::Unicorn {
             static const char* name() noexcept { return "wchar_t"; }
         };
 
+        // utf8_validate() returns the offset of the first invalid UTF-8
+        // sequence, or npos if the whole string is valid. This uses SIMD
+        // where the CPU supports it, otherwise a scalar loop.
+
+        size_t utf8_validate(const char* src, size_t n) noexcept;
+
+        // ascii_prefix() returns the length of the leading run of ASCII
+        // bytes (or n if the whole string is ASCII).
+
+        size_t ascii_prefix(const char* src, size_t n) noexcept;
+
         template <typename C> inline void append_error(std::basic_string<C>& str) { str += static_cast<C>(replacement_char); }
         inline void append_error(Ustring& str) { str += utf8_replacement; }
 
@@ -211,10 +223,15 @@ namespace RS::Unicorn {
 
     // UTF decoding iterator
 
-    template <typename C>
+    // Policy is one of the Utf error handling flags, fixing the behaviour at
+    // compile time, or zero to take the flags passed to the constructor.
+
+    template <typename C, uint32_t Policy = 0>
     class UtfIterator:
-    public BidirectionalIterator<UtfIterator<C>, const char32_t> {
+    public BidirectionalIterator<UtfIterator<C, Policy>, const char32_t> {
     public:
+        static_assert(Policy == 0 || Policy == Utf::ignore || Policy == Utf::replace || Policy == Utf::throws,
+            "Invalid UTF error handling policy");
         using code_unit = C;
         using string_type = std::basic_string<C>;
         UtfIterator() noexcept { static const string_type dummy; sptr = &dummy; }
@@ -225,6 +242,7 @@ namespace RS::Unicorn {
         UtfIterator& operator++();
         UtfIterator& operator--();
         size_t count() const noexcept { return units; }
+        uint32_t flags() const noexcept { return mode(); }
         size_t offset() const noexcept { return ofs; }
         UtfIterator offset_by(ptrdiff_t n) const noexcept;
         const C* ptr() const noexcept { return sptr ? sptr->data() + ofs : nullptr; }
@@ -240,10 +258,11 @@ namespace RS::Unicorn {
         char32_t u = 0;                     // Current decoded character
         uint32_t fset = Utf::ignore;        // Error handling flag
         bool ok = false;                    // Current character is valid
+        uint32_t mode() const noexcept { if constexpr (Policy != 0) return Policy; else return fset; }
     };
 
-    template <typename C>
-    UtfIterator<C>& UtfIterator<C>::operator++() {
+    template <typename C, uint32_t Policy>
+    UtfIterator<C, Policy>& UtfIterator<C, Policy>::operator++() {
         using namespace UnicornDetail;
         ofs = std::min(ofs + units, sptr->size());
         units = 0;
@@ -251,7 +270,7 @@ namespace RS::Unicorn {
         ok = false;
         if (ofs == sptr->size()) {
             // do nothing
-        } else if (fset & Utf::ignore) {
+        } else if (mode() & Utf::ignore) {
             units = UtfEncoding<C>::decode_fast(sptr->data() + ofs, sptr->size() - ofs, u);
             ok = true;
         } else {
@@ -259,15 +278,15 @@ namespace RS::Unicorn {
             ok = char_is_unicode(u);
             if (! ok) {
                 u = replacement_char;
-                if (fset & Utf::throws)
+                if (mode() & Utf::throws)
                     throw EncodingError(UtfEncoding<C>::name(), ofs, sptr->data() + ofs, units);
             }
         }
         return *this;
     }
 
-    template <typename C>
-    UtfIterator<C>& UtfIterator<C>::operator--() {
+    template <typename C, uint32_t Policy>
+    UtfIterator<C, Policy>& UtfIterator<C, Policy>::operator--() {
         using namespace UnicornDetail;
         units = 0;
         u = 0;
@@ -276,17 +295,17 @@ namespace RS::Unicorn {
             return *this;
         units = UtfEncoding<C>::decode_prev(sptr->data(), ofs, u);
         ofs -= units;
-        ok = (fset & Utf::ignore) || char_is_unicode(u);
+        ok = (mode() & Utf::ignore) || char_is_unicode(u);
         if (! ok) {
             u = replacement_char;
-            if (fset & Utf::throws)
+            if (mode() & Utf::throws)
                 throw EncodingError(UtfEncoding<C>::name(), ofs, sptr->data() + ofs, units);
         }
         return *this;
     }
 
-    template <typename C>
-    UtfIterator<C> UtfIterator<C>::offset_by(ptrdiff_t n) const noexcept {
+    template <typename C, uint32_t Policy>
+    UtfIterator<C, Policy> UtfIterator<C, Policy>::offset_by(ptrdiff_t n) const noexcept {
         if (! sptr)
             return *this;
         auto i = *this;
@@ -296,8 +315,8 @@ namespace RS::Unicorn {
         return i;
     }
 
-    template <typename C>
-    std::basic_string_view<C> UtfIterator<C>::view() const noexcept {
+    template <typename C, uint32_t Policy>
+    std::basic_string_view<C> UtfIterator<C, Policy>::view() const noexcept {
         if (sptr)
             return {sptr->data() + ofs, units};
         else
@@ -333,22 +352,251 @@ namespace RS::Unicorn {
         return {utf_begin(src, flags), utf_end(src, flags)};
     }
 
-    template <typename C>
-    std::basic_string<C> u_str(const UtfIterator<C>& i, const UtfIterator<C>& j) {
+    template <uint32_t Policy, typename C>
+    UtfIterator<C, Policy> utf_begin(const std::basic_string<C>& src) {
+        return {src, 0};
+    }
+
+    template <uint32_t Policy, typename C>
+    UtfIterator<C, Policy> utf_end(const std::basic_string<C>& src) {
+        return {src, src.size()};
+    }
+
+    template <uint32_t Policy, typename C>
+    UtfIterator<C, Policy> utf_iterator(const std::basic_string<C>& src, size_t offset) {
+        return {src, offset};
+    }
+
+    template <uint32_t Policy, typename C>
+    Irange<UtfIterator<C, Policy>> utf_range(const std::basic_string<C>& src) {
+        return {utf_begin<Policy>(src), utf_end<Policy>(src)};
+    }
+
+    template <typename C, uint32_t Policy>
+    std::basic_string<C> u_str(const UtfIterator<C, Policy>& i, const UtfIterator<C, Policy>& j) {
         return i.source().substr(i.offset(), j.offset() - i.offset());
     }
 
+    template <typename C, uint32_t Policy>
+    std::basic_string<C> u_str(const Irange<UtfIterator<C, Policy>>& range) {
+        return u_str(range.begin(), range.end());
+    }
+
+    // UTF decoding iterator over a string view
+
     template <typename C>
-    std::basic_string<C> u_str(const Irange<UtfIterator<C>>& range) {
+    class UtfViewIterator:
+    public BidirectionalIterator<UtfViewIterator<C>, const char32_t> {
+    public:
+        using code_unit = C;
+        using string_type = std::basic_string<C>;
+        using view_type = std::basic_string_view<C>;
+        UtfViewIterator() noexcept {}
+        explicit UtfViewIterator(view_type src): sv(src) { if (popcount(fset & Utf::mask) == 0) fset |= Utf::ignore; ++*this; }
+        UtfViewIterator(view_type src, size_t offset, uint32_t flags = 0):
+            sv(src), ofs(std::min(offset, src.size())), fset(flags) { if (popcount(fset & Utf::mask) == 0) fset |= Utf::ignore; ++*this; }
+        const char32_t& operator*() const noexcept { return u; }
+        UtfViewIterator& operator++();
+        UtfViewIterator& operator--();
+        size_t count() const noexcept { return units; }
+        uint32_t flags() const noexcept { return fset; }
+        size_t offset() const noexcept { return ofs; }
+        UtfViewIterator offset_by(ptrdiff_t n) const noexcept;
+        const C* ptr() const noexcept { return sv.data() + ofs; }
+        view_type source() const noexcept { return sv; }
+        string_type str() const { return string_type(view()); }
+        bool valid() const noexcept { return ok; }
+        view_type view() const noexcept { return sv.substr(ofs, units); }
+        friend bool operator==(const UtfViewIterator& lhs, const UtfViewIterator& rhs) noexcept { return lhs.ofs == rhs.ofs; }
+    private:
+        view_type sv;                 // Source string
+        size_t ofs = 0;               // Offset of current character in source
+        size_t units = 0;             // Code units in current character
+        char32_t u = 0;               // Current decoded character
+        uint32_t fset = Utf::ignore;  // Error handling flag
+        bool ok = false;              // Current character is valid
+    };
+
+    template <typename C>
+    UtfViewIterator<C>& UtfViewIterator<C>::operator++() {
+        using namespace UnicornDetail;
+        ofs = std::min(ofs + units, sv.size());
+        units = 0;
+        u = 0;
+        ok = false;
+        if (ofs == sv.size()) {
+            // do nothing
+        } else if (fset & Utf::ignore) {
+            units = UtfEncoding<C>::decode_fast(sv.data() + ofs, sv.size() - ofs, u);
+            ok = true;
+        } else {
+            units = UtfEncoding<C>::decode(sv.data() + ofs, sv.size() - ofs, u);
+            ok = char_is_unicode(u);
+            if (! ok) {
+                u = replacement_char;
+                if (fset & Utf::throws)
+                    throw EncodingError(UtfEncoding<C>::name(), ofs, sv.data() + ofs, units);
+            }
+        }
+        return *this;
+    }
+
+    template <typename C>
+    UtfViewIterator<C>& UtfViewIterator<C>::operator--() {
+        using namespace UnicornDetail;
+        units = 0;
+        u = 0;
+        ok = false;
+        if (ofs == 0)
+            return *this;
+        units = UtfEncoding<C>::decode_prev(sv.data(), ofs, u);
+        ofs -= units;
+        ok = (fset & Utf::ignore) || char_is_unicode(u);
+        if (! ok) {
+            u = replacement_char;
+            if (fset & Utf::throws)
+                throw EncodingError(UtfEncoding<C>::name(), ofs, sv.data() + ofs, units);
+        }
+        return *this;
+    }
+
+    template <typename C>
+    UtfViewIterator<C> UtfViewIterator<C>::offset_by(ptrdiff_t n) const noexcept {
+        auto i = *this;
+        i.ofs = std::clamp(size_t(ptrdiff_t(ofs) + n), size_t(0), sv.size());
+        i.units = 0;
+        ++i;
+        return i;
+    }
+
+    using Utf8ViewIterator = UtfViewIterator<char>;
+    using Utf8ViewRange = Irange<Utf8ViewIterator>;
+    using Utf16ViewIterator = UtfViewIterator<char16_t>;
+    using Utf16ViewRange = Irange<Utf16ViewIterator>;
+    using Utf32ViewIterator = UtfViewIterator<char32_t>;
+    using Utf32ViewRange = Irange<Utf32ViewIterator>;
+    using WcharViewIterator = UtfViewIterator<wchar_t>;
+    using WcharViewRange = Irange<WcharViewIterator>;
+
+    template <typename C>
+    UtfViewIterator<C> utf_begin(std::basic_string_view<C> src, uint32_t flags = 0) {
+        return {src, 0, flags};
+    }
+
+    template <typename C>
+    UtfViewIterator<C> utf_end(std::basic_string_view<C> src, uint32_t flags = 0) {
+        return {src, src.size(), flags};
+    }
+
+    template <typename C>
+    UtfViewIterator<C> utf_iterator(std::basic_string_view<C> src, size_t offset, uint32_t flags = 0) {
+        return {src, offset, flags};
+    }
+
+    template <typename C>
+    Irange<UtfViewIterator<C>> utf_range(std::basic_string_view<C> src, uint32_t flags = 0) {
+        return {utf_begin(src, flags), utf_end(src, flags)};
+    }
+
+    template <typename C>
+    std::basic_string<C> u_str(const UtfViewIterator<C>& i, const UtfViewIterator<C>& j) {
+        return std::basic_string<C>(i.source().substr(i.offset(), j.offset() - i.offset()));
+    }
+
+    template <typename C>
+    std::basic_string<C> u_str(const Irange<UtfViewIterator<C>>& range) {
+        return u_str(range.begin(), range.end());
+    }
+
+    // Lean UTF decoding iterator
+
+    template <typename C, uint32_t Flags = Utf::ignore>
+    class UtfLeanIterator:
+    public ForwardIterator<UtfLeanIterator<C, Flags>, const char32_t> {
+    public:
+        static_assert(Flags == Utf::ignore || Flags == Utf::replace, "UtfLeanIterator does not support Utf::throws");
+        using code_unit = C;
+        using view_type = std::basic_string_view<C>;
+        UtfLeanIterator() noexcept {}
+        UtfLeanIterator(const C* pos, const C* end) noexcept: cur(pos), stop(end) {}
+        char32_t operator*() const noexcept;
+        UtfLeanIterator& operator++() noexcept { cur += count(); return *this; }
+        size_t count() const noexcept;
+        const C* ptr() const noexcept { return cur; }
+        view_type view() const noexcept { return {cur, count()}; }
+        friend bool operator==(const UtfLeanIterator& lhs, const UtfLeanIterator& rhs) noexcept { return lhs.cur == rhs.cur; }
+    private:
+        const C* cur = nullptr;   // Current position
+        const C* stop = nullptr;  // End of source string
+        size_t decode(char32_t& u) const noexcept;
+    };
+
+    template <typename C, uint32_t Flags>
+    char32_t UtfLeanIterator<C, Flags>::operator*() const noexcept {
+        char32_t u = 0;
+        decode(u);
+        if constexpr (Flags == Utf::replace)
+            if (cur != stop && ! char_is_unicode(u))
+                u = replacement_char;
+        return u;
+    }
+
+    template <typename C, uint32_t Flags>
+    size_t UtfLeanIterator<C, Flags>::count() const noexcept {
+        // Without validation the length follows from the first code unit
+        if constexpr (Flags == Utf::ignore && sizeof(C) == 1) {
+            if (cur == stop)
+                return 0;
+            auto code = uint8_t(*cur);
+            size_t len = code <= 0xc1 ? 1 : code <= 0xdf ? 2 : code <= 0xef ? 3 : 4;
+            return std::min(len, size_t(stop - cur));
+        } else if constexpr (Flags == Utf::ignore && sizeof(C) == 4) {
+            return cur != stop;
+        } else {
+            char32_t u = 0;
+            return decode(u);
+        }
+    }
+
+    template <typename C, uint32_t Flags>
+    size_t UtfLeanIterator<C, Flags>::decode(char32_t& u) const noexcept {
+        using namespace UnicornDetail;
+        if (cur == stop)
+            return 0;
+        else if constexpr (Flags == Utf::ignore)
+            return UtfEncoding<C>::decode_fast(cur, stop - cur, u);
+        else
+            return UtfEncoding<C>::decode(cur, stop - cur, u);
+    }
+
+    template <uint32_t Flags = Utf::ignore, typename C>
+    Irange<UtfLeanIterator<C, Flags>> utf_lean_range(std::basic_string_view<C> src) noexcept {
+        return {{src.data(), src.data() + src.size()}, {src.data() + src.size(), src.data() + src.size()}};
+    }
+
+    template <uint32_t Flags = Utf::ignore, typename C>
+    Irange<UtfLeanIterator<C, Flags>> utf_lean_range(const std::basic_string<C>& src) noexcept {
+        return utf_lean_range<Flags>(std::basic_string_view<C>(src));
+    }
+
+    template <typename C, uint32_t Flags>
+    std::basic_string<C> u_str(const UtfLeanIterator<C, Flags>& i, const UtfLeanIterator<C, Flags>& j) {
+        return std::basic_string<C>(i.ptr(), j.ptr() - i.ptr());
+    }
+
+    template <typename C, uint32_t Flags>
+    std::basic_string<C> u_str(const Irange<UtfLeanIterator<C, Flags>>& range) {
         return u_str(range.begin(), range.end());
     }
 
     // UTF encoding iterator
 
-    template <typename C>
+    template <typename C, uint32_t Policy = 0>
     class UtfWriter:
-    public OutputIterator<UtfWriter<C>> {
+    public OutputIterator<UtfWriter<C, Policy>> {
     public:
+        static_assert(Policy == 0 || Policy == Utf::ignore || Policy == Utf::replace || Policy == Utf::throws,
+            "Invalid UTF error handling policy");
         using code_unit = C;
         using string_type = std::basic_string<C>;
         UtfWriter() noexcept {}
@@ -360,14 +608,15 @@ namespace RS::Unicorn {
         string_type* sptr = nullptr;  // Destination string
         uint32_t fset = Utf::ignore;  // Error handling flag
         bool ok = false;              // Most recent character is valid
+        uint32_t mode() const noexcept { if constexpr (Policy != 0) return Policy; else return fset; }
     };
 
-    template <typename C>
-    UtfWriter<C>& UtfWriter<C>::operator=(char32_t u) {
+    template <typename C, uint32_t Policy>
+    UtfWriter<C, Policy>& UtfWriter<C, Policy>::operator=(char32_t u) {
         using namespace UnicornDetail;
         if (! sptr)
             return *this;
-        bool fast = fset & Utf::ignore;
+        bool fast = mode() & Utf::ignore;
         auto pos = sptr->size();
         sptr->resize(pos + UtfEncoding<C>::max_units);
         size_t rc = 0;
@@ -379,7 +628,7 @@ namespace RS::Unicorn {
         } else {
             ok = rc > 0;
             if (! ok) {
-                if (fset & Utf::throws)
+                if (mode() & Utf::throws)
                     throw EncodingError(UtfEncoding<C>::name(), pos, &u);
                 else
                     append_error(*sptr);
@@ -398,10 +647,142 @@ namespace RS::Unicorn {
         return {dst, flags};
     }
 
+    template <uint32_t Policy, typename C>
+    UtfWriter<C, Policy> utf_writer(std::basic_string<C>& dst) noexcept {
+        return UtfWriter<C, Policy>(dst);
+    }
+
+    // Buffered UTF encoder
+
+    template <typename C, uint32_t Policy = 0>
+    class UtfAppender {
+    public:
+        static_assert(Policy == 0 || Policy == Utf::ignore || Policy == Utf::replace || Policy == Utf::throws,
+            "Invalid UTF error handling policy");
+        using code_unit = C;
+        using string_type = std::basic_string<C>;
+        explicit UtfAppender(string_type& dst) noexcept: sptr(&dst) { if (popcount(fset & Utf::mask) == 0) fset |= Utf::ignore; }
+        UtfAppender(string_type& dst, uint32_t flags) noexcept: sptr(&dst), fset(flags) { if (popcount(fset & Utf::mask) == 0) fset |= Utf::ignore; }
+        ~UtfAppender() noexcept { try { flush(); } catch (...) {} }
+        UtfAppender(const UtfAppender&) = delete;
+        UtfAppender& operator=(const UtfAppender&) = delete;
+        void flush() { sptr->append(buf, len); len = 0; }
+        void put(char32_t u);
+        void put(const char32_t* ptr, size_t n) { for (; n > 0; --n) put(*ptr++); }
+        void put_unit(C c) { if (len == block) flush(); buf[len++] = c; }
+        void put_units(const C* ptr, size_t n);
+        bool valid() const noexcept { return ok; }
+    private:
+        static constexpr size_t block = 256;
+        string_type* sptr;            // Destination string
+        uint32_t fset = Utf::ignore;  // Error handling flag
+        size_t len = 0;               // Code units held in buffer
+        bool ok = false;              // Most recent character is valid
+        C buf[block];                 // Pending output
+        uint32_t mode() const noexcept { if constexpr (Policy != 0) return Policy; else return fset; }
+    };
+
+    template <typename C, uint32_t Policy>
+    void UtfAppender<C, Policy>::put(char32_t u) {
+        using namespace UnicornDetail;
+        if (len > block - UtfEncoding<C>::max_units)
+            flush();
+        if (mode() & Utf::ignore) {
+            len += UtfEncoding<C>::encode(u, buf + len);
+            ok = true;
+        } else {
+            ok = char_is_unicode(u);
+            if (ok)
+                len += UtfEncoding<C>::encode(u, buf + len);
+            else if (mode() & Utf::throws)
+                throw EncodingError(UtfEncoding<C>::name(), sptr->size() + len, &u);
+            else
+                len += UtfEncoding<C>::encode(replacement_char, buf + len);
+        }
+    }
+
+    template <typename C, uint32_t Policy>
+    void UtfAppender<C, Policy>::put_units(const C* ptr, size_t n) {
+        if (n > block - len) {
+            flush();
+            if (n > block) {
+                sptr->append(ptr, n);
+                return;
+            }
+        }
+        std::copy_n(ptr, n, buf + len);
+        len += n;
+    }
+
     // UTF conversion functions
 
     namespace UnicornDetail {
 
+        // The recode_valid() functions convert the longest valid prefix of
+        // the input, writing to dst and advancing it, and return the number
+        // of input code units consumed. The caller must ensure that dst has
+        // room for at least recode_expansion<C1,C2>() output code units per
+        // input code unit. ASCII (or BMP) runs are converted with SSE2 block
+        // operations where available.
+
+        size_t recode_valid(const char* src, size_t n, char16_t*& dst) noexcept;
+        size_t recode_valid(const char* src, size_t n, char32_t*& dst) noexcept;
+        size_t recode_valid(const char16_t* src, size_t n, char*& dst) noexcept;
+        size_t recode_valid(const char16_t* src, size_t n, char16_t*& dst) noexcept;
+        size_t recode_valid(const char16_t* src, size_t n, char32_t*& dst) noexcept;
+        size_t recode_valid(const char32_t* src, size_t n, char*& dst) noexcept;
+        size_t recode_valid(const char32_t* src, size_t n, char16_t*& dst) noexcept;
+        size_t recode_valid(const char32_t* src, size_t n, char32_t*& dst) noexcept;
+
+        template <typename C> using UtfUnit = std::conditional_t<std::is_same_v<C, wchar_t>, WcharEquivalent, C>;
+
+        template <typename C1, typename C2>
+        constexpr size_t recode_expansion() noexcept {
+            if constexpr (sizeof(C1) == 1)
+                return 1;
+            else if constexpr (sizeof(C1) == 2)
+                return sizeof(C2) == 1 ? 3 : 1;
+            else
+                return UtfEncoding<C2>::max_units;
+        }
+
+        // Bulk conversion: size the output once, convert valid runs with
+        // recode_valid(), and fall back on the per-character path only for
+        // invalid input.
+
+        template <typename C1, typename C2>
+        void bulk_recode(const C1* src, size_t n, std::basic_string<C2>& dst, uint32_t flags) {
+            using U1 = UtfUnit<C1>;
+            using U2 = UtfUnit<C2>;
+            constexpr size_t expand = recode_expansion<U1, U2>();
+            auto in = reinterpret_cast<const U1*>(src);
+            size_t base = dst.size(), pos = 0, used = 0;
+            char32_t u = 0;
+            dst.resize(base + expand * n);
+            while (pos < n) {
+                auto out = reinterpret_cast<U2*>(&dst[0] + base + used);
+                auto start = out;
+                pos += recode_valid(in + pos, n - pos, out);
+                used += out - start;
+                if (pos == n)
+                    break;
+                auto rc = UtfEncoding<U1>::decode(in + pos, n - pos, u);
+                if (! (flags & Utf::ignore)) {
+                    if (flags & Utf::throws) {
+                        dst.resize(base + used);
+                        throw EncodingError(UtfEncoding<C1>::name(), pos, src + pos, rc);
+                    }
+                    u = replacement_char;
+                }
+                pos += rc;
+                size_t room = expand * (n - pos) + UtfEncoding<U2>::max_units;
+                if (dst.size() - base - used < room)
+                    dst.resize(base + used + room);
+                used += UtfEncoding<U2>::encode(u, reinterpret_cast<U2*>(&dst[0] + base + used));
+            }
+            dst.resize(base + used);
+        }
+
         template <typename C1, typename C2>
         struct Recode {
             void operator()(const C1* src, size_t n, std::basic_string<C2>& dst, uint32_t flags) const {
@@ -416,20 +797,7 @@ namespace RS::Unicorn {
                         return;
                     }
                 }
-                size_t pos = 0;
-                char32_t u = 0;
-                C2 buf[UtfEncoding<C2>::max_units];
-                while (pos < n) {
-                    auto rc = UtfEncoding<C1>::decode(src + pos, n - pos, u);
-                    if (! (flags & Utf::ignore) && ! char_is_unicode(u)) {
-                        if (flags & Utf::throws)
-                            throw EncodingError(UtfEncoding<C1>::name(), pos, src + pos, rc);
-                        u = replacement_char;
-                    }
-                    pos += rc;
-                    rc = UtfEncoding<C2>::encode(u, buf);
-                    dst.append(buf, rc);
-                }
+                bulk_recode(src, n, dst, flags);
             }
         };
 
@@ -447,25 +815,7 @@ namespace RS::Unicorn {
                         return;
                     }
                 }
-                size_t pos = 0;
-                char32_t u = 0;
-                if (flags & Utf::ignore) {
-                    while (pos < n) {
-                        pos += UtfEncoding<C1>::decode(src + pos, n - pos, u);
-                        dst += u;
-                    }
-                } else {
-                    while (pos < n) {
-                        auto rc = UtfEncoding<C1>::decode(src + pos, n - pos, u);
-                        if (char_is_unicode(u))
-                            dst += u;
-                        else if (flags & Utf::throws)
-                            throw EncodingError(UtfEncoding<C1>::name(), pos, src + pos, rc);
-                        else
-                            dst += replacement_char;
-                        pos += rc;
-                    }
-                }
+                bulk_recode(src, n, dst, flags);
             }
         };
 
@@ -476,6 +826,8 @@ namespace RS::Unicorn {
                     return;
                 if (popcount(flags & Utf::mask) == 0)
                     flags |= Utf::ignore;
+                if (n == npos)
+                    n = std::char_traits<char32_t>::length(src);
                 if constexpr (sizeof(C2) == 4) {
                     if (flags & Utf::ignore) {
                         dst.resize(dst.size() + n);
@@ -483,20 +835,7 @@ namespace RS::Unicorn {
                         return;
                     }
                 }
-                char32_t u = 0;
-                C2 buf[UtfEncoding<C2>::max_units];
-                for (size_t pos = 0; pos < n; ++pos) {
-                    if (n == npos && src[pos] == 0)
-                        break;
-                    else if ((flags & Utf::ignore) || char_is_unicode(src[pos]))
-                        u = src[pos];
-                    else if (flags & Utf::throws)
-                        throw EncodingError(UtfEncoding<char32_t>::name(), pos, src + pos);
-                    else
-                        u = replacement_char;
-                    auto rc = UtfEncoding<C2>::encode(u, buf);
-                    dst.append(buf, rc);
-                }
+                bulk_recode(src, n, dst, flags);
             }
         };
 
@@ -515,6 +854,15 @@ namespace RS::Unicorn {
                     return;
                 }
                 while (pos < n) {
+                    if constexpr (std::is_same_v<C, char>) {
+                        auto valid = utf8_validate(src + pos, n - pos);
+                        if (valid == npos) {
+                            dst.append(src + pos, n - pos);
+                            break;
+                        }
+                        dst.append(src + pos, valid);
+                        pos += valid;
+                    }
                     auto rc = UtfEncoding<C>::decode(src + pos, n - pos, u);
                     if (char_is_unicode(u)) {
                         dst.append(src + pos, rc);
@@ -584,6 +932,20 @@ namespace RS::Unicorn {
         return result;
     }
 
+    template <typename C1, typename C2>
+    void recode(std::basic_string_view<C1> src, std::basic_string<C2>& dst, uint32_t flags = 0) {
+        std::basic_string<C2> result;
+        UnicornDetail::Recode<C1, C2>()(src.data(), src.size(), result, flags);
+        dst = std::move(result);
+    }
+
+    template <typename C2, typename C1>
+    std::basic_string<C2> recode(std::basic_string_view<C1> src, uint32_t flags = 0) {
+        std::basic_string<C2> result;
+        UnicornDetail::Recode<C1, C2>()(src.data(), src.size(), result, flags);
+        return result;
+    }
+
     template <typename C2, typename C1>
     std::basic_string<C2> recode(const std::basic_string<C1>& src, size_t offset, uint32_t flags) {
         std::basic_string<C2> result;
@@ -592,6 +954,16 @@ namespace RS::Unicorn {
         return result;
     }
 
+    template <uint32_t Policy, typename C1, typename C2>
+    void recode(const std::basic_string<C1>& src, std::basic_string<C2>& dst) {
+        recode(src, dst, Policy);
+    }
+
+    template <uint32_t Policy, typename C2, typename C1>
+    std::basic_string<C2> recode(const std::basic_string<C1>& src) {
+        return recode<C2>(src, Policy);
+    }
+
     template <typename C>
     Ustring to_utf8(const std::basic_string<C>& src, uint32_t flags = 0) {
         return recode<char>(src, flags);
@@ -625,6 +997,11 @@ namespace RS::Unicorn {
         auto data = str.data();
         size_t pos = 0, size = str.size();
         char32_t u = 0;
+        if constexpr (std::is_same_v<C, char>) {
+            pos = utf8_validate(data, size);
+            if (pos == npos)
+                return;
+        }
         while (pos < size) {
             auto rc = UtfEncoding<C>::decode(data + pos, size - pos, u);
             if (! char_is_unicode(u))
@@ -634,8 +1011,10 @@ namespace RS::Unicorn {
     }
 
     template <typename C>
-    bool valid_string(const std::basic_string<C>& str) noexcept {
+    bool valid_string(std::basic_string_view<C> str) noexcept {
         using namespace UnicornDetail;
+        if constexpr (std::is_same_v<C, char>)
+            return utf8_validate(str.data(), str.size()) == npos;
         auto data = str.data();
         size_t pos = 0, size = str.size();
         char32_t u = 0;
@@ -649,8 +1028,15 @@ namespace RS::Unicorn {
         return true;
     }
 
+    template <typename C>
+    bool valid_string(const std::basic_string<C>& str) noexcept {
+        return valid_string(std::basic_string_view<C>(str));
+    }
+
     template <typename C>
     std::basic_string<C> sanitize(const std::basic_string<C>& str) {
+        if (valid_string(str))
+            return str;
         std::basic_string<C> result;
         recode(str, result, Utf::replace);
         return result;
@@ -658,6 +1044,8 @@ namespace RS::Unicorn {
 
     template <typename C>
     void sanitize_in(std::basic_string<C>& str) {
+        if (valid_string(str))
+            return;
         std::basic_string<C> result;
         recode(str, result, Utf::replace);
         str = std::move(result);
@@ -666,6 +1054,8 @@ namespace RS::Unicorn {
     template <typename C>
     size_t valid_count(const std::basic_string<C>& str) noexcept {
         using namespace UnicornDetail;
+        if constexpr (std::is_same_v<C, char>)
+            return utf8_validate(str.data(), str.size());
         auto data = str.data();
         size_t pos = 0, size = str.size();
         char32_t u = 0;